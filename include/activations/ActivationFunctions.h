@@ -1,16 +1,21 @@
 #ifndef ACTIVATION_FUNCTIONS_H
 #define ACTIVATION_FUNCTIONS_H
 
+#include "../matrix/Gemm.h"
 #include "../matrix/Matrix.h"
 #include <functional>
 
 /**
  * @brief Abstract base class for all activation functions.
  * Each activation function transforms neuron inputs before passing them to the next layer.
+ * 
+ * Every activation is a template over the element type; the aliases at the end of this file name the double
+ * (e.g. SigmoidActivation) and float (e.g. SigmoidActivationF) versions.
  */
-class ActivationFunction {
+template <typename T>
+class BasicActivationFunction {
     public:
-        virtual ~ActivationFunction() = default;
+        virtual ~BasicActivationFunction() = default;
 
         // Forward Propagation
         /**
@@ -21,7 +26,7 @@ class ActivationFunction {
          * @param input The input matrix.
          * @return The transformed matrix after applying the activation function.
          */
-        virtual Matrix apply(const Matrix& input) const = 0;
+        virtual BasicMatrix<T> apply(const BasicMatrix<T>& input) const = 0;
 
         // Backward Propagation
         /**
@@ -32,7 +37,42 @@ class ActivationFunction {
          * @param input The input matrix.
          * @return The matrix after applying the derivative of the activation function.
          */
-        virtual Matrix applyDerivative(const Matrix& input) const = 0;
+        virtual BasicMatrix<T> applyDerivative(const BasicMatrix<T>& input) const = 0;
+
+        /**
+         * @brief Apply the activation function in place.
+         * 
+         * Used by fused kernels that activate their output while it is still in cache. The built-in activations
+         * override this with a direct loop; the default goes through apply() and a temporary.
+         * 
+         * @param values The elements to transform (may be strided).
+         */
+        virtual void applyInPlace(BasicMatrixView<T> values) const {
+            const BasicMatrix<T> result = apply(BasicMatrix<T>(values));
+            for (size_t i = 0; i < values.getRows(); ++i) {
+                for (size_t j = 0; j < values.getCols(); ++j) {
+                    values(i, j) = result(i, j);
+                }
+            }
+        }
+
+        /**
+         * @brief A GEMM epilogue that adds the given biases and then applies this activation (see kernels::Epilogue).
+         * 
+         * @param rowBias One bias per row of the product, or nullptr.
+         * @param colBias One bias per column of the product, or nullptr.
+         * @return The epilogue; it refers to this activation, which must outlive the gemm() call.
+         */
+        kernels::Epilogue<T> epilogue(const T* rowBias = nullptr, const T* colBias = nullptr) const {
+            kernels::Epilogue<T> result;
+            result.rowBias = rowBias;
+            result.colBias = colBias;
+            result.activation = [](const void* context, BasicMatrixView<T> tile) {
+                static_cast<const BasicActivationFunction*>(context)->applyInPlace(tile);
+            };
+            result.context = this;
+            return result;
+        }
 };
 
 /**
@@ -45,10 +85,12 @@ class ActivationFunction {
  * - Common in logistic regression and simple neural networks.
  * More details: https://en.wikipedia.org/wiki/Sigmoid_function
  */
-class SigmoidActivation : public ActivationFunction {
+template <typename T>
+class BasicSigmoidActivation : public BasicActivationFunction<T> {
     public:
-        Matrix apply(const Matrix& input) const override;
-        Matrix applyDerivative(const Matrix& input) const override;
+        BasicMatrix<T> apply(const BasicMatrix<T>& input) const override;
+        BasicMatrix<T> applyDerivative(const BasicMatrix<T>& input) const override;
+        void applyInPlace(BasicMatrixView<T> values) const override;
 };
 
 /**
@@ -62,19 +104,22 @@ class SigmoidActivation : public ActivationFunction {
  * - Helps avoid vanishing gradient problems.
  * More details: https://arxiv.org/abs/1710.05941
  */
-class SwishActivation : public SigmoidActivation {
+template <typename T>
+class BasicSwishActivation : public BasicSigmoidActivation<T> {
     public:
-        Matrix apply(const Matrix& input) const override;
-        Matrix applyDerivative(const Matrix& input) const override;
+        BasicMatrix<T> apply(const BasicMatrix<T>& input) const override;
+        BasicMatrix<T> applyDerivative(const BasicMatrix<T>& input) const override;
+        void applyInPlace(BasicMatrixView<T> values) const override;
 };
 
 /**
  * @brief Base class for all ReLU-based activation functions.
  * This includes standard ReLU and Leaky ReLU.
  */
-class ReLUBasedActivation : public ActivationFunction {
+template <typename T>
+class BasicReLUBasedActivation : public BasicActivationFunction<T> {
     public:
-        virtual ~ReLUBasedActivation() = default;
+        virtual ~BasicReLUBasedActivation() = default;
 };
 
 /**
@@ -88,10 +133,12 @@ class ReLUBasedActivation : public ActivationFunction {
  * - Used extensively in CNNs.
  * More details: https://en.wikipedia.org/wiki/Rectifier_(neural_networks)
  */
-class ReLUActivation : public ReLUBasedActivation {
+template <typename T>
+class BasicReLUActivation : public BasicReLUBasedActivation<T> {
     public:
-        Matrix apply(const Matrix& input) const override;
-        Matrix applyDerivative(const Matrix& input) const override;
+        BasicMatrix<T> apply(const BasicMatrix<T>& input) const override;
+        BasicMatrix<T> applyDerivative(const BasicMatrix<T>& input) const override;
+        void applyInPlace(BasicMatrixView<T> values) const override;
 };
 
 /**
@@ -105,19 +152,22 @@ class ReLUActivation : public ReLUBasedActivation {
  * - Useful in deeper networks.
  * More details: https://papers.nips.cc/paper_files/paper/2013/hash/7bcec277d0157c7a6ba0d4d7d8c9430e-Abstract.html
  */
-class LeakyReLUActivation : public ReLUBasedActivation {
+template <typename T>
+class BasicLeakyReLUActivation : public BasicReLUBasedActivation<T> {
     public:
-        Matrix apply(const Matrix& input) const override;
-        Matrix applyDerivative(const Matrix& input) const override;
+        BasicMatrix<T> apply(const BasicMatrix<T>& input) const override;
+        BasicMatrix<T> applyDerivative(const BasicMatrix<T>& input) const override;
+        void applyInPlace(BasicMatrixView<T> values) const override;
 };
 
 /**
  * @brief Base class for all Tanh-based activation functions.
  * This includes standard Tanh and its variants.
  */
-class TanhBasedActivation : public ActivationFunction {
+template <typename T>
+class BasicTanhBasedActivation : public BasicActivationFunction<T> {
     public:
-        virtual ~TanhBasedActivation() = default;
+        virtual ~BasicTanhBasedActivation() = default;
 };
 
 /**
@@ -130,10 +180,12 @@ class TanhBasedActivation : public ActivationFunction {
  * - Common in recurrent neural networks (RNNs).
  * More details: https://en.wikipedia.org/wiki/Hyperbolic_function#Hyperbolic_tangent
  */
-class TanhActivation : public TanhBasedActivation {
+template <typename T>
+class BasicTanhActivation : public BasicTanhBasedActivation<T> {
     public:
-        Matrix apply(const Matrix& input) const override;
-        Matrix applyDerivative(const Matrix& input) const override;
+        BasicMatrix<T> apply(const BasicMatrix<T>& input) const override;
+        BasicMatrix<T> applyDerivative(const BasicMatrix<T>& input) const override;
+        void applyInPlace(BasicMatrixView<T> values) const override;
 };
 
 /**
@@ -147,10 +199,49 @@ class TanhActivation : public TanhBasedActivation {
  * - Used in hardware-efficient AI.
  * More details: https://pytorch.org/docs/stable/generated/torch.nn.Hardtanh.html
  */
-class HardTanhActivation : public TanhBasedActivation {
+template <typename T>
+class BasicHardTanhActivation : public BasicTanhBasedActivation<T> {
     public:
-        Matrix apply(const Matrix& input) const override;
-        Matrix applyDerivative(const Matrix& input) const override;
+        BasicMatrix<T> apply(const BasicMatrix<T>& input) const override;
+        BasicMatrix<T> applyDerivative(const BasicMatrix<T>& input) const override;
+        void applyInPlace(BasicMatrixView<T> values) const override;
 };
 
+
+// Double-precision activations
+using ActivationFunction = BasicActivationFunction<double>;
+using SigmoidActivation = BasicSigmoidActivation<double>;
+using SwishActivation = BasicSwishActivation<double>;
+using ReLUBasedActivation = BasicReLUBasedActivation<double>;
+using ReLUActivation = BasicReLUActivation<double>;
+using LeakyReLUActivation = BasicLeakyReLUActivation<double>;
+using TanhBasedActivation = BasicTanhBasedActivation<double>;
+using TanhActivation = BasicTanhActivation<double>;
+using HardTanhActivation = BasicHardTanhActivation<double>;
+
+// Single-precision activations
+using ActivationFunctionF = BasicActivationFunction<float>;
+using SigmoidActivationF = BasicSigmoidActivation<float>;
+using SwishActivationF = BasicSwishActivation<float>;
+using ReLUBasedActivationF = BasicReLUBasedActivation<float>;
+using ReLUActivationF = BasicReLUActivation<float>;
+using LeakyReLUActivationF = BasicLeakyReLUActivation<float>;
+using TanhBasedActivationF = BasicTanhBasedActivation<float>;
+using TanhActivationF = BasicTanhActivation<float>;
+using HardTanhActivationF = BasicHardTanhActivation<float>;
+
+// Explicitly instantiated in ActivationFunctions.cpp
+extern template class BasicSigmoidActivation<double>;
+extern template class BasicSwishActivation<double>;
+extern template class BasicReLUActivation<double>;
+extern template class BasicLeakyReLUActivation<double>;
+extern template class BasicTanhActivation<double>;
+extern template class BasicHardTanhActivation<double>;
+extern template class BasicSigmoidActivation<float>;
+extern template class BasicSwishActivation<float>;
+extern template class BasicReLUActivation<float>;
+extern template class BasicLeakyReLUActivation<float>;
+extern template class BasicTanhActivation<float>;
+extern template class BasicHardTanhActivation<float>;
+
 #endif // ACTIVATION_FUNCTIONS_H
\ No newline at end of file
@@ -1,9 +1,13 @@
 #ifndef DENSE_LAYER_H
 #define DENSE_LAYER_H
 
+#include "../matrix/HalfMatrix.h"
 #include "../matrix/Matrix.h"
+#include "../matrix/QuantizedMatrix.h"
+#include "../matrix/SparseMatrix.h"
 #include "StatefulLayer.h"
 #include <memory>
+#include <optional>
 
 // Dense Layer (Fully Connected Layer)
 /**
@@ -14,22 +18,113 @@
  * 
  * More details: https://en.wikipedia.org/wiki/Feedforward_neural_network
  */
-class DenseLayer : public StatefulLayer {
+template <typename T>
+class BasicDenseLayer : public BasicStatefulLayer<T> {
 private:
-    Matrix weights, biases;
+    BasicMatrix<T> weights, biases;
+    std::optional<QuantizedMatrix> quantizedWeights;  // int8 copy of the weights used by forward() when quantized
+    std::optional<HalfMatrix> halfWeights;            // Replaces weights in half-precision mode
 public:
-    // Constructor
-    DenseLayer(size_t inputSize, size_t neurons, std::shared_ptr<ActivationFunction> activationFunc);
+    // Constructors (the weights are drawn from rng, or from Philox::global() if none is given)
+    BasicDenseLayer(size_t inputSize, size_t neurons, std::shared_ptr<BasicActivationFunction<T>> activationFunc);
+    BasicDenseLayer(size_t inputSize, size_t neurons, std::shared_ptr<BasicActivationFunction<T>> activationFunc,
+                    Philox& rng);
 
     // State Management
-    inline DenseLayer& resetStates() override {
-        clearInputCache(); // Only clears inputCache, no other state variables
+    inline BasicDenseLayer& resetStates() override {
+        this->clearInputCache(); // Only clears inputCache, no other state variables
         return *this;
     }
 
     // Forward and Backward Propagation
-    Matrix forward(const Matrix& input) override;
-    Matrix backward(const Matrix& gradient) override;
+    BasicMatrix<T> forward(const BasicMatrix<T>& input) override;
+    BasicMatrix<T> backward(const BasicMatrix<T>& gradient) override;
+
+    /**
+     * @brief forward() into a caller-provided output, e.g. a buffer kept across calls for allocation-free serving.
+     * 
+     * Behaves exactly like forward(), including the quantized and half-precision modes.
+     * 
+     * @param input The inputSize x batch input.
+     * @param output The neurons x batch output (a matrix or a view with any strides).
+     * @throws std::invalid_argument If the output shape does not match.
+     */
+    void forwardInto(const BasicMatrix<T>& input, typename BasicMatrix<T>::View output);
+
+    // Sparse Input
+    /**
+     * @brief Forward pass for a sparse input, e.g. a batch of bag-of-words or one-hot vectors.
+     * 
+     * Only the weight columns of features present in the batch are read. The sparse input is not cached;
+     * pass it to the sparse backward() overload.
+     * 
+     * @param input The inputSize x batch sparse input (one column per sample, as for the dense forward()).
+     * @return The neurons x batch output.
+     */
+    BasicMatrix<T> forward(const BasicSparseMatrix<T>& input);
+
+    /**
+     * @brief Backward pass for a sparse input: updates only the weight columns of features present in input.
+     * 
+     * Sparse inputs are leaves of the network (features, not activations), so no input gradient is computed.
+     * 
+     * @param gradient The neurons x batch gradient of the loss with respect to the output.
+     * @param input The sparse input that was passed to forward().
+     * @return A reference to the layer.
+     */
+    BasicDenseLayer& backward(const BasicMatrix<T>& gradient, const BasicSparseMatrix<T>& input);
+
+    // Quantized Inference
+    /**
+     * @brief Run the dense forward() on int8 weights (post-training quantization), e.g. for CPU serving.
+     * 
+     * The weights are quantized once, per neuron or per tensor; each forward() then quantizes the input per
+     * sample and multiplies with kernels::quantizedGemm(), reading an eighth of the weight bytes of a double layer.
+     * The full-precision weights are kept, but backward() is unavailable until disableQuantization().
+     * 
+     * @param granularity Whether each neuron's weights get their own scale.
+     * @return A reference to the layer.
+     * @throws std::runtime_error If the weights are in half precision.
+     */
+    BasicDenseLayer& enableQuantization(QuantizationGranularity granularity = QuantizationGranularity::PerRow);
+
+    /**
+     * @brief Return to full-precision weights.
+     */
+    BasicDenseLayer& disableQuantization();
+
+    inline bool isQuantized() const {
+        return quantizedWeights.has_value();
+    }
+
+    // Half-Precision Inference
+    /**
+     * @brief Store the weights in 16 bits, releasing the full-precision copy (a quarter of the memory of doubles).
+     * 
+     * forward() widens the weights block by block as it multiplies (see the HalfMatrix gemm() overloads). Only the
+     * dense forward() is available in this mode; the sparse and backward passes throw.
+     * 
+     * @param format bfloat16 (the default; any range) or IEEE float16 (more precision, values up to 65504).
+     * @return A reference to the layer.
+     * @throws std::runtime_error If the layer is quantized.
+     */
+    BasicDenseLayer& enableHalfPrecision(HalfFormat format = HalfFormat::BFloat16);
+
+    /**
+     * @brief Widen the weights back to full precision (they keep the rounding of the 16-bit format).
+     */
+    BasicDenseLayer& disableHalfPrecision();
+
+    inline bool isHalfPrecision() const {
+        return halfWeights.has_value();
+    }
 };
 
+using DenseLayer = BasicDenseLayer<double>;
+using DenseLayerF = BasicDenseLayer<float>;
+
+// Explicitly instantiated in DenseLayer.cpp
+extern template class BasicDenseLayer<double>;
+extern template class BasicDenseLayer<float>;
+
 #endif
\ No newline at end of file
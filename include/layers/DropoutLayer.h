@@ -2,7 +2,6 @@
 #define DROPOUT_LAYER_H
 
 #include "Layer.h"
-#include <random>
 
 /**
  * @brief Dropout Layer - Disables neurons during training to prevent overfitting.
@@ -12,21 +11,31 @@
  * 
  * More details: https://en.wikipedia.org/wiki/Dropout_(neural_networks)
  */
-class DropoutLayer : public Layer {
+template <typename T>
+class BasicDropoutLayer : public BasicLayer<T> {
 private:
     float dropoutRate;
-    std::mt19937 rng;
-    Matrix dropoutMask;  // Stores dropped neurons (1 = active, 0 = dropped)
+    Philox rng;  // Draws the dropout masks
+    BasicMatrix<T> dropoutMask;  // Stores dropped neurons (1 = active, 0 = dropped)
 
 public:
-    // Constructor
-    DropoutLayer(size_t inputSize, size_t neurons, std::shared_ptr<ActivationFunction> activationFunc, float dropoutRate);
+    // Constructors (the weights and the mask sequence are drawn from rng, or from Philox::global() if none is given)
+    BasicDropoutLayer(size_t inputSize, size_t neurons, std::shared_ptr<BasicActivationFunction<T>> activationFunc, float dropoutRate);
+    BasicDropoutLayer(size_t inputSize, size_t neurons, std::shared_ptr<BasicActivationFunction<T>> activationFunc, float dropoutRate,
+                      Philox& rng);
 
     // Forward and Backward Propagation
-    Matrix forward(const Matrix& input) override;
-    inline Matrix backward(const Matrix& gradient) override {
+    BasicMatrix<T> forward(const BasicMatrix<T>& input) override;
+    inline BasicMatrix<T> backward(const BasicMatrix<T>& gradient) override {
         return gradient * dropoutMask;  // Zero out gradients for dropped neurons
     }
 };
 
+using DropoutLayer = BasicDropoutLayer<double>;
+using DropoutLayerF = BasicDropoutLayer<float>;
+
+// Explicitly instantiated in DropoutLayer.cpp
+extern template class BasicDropoutLayer<double>;
+extern template class BasicDropoutLayer<float>;
+
 #endif // DROPOUT_LAYER_H
@@ -0,0 +1,150 @@
+#ifndef FIXED_GRU_LAYER_H
+#define FIXED_GRU_LAYER_H
+
+#include <array>
+#include <cmath>
+#include "../matrix/FixedMatrix.h"
+#include "StatefulLayer.h"
+
+/**
+ * @brief GRU layer whose input and hidden sizes are compile-time constants.
+ *
+ * Computes the same recurrence as GRULayer, but all weights, gates and state are FixedMatrix values held inside the
+ * layer, so step() performs no heap allocation and no runtime shape checks. Use it when the hidden size is small and
+ * known at build time (e.g. 32 or 64), where per-step overhead dominates the arithmetic.
+ *
+ * forward()/backward() keep the Layer interface (one 1 x InputSize row per call) and convert at the boundary;
+ * step()/stepBackward() work on FixedMatrix directly.
+ *
+ * Header-only, since it is instantiated for each size used.
+ *
+ * @tparam T Element type, double or float.
+ * @tparam InputSize Number of input features.
+ * @tparam HiddenSize Number of hidden units.
+ */
+template <typename T, size_t InputSize, size_t HiddenSize>
+class BasicFixedGRULayer : public BasicStatefulLayer<T> {
+public:
+    using Input = BasicFixedMatrix<T, 1, InputSize>;
+    using Hidden = BasicFixedMatrix<T, 1, HiddenSize>;
+
+private:
+    BasicFixedMatrix<T, InputSize, HiddenSize> W_z, W_r, W_h;  // Weights for update, reset, and candidate activation
+    BasicFixedMatrix<T, HiddenSize, HiddenSize> U_z, U_r, U_h; // Recurrent weights
+    Hidden b_z, b_r, b_h;                                       // Biases
+    Hidden hiddenState;
+    Input lastInput;
+
+    static T sigmoid(T x) { return T(1) / (T(1) + std::exp(-x)); }
+    static T tanh(T x) { return std::tanh(x); }
+
+    struct Gates {
+        Hidden z, r, hTilde;
+    };
+
+    Gates computeGates(const Input& input) const {
+        Gates g;
+        g.z = (input.multiply(W_z) + hiddenState.multiply(U_z) + b_z).applyFunction(sigmoid);
+        g.r = (input.multiply(W_r) + hiddenState.multiply(U_r) + b_r).applyFunction(sigmoid);
+        g.hTilde = (input.multiply(W_h) + (hiddenState * g.r).multiply(U_h) + b_h).applyFunction(tanh);
+        return g;
+    }
+
+public:
+    // Constructors (the weights are drawn from rng, or from Philox::global() if none is given)
+    BasicFixedGRULayer() : BasicFixedGRULayer(Philox::global()) {}
+
+    explicit BasicFixedGRULayer(Philox& rng) : BasicStatefulLayer<T>(InputSize, HiddenSize, nullptr) {
+        W_z.randomize(rng); W_r.randomize(rng); W_h.randomize(rng);
+        U_z.randomize(rng); U_r.randomize(rng); U_h.randomize(rng);
+        b_z.randomize(rng); b_r.randomize(rng); b_h.randomize(rng);
+    }
+
+    // State Management
+    inline BasicFixedGRULayer& resetStates() override {
+        resetHiddenState();
+        lastInput.setData(T(0));
+        this->clearInputCache();
+        return *this;
+    }
+
+    BasicFixedGRULayer& resetHiddenState() {
+        hiddenState.setData(T(0));
+        return *this;
+    }
+
+    // Fixed-size Propagation
+    /**
+     * @brief Advance the recurrence by one time step.
+     *
+     * @param input One input row.
+     * @return The new hidden state.
+     */
+    const Hidden& step(const Input& input) {
+        lastInput = input;
+        const Gates g = computeGates(input);
+        hiddenState = ((T(1) - g.z) * hiddenState) + (g.z * g.hTilde);
+        return hiddenState;
+    }
+
+    /**
+     * @brief Backward pass for the last step, updating the input weights in place.
+     *
+     * @param gradOutput Gradient of the loss with respect to the hidden state.
+     * @return Gradient of the loss with respect to the input.
+     * @throws std::runtime_error if step() or forward() has not been called.
+     */
+    Input stepBackward(const Hidden& gradOutput) {
+        if (lastInput == Input{}) {
+            throw std::runtime_error("Backward pass: forward() must be called before backward().");
+        }
+        const Gates g = computeGates(lastInput);
+
+        // Compute gradients
+        const Hidden dH = gradOutput * (T(1) - g.z);
+        const Hidden dZ = gradOutput * (g.hTilde - hiddenState);
+        const Hidden dR = dH * hiddenState.multiply(U_h);
+
+        // Weight updates
+        const auto inputT = lastInput.transpose();
+        W_z.axpy(T(-0.01), inputT.multiply(dZ));
+        W_r.axpy(T(-0.01), inputT.multiply(dR));
+        W_h.axpy(T(-0.01), inputT.multiply(dH));
+
+        return dH.multiply(W_z.transpose());
+    }
+
+    // Forward and Backward Propagation
+    BasicMatrix<T> forward(const BasicMatrix<T>& input) override {
+        if (input.isEmpty()) {
+            throw std::runtime_error("Forward pass: Input matrix is empty.");
+        }
+        this->inputCache = input;
+        return step(Input(input)).toMatrix();
+    }
+
+    BasicMatrix<T> backward(const BasicMatrix<T>& gradOutput) override {
+        return stepBackward(Hidden(gradOutput)).toMatrix();
+    }
+
+    // Getters
+    inline const Hidden& getHiddenState() const {
+        return hiddenState;
+    }
+
+    /**
+     * @brief The weights and biases as views, in the same order as GRULayer::getParameters().
+     */
+    std::array<BasicMatrixView<T>, 9> getParameters() {
+        return {W_z.view(), W_r.view(), W_h.view(), U_z.view(), U_r.view(), U_h.view(),
+                b_z.view(), b_r.view(), b_h.view()};
+    }
+};
+
+template <size_t InputSize, size_t HiddenSize>
+using FixedGRULayer = BasicFixedGRULayer<double, InputSize, HiddenSize>;
+
+template <size_t InputSize, size_t HiddenSize>
+using FixedGRULayerF = BasicFixedGRULayer<float, InputSize, HiddenSize>;
+
+#endif // FIXED_GRU_LAYER_H
@@ -0,0 +1,140 @@
+#ifndef FIXED_LSTM_LAYER_H
+#define FIXED_LSTM_LAYER_H
+
+#include <array>
+#include <cmath>
+#include "../matrix/FixedMatrix.h"
+#include "StatefulLayer.h"
+
+/**
+ * @brief LSTM layer whose input and hidden sizes are compile-time constants.
+ *
+ * Computes the same recurrence as LSTMLayer with FixedMatrix weights, gates and state, so step() performs no heap
+ * allocation and no runtime shape checks. forward()/backward() keep the Layer interface and convert at the boundary.
+ *
+ * Header-only, since it is instantiated for each size used.
+ *
+ * @tparam T Element type, double or float.
+ * @tparam InputSize Number of input features.
+ * @tparam HiddenSize Number of hidden units.
+ */
+template <typename T, size_t InputSize, size_t HiddenSize>
+class BasicFixedLSTMLayer : public BasicStatefulLayer<T> {
+public:
+    using Input = BasicFixedMatrix<T, 1, InputSize>;
+    using Hidden = BasicFixedMatrix<T, 1, HiddenSize>;
+
+private:
+    BasicFixedMatrix<T, InputSize, HiddenSize> W_f, W_i, W_c, W_o;  // Weights for forget, input, cell, output gates
+    BasicFixedMatrix<T, HiddenSize, HiddenSize> U_f, U_i, U_c, U_o; // Recurrent weights
+    Hidden b_f, b_i, b_c, b_o;                                       // Biases
+    Hidden hiddenState;
+    Hidden cellState; // Stores long-term memory
+    Input lastInput;
+
+    static T sigmoid(T x) { return T(1) / (T(1) + std::exp(-x)); }
+    static T tanh(T x) { return std::tanh(x); }
+
+public:
+    // Constructors (the weights are drawn from rng, or from Philox::global() if none is given)
+    BasicFixedLSTMLayer() : BasicFixedLSTMLayer(Philox::global()) {}
+
+    explicit BasicFixedLSTMLayer(Philox& rng) : BasicStatefulLayer<T>(InputSize, HiddenSize, nullptr) {
+        W_f.randomize(rng); W_i.randomize(rng); W_c.randomize(rng); W_o.randomize(rng);
+        U_f.randomize(rng); U_i.randomize(rng); U_c.randomize(rng); U_o.randomize(rng);
+        b_f.randomize(rng); b_i.randomize(rng); b_c.randomize(rng); b_o.randomize(rng);
+    }
+
+    // State Management
+    BasicFixedLSTMLayer& resetStates() override {
+        hiddenState.setData(T(0));
+        cellState.setData(T(0));
+        lastInput.setData(T(0));
+        this->clearInputCache();
+        return *this;
+    }
+
+    // Fixed-size Propagation
+    /**
+     * @brief Advance the recurrence by one time step.
+     *
+     * @param input One input row.
+     * @return The new hidden state.
+     */
+    const Hidden& step(const Input& input) {
+        lastInput = input;
+
+        const Hidden f_t = (input.multiply(W_f) + hiddenState.multiply(U_f) + b_f).applyFunction(sigmoid);
+        const Hidden i_t = (input.multiply(W_i) + hiddenState.multiply(U_i) + b_i).applyFunction(sigmoid);
+        const Hidden c_tilde = (input.multiply(W_c) + hiddenState.multiply(U_c) + b_c).applyFunction(tanh);
+        cellState = (f_t * cellState) + (i_t * c_tilde);
+
+        const Hidden o_t = (input.multiply(W_o) + hiddenState.multiply(U_o) + b_o).applyFunction(sigmoid);
+        hiddenState = o_t * cellState.applyFunction(tanh);
+        return hiddenState;
+    }
+
+    /**
+     * @brief Backward pass for the last step, updating the input weights in place.
+     *
+     * @param gradOutput Gradient of the loss with respect to the hidden state.
+     * @return Gradient of the loss with respect to the input.
+     * @throws std::runtime_error if step() or forward() has not been called.
+     */
+    Input stepBackward(const Hidden& gradOutput) {
+        if (lastInput == Input{}) {
+            throw std::runtime_error("Backward pass: forward() must be called before backward().");
+        }
+
+        const Hidden dO = gradOutput * cellState.applyFunction(tanh);
+        const Hidden dC = gradOutput * hiddenState;
+        const Hidden dF = gradOutput * cellState;
+        const Hidden dI = gradOutput * dC;
+
+        const auto inputT = lastInput.transpose();
+        W_o.axpy(T(-0.01), inputT.multiply(dO));
+        W_f.axpy(T(-0.01), inputT.multiply(dF));
+        W_i.axpy(T(-0.01), inputT.multiply(dI));
+        W_c.axpy(T(-0.01), inputT.multiply(dC));
+
+        return gradOutput.multiply(W_f.transpose());
+    }
+
+    // Forward and Backward Propagation
+    BasicMatrix<T> forward(const BasicMatrix<T>& input) override {
+        if (input.isEmpty()) {
+            throw std::runtime_error("Forward pass: Input matrix is empty.");
+        }
+        this->inputCache = input;
+        return step(Input(input)).toMatrix();
+    }
+
+    BasicMatrix<T> backward(const BasicMatrix<T>& gradOutput) override {
+        return stepBackward(Hidden(gradOutput)).toMatrix();
+    }
+
+    // Getters
+    inline const Hidden& getHiddenState() const {
+        return hiddenState;
+    }
+
+    inline const Hidden& getCellState() const {
+        return cellState;
+    }
+
+    /**
+     * @brief The weights and biases as views, in the same order as LSTMLayer::getParameters().
+     */
+    std::array<BasicMatrixView<T>, 12> getParameters() {
+        return {W_f.view(), W_i.view(), W_c.view(), W_o.view(), U_f.view(), U_i.view(), U_c.view(), U_o.view(),
+                b_f.view(), b_i.view(), b_c.view(), b_o.view()};
+    }
+};
+
+template <size_t InputSize, size_t HiddenSize>
+using FixedLSTMLayer = BasicFixedLSTMLayer<double, InputSize, HiddenSize>;
+
+template <size_t InputSize, size_t HiddenSize>
+using FixedLSTMLayerF = BasicFixedLSTMLayer<float, InputSize, HiddenSize>;
+
+#endif // FIXED_LSTM_LAYER_H
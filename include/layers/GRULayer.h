@@ -4,6 +4,8 @@
 #include "../matrix/Matrix.h"
 #include "../activations/ActivationFunctions.h"
 #include "StatefulLayer.h"
+#include <array>
+#include <vector>
 
 /**
  * @brief Gated Recurrent Unit (GRU) Layer.
@@ -13,37 +15,107 @@
  * 
  * More details: https://en.wikipedia.org/wiki/Gated_recurrent_unit
  */
-class GRULayer : public StatefulLayer {
+template <typename T>
+class BasicGRULayer : public BasicStatefulLayer<T> {
 private:
-    Matrix W_z, W_r, W_h; // Weights for update, reset, and candidate activation
-    Matrix U_z, U_r, U_h; // Recurrent weights
-    Matrix b_z, b_r, b_h; // Biases
-    Matrix hiddenState;    // Hidden state
+    BasicMatrix<T> W_z, W_r, W_h; // Weights for update, reset, and candidate activation
+    BasicMatrix<T> U_z, U_r, U_h; // Recurrent weights
+    BasicMatrix<T> b_z, b_r, b_h; // Biases
+    BasicMatrix<T> hiddenState;    // Hidden state
+    std::vector<QuantizedMatrix> quantizedWeights; // W_z, W_r, W_h, U_z, U_r, U_h transposed, when quantized
+    std::vector<HalfMatrix> halfWeights; // The same six matrices, replacing them in half-precision mode
+
+    std::array<BasicMatrix<T>*, 6> weightMatrices() {
+        return {&W_z, &W_r, &W_h, &U_z, &U_r, &U_h};
+    }
 
 public:
-    // Constructor
-    GRULayer(size_t inputSize, size_t hiddenSize);
+    // Constructors (the weights are drawn from rng, or from Philox::global() if none is given)
+    BasicGRULayer(size_t inputSize, size_t hiddenSize);
+    BasicGRULayer(size_t inputSize, size_t hiddenSize, Philox& rng);
 
     // State Management
-    inline GRULayer& resetStates() override {
+    inline BasicGRULayer& resetStates() override {
         resetHiddenState();
-        clearInputCache();
+        this->clearInputCache();
         return *this;
     }
 
-    GRULayer& resetHiddenState() {
+    BasicGRULayer& resetHiddenState() {
         hiddenState.setData(0.0);
         return *this;
     }
 
     // Forward and Backward Propagation
-    Matrix forward(const Matrix& input) override;
-    Matrix backward(const Matrix& gradOutput) override;
+    BasicMatrix<T> forward(const BasicMatrix<T>& input) override;
+    BasicMatrix<T> backward(const BasicMatrix<T>& gradOutput) override;
+
+    // Quantized Inference
+    /**
+     * @brief Quantize W and U (post-training) so that forward() computes its three gates in int8.
+     * 
+     * The input of each step is quantized once for all gates; the candidate gate quantizes the reset hidden
+     * state separately. Training needs the full-precision weights, so backward() throws while quantized.
+     * 
+     * @param granularity Whether each hidden unit's weights get their own scale.
+     * @return A reference to the layer.
+     * @throws std::runtime_error If the weights are in half precision.
+     */
+    BasicGRULayer& enableQuantization(QuantizationGranularity granularity = QuantizationGranularity::PerRow);
+
+    /**
+     * @brief Return to full-precision weights.
+     */
+    BasicGRULayer& disableQuantization();
+
+    inline bool isQuantized() const {
+        return !quantizedWeights.empty();
+    }
+
+    // Half-Precision Inference
+    /**
+     * @brief Store W and U as bfloat16 or float16, dropping the full-precision matrices.
+     * 
+     * Each gate product widens the 16-bit weights into a small workspace block as it goes. Inference only:
+     * backward() throws until disableHalfPrecision().
+     * 
+     * @param format bfloat16 (the default) or IEEE float16.
+     * @return A reference to the layer.
+     * @throws std::runtime_error If the layer is quantized.
+     */
+    BasicGRULayer& enableHalfPrecision(HalfFormat format = HalfFormat::BFloat16);
+
+    /**
+     * @brief Widen the weights back to full precision (they keep the rounding of the 16-bit format).
+     */
+    BasicGRULayer& disableHalfPrecision();
+
+    inline bool isHalfPrecision() const {
+        return !halfWeights.empty();
+    }
 
     // Getters
-    inline Matrix getHiddenState() const {
+    inline BasicMatrix<T> getHiddenState() const {
         return hiddenState;
     }
+
+    /**
+     * @brief The weights and biases, in the order W_z, W_r, W_h, U_z, U_r, U_h, b_z, b_r, b_h.
+     * 
+     * The views can be read or written, e.g. to load trained values or copy them into a FixedGRULayer. The
+     * weight views are empty in half-precision mode.
+     */
+    std::array<BasicMatrixView<T>, 9> getParameters() {
+        return {W_z.view(), W_r.view(), W_h.view(), U_z.view(), U_r.view(), U_h.view(),
+                b_z.view(), b_r.view(), b_h.view()};
+    }
 };
 
+using GRULayer = BasicGRULayer<double>;
+using GRULayerF = BasicGRULayer<float>;
+
+// Explicitly instantiated in GRULayer.cpp
+extern template class BasicGRULayer<double>;
+extern template class BasicGRULayer<float>;
+
 #endif // GRU_LAYER_H
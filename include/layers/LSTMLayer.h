@@ -3,6 +3,8 @@
 
 #include "StatefulLayer.h"
 #include "../activations/ActivationFunctions.h"
+#include <array>
+#include <vector>
 
 /**
  * @brief Long Short-Term Memory (LSTM) Layer.
@@ -12,33 +14,104 @@
  * 
  * More details: https://en.wikipedia.org/wiki/Long_short-term_memory
  */
-class LSTMLayer : public StatefulLayer {
+template <typename T>
+class BasicLSTMLayer : public BasicStatefulLayer<T> {
 private:
-    Matrix W_f, W_i, W_c, W_o; // Weights for forget, input, cell, output gates
-    Matrix U_f, U_i, U_c, U_o; // Recurrent weights
-    Matrix b_f, b_i, b_c, b_o; // Biases
-    Matrix hiddenState;
-    Matrix cellState; // Stores long-term memory
+    BasicMatrix<T> W_f, W_i, W_c, W_o; // Weights for forget, input, cell, output gates
+    BasicMatrix<T> U_f, U_i, U_c, U_o; // Recurrent weights
+    BasicMatrix<T> b_f, b_i, b_c, b_o; // Biases
+    BasicMatrix<T> hiddenState;
+    BasicMatrix<T> cellState; // Stores long-term memory
+    std::vector<QuantizedMatrix> quantizedWeights; // W_f, W_i, W_c, W_o, U_f, U_i, U_c, U_o transposed, when quantized
+    std::vector<HalfMatrix> halfWeights; // The same eight matrices, replacing them in half-precision mode
+
+    std::array<BasicMatrix<T>*, 8> weightMatrices() {
+        return {&W_f, &W_i, &W_c, &W_o, &U_f, &U_i, &U_c, &U_o};
+    }
 
 public:
-    // Constructor
-    LSTMLayer(size_t inputSize, size_t hiddenSize);
+    // Constructors (the weights are drawn from rng, or from Philox::global() if none is given)
+    BasicLSTMLayer(size_t inputSize, size_t hiddenSize);
+    BasicLSTMLayer(size_t inputSize, size_t hiddenSize, Philox& rng);
 
     // State Management
-    LSTMLayer& resetStates() override; // Resets hidden and cell states
+    BasicLSTMLayer& resetStates() override; // Resets hidden and cell states
 
     // Forward and Backward Propagation
-    Matrix forward(const Matrix& input) override;
-    Matrix backward(const Matrix& gradOutput) override;
+    BasicMatrix<T> forward(const BasicMatrix<T>& input) override;
+    BasicMatrix<T> backward(const BasicMatrix<T>& gradOutput) override;
+
+    // Quantized Inference
+    /**
+     * @brief Run the gate projections of forward() on int8 weights (post-training quantization).
+     * 
+     * Every input and recurrent weight matrix is quantized once, per hidden unit or per tensor; forward() then
+     * quantizes the input and hidden state once per step and shares them across the gates. The full-precision
+     * weights are kept, but backward() is unavailable until disableQuantization().
+     * 
+     * @param granularity Whether each hidden unit's weights get their own scale.
+     * @return A reference to the layer.
+     * @throws std::runtime_error If the weights are in half precision.
+     */
+    BasicLSTMLayer& enableQuantization(QuantizationGranularity granularity = QuantizationGranularity::PerRow);
+
+    /**
+     * @brief Return to full-precision weights.
+     */
+    BasicLSTMLayer& disableQuantization();
+
+    inline bool isQuantized() const {
+        return !quantizedWeights.empty();
+    }
+
+    // Half-Precision Inference
+    /**
+     * @brief Hold the eight weight matrices in 16 bits instead of full precision, for resident inference sessions.
+     * 
+     * The full-precision weights are released, so a double layer shrinks to a quarter of its size. forward() widens
+     * them block by block inside each gate product and accumulates in T; backward() throws in this mode.
+     * 
+     * @param format bfloat16 (the default) or IEEE float16.
+     * @return A reference to the layer.
+     * @throws std::runtime_error If the layer is quantized.
+     */
+    BasicLSTMLayer& enableHalfPrecision(HalfFormat format = HalfFormat::BFloat16);
+
+    /**
+     * @brief Widen the weights back to full precision (they keep the rounding of the 16-bit format).
+     */
+    BasicLSTMLayer& disableHalfPrecision();
+
+    inline bool isHalfPrecision() const {
+        return !halfWeights.empty();
+    }
 
     // Getters
-    inline Matrix getHiddenState() const {
+    inline BasicMatrix<T> getHiddenState() const {
         return hiddenState;
     }
 
-    inline Matrix getCellState() const {
+    inline BasicMatrix<T> getCellState() const {
         return cellState;
     }
+
+    /**
+     * @brief The weights and biases, in the order W_f, W_i, W_c, W_o, U_f, U_i, U_c, U_o, b_f, b_i, b_c, b_o.
+     * 
+     * The views can be read or written, e.g. to load trained values or copy them into a FixedLSTMLayer. The
+     * weight views are empty in half-precision mode.
+     */
+    std::array<BasicMatrixView<T>, 12> getParameters() {
+        return {W_f.view(), W_i.view(), W_c.view(), W_o.view(), U_f.view(), U_i.view(), U_c.view(), U_o.view(),
+                b_f.view(), b_i.view(), b_c.view(), b_o.view()};
+    }
 };
 
+using LSTMLayer = BasicLSTMLayer<double>;
+using LSTMLayerF = BasicLSTMLayer<float>;
+
+// Explicitly instantiated in LSTMLayer.cpp
+extern template class BasicLSTMLayer<double>;
+extern template class BasicLSTMLayer<float>;
+
 #endif // LSTMLAYER_H
@@ -11,19 +11,25 @@
  * 
  * This class defines the basic structure and functionalities of a neural network layer.
  * Each layer has weights, biases, and an activation function.
+ * 
+ * Layers are templates over the element type. Layer, DenseLayer, ... are the double versions and LayerF,
+ * DenseLayerF, ... the float ones, so a whole network can be trained or run in single precision.
+ * 
+ * @tparam T Element type, double or float.
  */
-class Layer {
+template <typename T>
+class BasicLayer {
 protected:
-    Matrix weights;
-    Matrix biases;
-    std::shared_ptr<ActivationFunction> activation;
-    Matrix inputCache;
+    BasicMatrix<T> weights;
+    BasicMatrix<T> biases;
+    std::shared_ptr<BasicActivationFunction<T>> activation;
+    BasicMatrix<T> inputCache;
 
 public:
     // Constructor and Destructor
-    Layer(size_t inputSize, size_t neurons, std::shared_ptr<ActivationFunction> activationFunc)
+    BasicLayer(size_t inputSize, size_t neurons, std::shared_ptr<BasicActivationFunction<T>> activationFunc)
         : weights(neurons, inputSize), biases(neurons, 1), activation(activationFunc), inputCache(inputSize, 1)  {}
-    virtual ~Layer() = default;
+    virtual ~BasicLayer() = default;
 
     // Forward and Backward Propagation
     /**
@@ -34,7 +40,7 @@ public:
      * @param input The input matrix.
      * @return The output matrix.
      */
-    virtual Matrix forward(const Matrix& input) = 0;
+    virtual BasicMatrix<T> forward(const BasicMatrix<T>& input) = 0;
 
     /**
      * @brief Perform the backward pass through the layer.
@@ -44,15 +50,22 @@ public:
      * @param gradient The gradient of the loss with respect to the layer's output.
      * @return The gradient of the loss with respect to the layer's input.
      */
-    virtual Matrix backward(const Matrix& gradient) = 0; 
+    virtual BasicMatrix<T> backward(const BasicMatrix<T>& gradient) = 0; 
 
     // Getters for weights and biases
-    const Matrix& getWeights() const;
-    const Matrix& getBiases() const;
+    const BasicMatrix<T>& getWeights() const;
+    const BasicMatrix<T>& getBiases() const;
 
     // Setters for weights and biases
-    Layer& setWeights(const Matrix& w);
-    Layer& setBiases(const Matrix& b);
+    BasicLayer& setWeights(const BasicMatrix<T>& w);
+    BasicLayer& setBiases(const BasicMatrix<T>& b);
 };
 
+using Layer = BasicLayer<double>;
+using LayerF = BasicLayer<float>;
+
+// Explicitly instantiated in Layer.cpp
+extern template class BasicLayer<double>;
+extern template class BasicLayer<float>;
+
 #endif // LAYER_H
\ No newline at end of file
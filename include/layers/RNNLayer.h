@@ -25,29 +25,38 @@
  * b - is the bias
  * h(t-1) - is the hidden state at time t-1
  */
-class RNNLayer : public StatefulLayer {
+template <typename T>
+class BasicRNNLayer : public BasicStatefulLayer<T> {
     private:
-        Matrix W_x, W_h, b, hiddenState;
+        BasicMatrix<T> W_x, W_h, b, hiddenState;
     
     public:
-        // Constructor
-        RNNLayer(size_t inputSize, size_t hiddenSize);
+        // Constructors (the weights are drawn from rng, or from Philox::global() if none is given)
+        BasicRNNLayer(size_t inputSize, size_t hiddenSize);
+        BasicRNNLayer(size_t inputSize, size_t hiddenSize, Philox& rng);
     
         // State Management
-        RNNLayer& resetStates() override {
+        BasicRNNLayer& resetStates() override {
             hiddenState.setData(0.0);
-            clearInputCache();  
+            this->clearInputCache();  
             return *this;
         }
     
         // Forward and Backward Propagation
-        Matrix forward(const Matrix& input) override;
-        Matrix backward(const Matrix& gradOutput) override;
+        BasicMatrix<T> forward(const BasicMatrix<T>& input) override;
+        BasicMatrix<T> backward(const BasicMatrix<T>& gradOutput) override;
 
         // Getters
-        inline Matrix getHiddenState() const {
+        inline BasicMatrix<T> getHiddenState() const {
             return hiddenState; 
         }
 };
 
+using RNNLayer = BasicRNNLayer<double>;
+using RNNLayerF = BasicRNNLayer<float>;
+
+// Explicitly instantiated in RNNLayer.cpp
+extern template class BasicRNNLayer<double>;
+extern template class BasicRNNLayer<float>;
+
 #endif
\ No newline at end of file
@@ -2,7 +2,9 @@
 #define STATEFUL_LAYER_H
 
 #include "Layer.h"
+#include "../matrix/HalfMatrix.h"
 #include "../matrix/Matrix.h"
+#include "../matrix/QuantizedMatrix.h"
 
 /**
  * @brief Abstract base class for stateful layers.
@@ -10,41 +12,117 @@
  * Stateful layers maintain an internal state that is updated during forward passes and used during backward passes.
  * Examples include RNN, LSTM, and GRU layers.
  */
-class StatefulLayer : public Layer {
+template <typename T>
+class BasicStatefulLayer : public BasicLayer<T> {
 protected:
-    Matrix inputCache;
+    BasicMatrix<T> inputCache;
 
 public:
     // Constructor and Destructor
-    StatefulLayer(size_t inputSize, size_t neurons, std::shared_ptr<ActivationFunction> activationFunc)
-        : Layer(inputSize, neurons, activationFunc), inputCache(inputSize, 1) {}
+    BasicStatefulLayer(size_t inputSize, size_t neurons, std::shared_ptr<BasicActivationFunction<T>> activationFunc)
+        : BasicLayer<T>(inputSize, neurons, activationFunc), inputCache(inputSize, 1) {}
 
-    virtual ~StatefulLayer() = default;
+    virtual ~BasicStatefulLayer() = default;
 
     // State Management
     /**
      * @brief Resets the internal state (must be implemented by derived classes).
      */
-    virtual StatefulLayer& resetStates() = 0;
+    virtual BasicStatefulLayer& resetStates() = 0;
 
     /**
      * @brief Clears inputCache (used in resetStates implementations).
      * @return Reference to the current object for chaining.
      */
-    StatefulLayer& clearInputCache() {
-        inputCache.setData(0.0);
+    BasicStatefulLayer& clearInputCache() {
+        inputCache.setData(T(0));
         return *this;
     }
 
+    /**
+     * @brief Compute a recurrent gate, activation(input * W + hidden * U + bias).
+     * 
+     * The recurrent product is written straight into the result and the input product accumulates onto it with
+     * the bias and activation fused in (see kernels::Epilogue), so the gate costs one allocation and no extra
+     * passes over its elements.
+     * 
+     * @param input The batch x inputSize input.
+     * @param W The inputSize x hiddenSize input weights.
+     * @param hidden The batch x hiddenSize previous hidden state.
+     * @param U The hiddenSize x hiddenSize recurrent weights.
+     * @param bias The 1 x hiddenSize bias row.
+     * @param activation The gate activation.
+     * @return The batch x hiddenSize gate values.
+     * @throws std::invalid_argument If the shapes do not match.
+     */
+    static BasicMatrix<T> gate(BasicMatrixView<const T> input, BasicMatrixView<const T> W,
+                               BasicMatrixView<const T> hidden, BasicMatrixView<const T> U,
+                               const BasicMatrix<T>& bias, const BasicActivationFunction<T>& activation) {
+        if (bias.getRows() != 1 || bias.getCols() != W.getCols()) {
+            throw std::invalid_argument("Gate bias must be a single row with one value per hidden unit.");
+        }
+        BasicMatrix<T> result(hidden.getRows(), U.getCols(), "gate");
+        kernels::gemm(T(1), hidden, U, T(0), result.view());
+        kernels::gemm(T(1), input, W, T(1), result.view(), activation.epilogue(nullptr, bias.view().getPointer()));
+        return result;
+    }
+
+    /**
+     * @brief gate() with 16-bit weights, widened a block at a time inside the products.
+     * 
+     * @throws std::invalid_argument If the shapes do not match.
+     */
+    static BasicMatrix<T> gate(BasicMatrixView<const T> input, const HalfMatrix& W, BasicMatrixView<const T> hidden,
+                               const HalfMatrix& U, const BasicMatrix<T>& bias,
+                               const BasicActivationFunction<T>& activation) {
+        if (bias.getRows() != 1 || bias.getCols() != W.getCols()) {
+            throw std::invalid_argument("Gate bias must be a single row with one value per hidden unit.");
+        }
+        BasicMatrix<T> result(hidden.getRows(), U.getCols(), "gate");
+        kernels::gemm(T(1), hidden, U, T(0), result.view());
+        kernels::gemm(T(1), input, W, T(1), result.view(), activation.epilogue(nullptr, bias.view().getPointer()));
+        return result;
+    }
+
+    /**
+     * @brief Quantized gate(): the same computation with int8 operands (see kernels::quantizedGemm()).
+     * 
+     * The weights are quantized transposed, one row per hidden unit, so that input and hidden state rows meet
+     * weight rows in the integer dot products.
+     * 
+     * @param input The batch x inputSize quantized input.
+     * @param W The hiddenSize x inputSize quantized transpose of the input weights.
+     * @param hidden The batch x hiddenSize quantized previous hidden state.
+     * @param U The hiddenSize x hiddenSize quantized transpose of the recurrent weights.
+     * @param bias The 1 x hiddenSize bias row.
+     * @param activation The gate activation.
+     * @return The batch x hiddenSize gate values.
+     * @throws std::invalid_argument If the shapes do not match.
+     */
+    static BasicMatrix<T> gate(const QuantizedMatrix& input, const QuantizedMatrix& W, const QuantizedMatrix& hidden,
+                               const QuantizedMatrix& U, const BasicMatrix<T>& bias,
+                               const BasicActivationFunction<T>& activation) {
+        if (bias.getRows() != 1 || bias.getCols() != W.getRows()) {
+            throw std::invalid_argument("Gate bias must be a single row with one value per hidden unit.");
+        }
+        BasicMatrix<T> result(hidden.getRows(), U.getRows(), "gate");
+        kernels::quantizedGemm(hidden, U, T(0), result.view());
+        kernels::quantizedGemm(input, W, T(1), result.view(), activation.epilogue(nullptr, bias.view().getPointer()));
+        return result;
+    }
+
     // Getters
     /**
      * @brief Getter for input cache.
      * 
      * @return The input cache matrix.
      */
-    const Matrix& getInputCache() const {
+    const BasicMatrix<T>& getInputCache() const {
         return inputCache;
     }
 };
 
+using StatefulLayer = BasicStatefulLayer<double>;
+using StatefulLayerF = BasicStatefulLayer<float>;
+
 #endif // STATEFUL_LAYER_H
@@ -0,0 +1,48 @@
+#ifndef ELEMENT_WISE_H
+#define ELEMENT_WISE_H
+
+#include <cstddef>
+
+namespace kernels {
+
+/**
+ * @brief Vectorized element-wise kernels over contiguous buffers.
+ *
+ * Each kernel processes n elements using AVX-512, AVX2 or SSE2 (chosen at runtime, see simd::activeLevel())
+ * with a scalar tail. The output may alias any of the inputs. Every kernel has a double and a float overload;
+ * the float versions process twice as many elements per instruction.
+ */
+
+/**
+ * @brief out[i] = a[i] + b[i]
+ */
+void add(size_t n, const double* a, const double* b, double* out);
+void add(size_t n, const float* a, const float* b, float* out);
+
+/**
+ * @brief out[i] = a[i] - b[i]
+ */
+void subtract(size_t n, const double* a, const double* b, double* out);
+void subtract(size_t n, const float* a, const float* b, float* out);
+
+/**
+ * @brief out[i] = a[i] * b[i] (Hadamard product)
+ */
+void multiply(size_t n, const double* a, const double* b, double* out);
+void multiply(size_t n, const float* a, const float* b, float* out);
+
+/**
+ * @brief out[i] = a[i] * scalar
+ */
+void scale(size_t n, const double* a, double scalar, double* out);
+void scale(size_t n, const float* a, float scalar, float* out);
+
+/**
+ * @brief y[i] += alpha * x[i] (BLAS axpy), updating y in place
+ */
+void axpy(size_t n, double alpha, const double* x, double* y);
+void axpy(size_t n, float alpha, const float* x, float* y);
+
+} // namespace kernels
+
+#endif // ELEMENT_WISE_H
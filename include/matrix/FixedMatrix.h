@@ -0,0 +1,287 @@
+#ifndef FIXED_MATRIX_H
+#define FIXED_MATRIX_H
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include "Matrix.h"
+#include "MatrixView.h"
+#include "Random.h"
+
+namespace fixed_detail {
+
+// Element-wise loops up to this many elements are unrolled completely; larger ones are left to the vectorizer
+inline constexpr size_t MAX_UNROLL = 64;
+
+template <size_t N, typename F, size_t... I>
+constexpr void unrollImpl(F&& f, std::index_sequence<I...>) {
+    (f(I), ...);
+}
+
+/**
+ * @brief Call f(i) for i in [0, N); fully unrolled at compile time for small N.
+ */
+template <size_t N, typename F>
+constexpr void unrolled(F&& f) {
+    if constexpr (N <= MAX_UNROLL) {
+        unrollImpl<N>(f, std::make_index_sequence<N>{});
+    } else {
+        for (size_t i = 0; i < N; ++i) {
+            f(i);
+        }
+    }
+}
+
+} // namespace fixed_detail
+
+/**
+ * @brief Matrix whose dimensions are compile-time constants.
+ *
+ * Elements live inline (no heap allocation) in row-major order, dimension checks happen at compile time, and the
+ * loops have constant trip counts so small shapes are fully unrolled. Intended for the per-step gate math of small
+ * recurrent layers, where allocating and bounds-checking a dynamic Matrix costs more than the arithmetic.
+ *
+ * Interoperates with Matrix through views: a FixedMatrix converts to a ConstView (so it can be passed to any
+ * Matrix operation or to kernels::gemm), and can be built from a Matrix or view of the same shape.
+ *
+ * @tparam T Element type, double or float.
+ * @tparam R Number of rows.
+ * @tparam C Number of columns.
+ */
+template <typename T, size_t R, size_t C>
+class BasicFixedMatrix {
+    static_assert(std::is_floating_point_v<T>, "FixedMatrix elements must be floating point.");
+    static_assert(R > 0 && C > 0, "FixedMatrix dimensions must be non-zero.");
+
+private:
+    std::array<T, R * C> data{};
+
+    // Bounds check for operator() and the checked builds of operator[]
+    static constexpr void checkIndices(size_t row, size_t col) {
+        if (row >= R || col >= C) {
+            throw std::out_of_range("FixedMatrix indices out of range.");
+        }
+    }
+
+public:
+    using value_type = T;
+    using View = BasicMatrixView<T>;
+    using ConstView = BasicMatrixView<const T>;
+
+    // Constructors
+    /**
+     * @brief Construct a zero-filled matrix.
+     */
+    constexpr BasicFixedMatrix() = default;
+
+    /**
+     * @brief Copy the elements of a matrix or view with the same shape.
+     *
+     * @param view The elements to copy (a Matrix converts implicitly).
+     * @throws std::invalid_argument if the shape differs from R x C.
+     */
+    explicit BasicFixedMatrix(ConstView view) {
+        if (view.getRows() != R || view.getCols() != C) {
+            throw std::invalid_argument("Matrix dimensions do not match fixed size.");
+        }
+        for (size_t i = 0; i < R; ++i) {
+            for (size_t j = 0; j < C; ++j) {
+                data[i * C + j] = view[i, j];
+            }
+        }
+    }
+
+    /**
+     * @brief A matrix with every element set to value.
+     */
+    static constexpr BasicFixedMatrix filled(T value) {
+        BasicFixedMatrix result;
+        result.setData(value);
+        return result;
+    }
+
+    // Getters
+    static constexpr size_t getRows() { return R; }
+    static constexpr size_t getCols() { return C; }
+    static constexpr size_t size() { return R * C; }
+    constexpr T* getPointer() { return data.data(); }
+    constexpr const T* getPointer() const { return data.data(); }
+
+    // Element Access
+    /**
+     * @brief Access an element with bounds checking.
+     *
+     * @throws std::out_of_range If the indices are out of range.
+     */
+    constexpr T& operator()(size_t row, size_t col) {
+        checkIndices(row, col);
+        return data[row * C + col];
+    }
+
+    constexpr const T& operator()(size_t row, size_t col) const {
+        checkIndices(row, col);
+        return data[row * C + col];
+    }
+
+    /**
+     * @brief Access an element without bounds checking, for hot loops.
+     *
+     * As for Matrix, the indices are only verified in checked builds (debug builds, or with MATRIX_CHECKED defined).
+     */
+    constexpr T& operator[](size_t row, size_t col) {
+#ifdef MATRIX_CHECKED
+        checkIndices(row, col);
+#endif
+        return data[row * C + col];
+    }
+
+    constexpr const T& operator[](size_t row, size_t col) const {
+#ifdef MATRIX_CHECKED
+        checkIndices(row, col);
+#endif
+        return data[row * C + col];
+    }
+
+    /**
+     * @brief Access an element whose indices are checked at compile time.
+     */
+    template <size_t I, size_t J>
+    constexpr T& get() {
+        static_assert(I < R && J < C, "FixedMatrix index out of range.");
+        return data[I * C + J];
+    }
+
+    template <size_t I, size_t J>
+    constexpr const T& get() const {
+        static_assert(I < R && J < C, "FixedMatrix index out of range.");
+        return data[I * C + J];
+    }
+
+    // Interoperation with Matrix
+    View view() { return View(data.data(), R, C, C); }
+    ConstView view() const { return ConstView(data.data(), R, C, C); }
+    operator ConstView() const { return view(); }
+
+    /**
+     * @brief Copy into a heap-allocated Matrix.
+     */
+    BasicMatrix<T> toMatrix(const std::string& name = "UNNAMED") const {
+        return BasicMatrix<T>(view(), name);
+    }
+
+    // Setters
+    constexpr BasicFixedMatrix& setData(T value) {
+        fixed_detail::unrolled<R * C>([&](size_t i) { data[i] = value; });
+        return *this;
+    }
+
+    /**
+     * @brief Fill with uniformly distributed values in [min, max), drawn from Philox::global().
+     */
+    BasicFixedMatrix& randomize(T min = T(0), T max = T(1)) {
+        return randomize(Philox::global(), min, max);
+    }
+
+    /**
+     * @brief Fill with uniformly distributed values in [min, max), drawn from the given generator.
+     */
+    BasicFixedMatrix& randomize(Philox& rng, T min = T(0), T max = T(1)) {
+        rng.fillUniform(data.data(), R * C, min, max);
+        return *this;
+    }
+
+    // Element-wise Operations
+    /**
+     * @brief Apply func to every element; func is a template parameter so it is inlined.
+     */
+    template <typename F>
+    constexpr BasicFixedMatrix applyFunction(F&& func) const {
+        BasicFixedMatrix result;
+        fixed_detail::unrolled<R * C>([&](size_t i) { result.data[i] = func(data[i]); });
+        return result;
+    }
+
+    constexpr BasicFixedMatrix& operator+=(const BasicFixedMatrix& other) {
+        fixed_detail::unrolled<R * C>([&](size_t i) { data[i] += other.data[i]; });
+        return *this;
+    }
+
+    constexpr BasicFixedMatrix& operator-=(const BasicFixedMatrix& other) {
+        fixed_detail::unrolled<R * C>([&](size_t i) { data[i] -= other.data[i]; });
+        return *this;
+    }
+
+    constexpr BasicFixedMatrix& operator*=(const BasicFixedMatrix& other) {
+        fixed_detail::unrolled<R * C>([&](size_t i) { data[i] *= other.data[i]; });
+        return *this;
+    }
+
+    constexpr BasicFixedMatrix& operator*=(T scalar) {
+        fixed_detail::unrolled<R * C>([&](size_t i) { data[i] *= scalar; });
+        return *this;
+    }
+
+    /**
+     * @brief this += alpha * x, updating in place.
+     */
+    constexpr BasicFixedMatrix& axpy(T alpha, const BasicFixedMatrix& x) {
+        fixed_detail::unrolled<R * C>([&](size_t i) { data[i] += alpha * x.data[i]; });
+        return *this;
+    }
+
+    friend constexpr BasicFixedMatrix operator+(BasicFixedMatrix a, const BasicFixedMatrix& b) { return a += b; }
+    friend constexpr BasicFixedMatrix operator-(BasicFixedMatrix a, const BasicFixedMatrix& b) { return a -= b; }
+    friend constexpr BasicFixedMatrix operator*(BasicFixedMatrix a, const BasicFixedMatrix& b) { return a *= b; }
+    friend constexpr BasicFixedMatrix operator*(BasicFixedMatrix a, T scalar) { return a *= scalar; }
+    friend constexpr BasicFixedMatrix operator*(T scalar, BasicFixedMatrix a) { return a *= scalar; }
+
+    friend constexpr BasicFixedMatrix operator-(T scalar, const BasicFixedMatrix& a) {
+        return a.applyFunction([scalar](T x) { return scalar - x; });
+    }
+
+    friend constexpr bool operator==(const BasicFixedMatrix& a, const BasicFixedMatrix& b) {
+        return a.data == b.data;
+    }
+
+    // Matrix Operations
+    /**
+     * @brief Matrix product with a C x K matrix; inner dimensions are checked at compile time.
+     */
+    template <size_t K>
+    constexpr BasicFixedMatrix<T, R, K> multiply(const BasicFixedMatrix<T, C, K>& other) const {
+        BasicFixedMatrix<T, R, K> result;
+        for (size_t i = 0; i < R; ++i) {
+            T* out = result.getPointer() + i * K;
+            for (size_t k = 0; k < C; ++k) {
+                const T a = data[i * C + k];
+                const T* b = other.getPointer() + k * K;
+                fixed_detail::unrolled<K>([&](size_t j) { out[j] += a * b[j]; });
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief The C x R transpose.
+     */
+    constexpr BasicFixedMatrix<T, C, R> transpose() const {
+        BasicFixedMatrix<T, C, R> result;
+        for (size_t i = 0; i < R; ++i) {
+            for (size_t j = 0; j < C; ++j) {
+                result[j, i] = data[i * C + j];
+            }
+        }
+        return result;
+    }
+};
+
+template <size_t R, size_t C>
+using FixedMatrix = BasicFixedMatrix<double, R, C>;
+
+template <size_t R, size_t C>
+using FixedMatrixF = BasicFixedMatrix<float, R, C>;
+
+#endif // FIXED_MATRIX_H
@@ -0,0 +1,227 @@
+#ifndef GEMM_H
+#define GEMM_H
+
+#include "MatrixView.h"
+#include <cstddef>
+
+namespace kernels {
+
+/**
+ * @brief Whether a gemm() operand is used as stored or transposed (BLAS `transa` / `transb`).
+ */
+enum class Transpose : bool {
+    No,
+    Yes
+};
+
+/**
+ * @brief General matrix-matrix multiplication: C = alpha * A * B + beta * C.
+ *
+ * All matrices are row-major with the given leading dimensions (distance in elements between consecutive rows).
+ * A is M x K, B is K x N and C is M x N. When beta is zero, C is write-only and its previous contents are ignored.
+ *
+ * Large products are computed with a packed, cache-blocked algorithm: B is packed into L3-sized panels, A into
+ * L2-sized blocks, and a register-tiled micro-kernel (AVX-512, AVX2/FMA, SSE2 or scalar, chosen at runtime)
+ * accumulates each small tile of C entirely in registers. Small products skip packing.
+ *
+ * Products with at least getGemmParallelThreshold() multiply-adds are split across ThreadPool::global().
+ *
+ * @param M Number of rows of A and C.
+ * @param N Number of columns of B and C.
+ * @param K Number of columns of A and rows of B.
+ * @param alpha Scale applied to A * B.
+ * @param A Pointer to the first element of A.
+ * @param lda Leading dimension of A.
+ * @param B Pointer to the first element of B.
+ * @param ldb Leading dimension of B.
+ * @param beta Scale applied to the previous contents of C.
+ * @param C Pointer to the first element of C.
+ * @param ldc Leading dimension of C.
+ */
+void gemm(size_t M, size_t N, size_t K,
+          double alpha, const double* A, size_t lda,
+          const double* B, size_t ldb,
+          double beta, double* C, size_t ldc);
+
+/**
+ * @brief Single-precision gemm. Float micro-kernels use twice as many lanes per register as the double ones.
+ */
+void gemm(size_t M, size_t N, size_t K,
+          float alpha, const float* A, size_t lda,
+          const float* B, size_t ldb,
+          float beta, float* C, size_t ldc);
+
+/**
+ * @brief BLAS-style gemm with transpose flags: C = alpha * op(A) * op(B) + beta * C.
+ *
+ * op(X) is X or its transpose. Transposed operands are read in their stored layout (the packing step absorbs
+ * the swapped strides), so no transposed copy is ever made. op(A) is M x K and op(B) is K x N; when transA is
+ * Transpose::Yes, A is stored as K x M with leading dimension lda, and likewise for B.
+ *
+ * @param transA Whether to use A or its transpose.
+ * @param transB Whether to use B or its transpose.
+ * @param M Number of rows of op(A) and C.
+ * @param N Number of columns of op(B) and C.
+ * @param K Number of columns of op(A) and rows of op(B).
+ * @param alpha Scale applied to op(A) * op(B).
+ * @param A Pointer to the first element of A.
+ * @param lda Leading dimension of A as stored.
+ * @param B Pointer to the first element of B.
+ * @param ldb Leading dimension of B as stored.
+ * @param beta Scale applied to the previous contents of C.
+ * @param C Pointer to the first element of C.
+ * @param ldc Leading dimension of C.
+ */
+void gemm(Transpose transA, Transpose transB, size_t M, size_t N, size_t K,
+          double alpha, const double* A, size_t lda,
+          const double* B, size_t ldb,
+          double beta, double* C, size_t ldc);
+void gemm(Transpose transA, Transpose transB, size_t M, size_t N, size_t K,
+          float alpha, const float* A, size_t lda,
+          const float* B, size_t ldb,
+          float beta, float* C, size_t ldc);
+
+/**
+ * @brief General matrix-matrix multiplication on views: C = alpha * A * B + beta * C.
+ *
+ * A and B may have any row and column strides, so blocks, row ranges and transposed views are multiplied
+ * without being copied first (the strides are absorbed while packing). C is written in place through its view;
+ * a C with non-unit column stride goes through a scratch buffer.
+ *
+ * @param alpha Scale applied to A * B.
+ * @param A The M x K left operand.
+ * @param B The K x N right operand.
+ * @param beta Scale applied to the previous contents of C.
+ * @param C The M x N destination.
+ * @throws std::invalid_argument If the shapes do not match.
+ */
+void gemm(double alpha, ConstMatrixView A, ConstMatrixView B, double beta, MatrixView C);
+void gemm(float alpha, ConstMatrixViewF A, ConstMatrixViewF B, float beta, MatrixViewF C);
+
+/**
+ * @brief gemm() on views with transpose flags: C = alpha * op(A) * op(B) + beta * C.
+ *
+ * Equivalent to passing A.transpose() / B.transpose(), spelled the BLAS way.
+ *
+ * @throws std::invalid_argument If the shapes do not match.
+ */
+void gemm(Transpose transA, Transpose transB, double alpha, ConstMatrixView A, ConstMatrixView B,
+          double beta, MatrixView C);
+void gemm(Transpose transA, Transpose transB, float alpha, ConstMatrixViewF A, ConstMatrixViewF B,
+          float beta, MatrixViewF C);
+
+/**
+ * @brief Work fused into gemm() and run on each tile of C as soon as its final value has been computed.
+ *
+ * Adding a bias and applying an activation inside the product avoids two further passes over C (and the
+ * temporaries that go with them): each tile is still in registers or L1 when the epilogue runs.
+ * The steps run in order: C(i, j) += rowBias[i] + colBias[j], then activation(context, tile).
+ *
+ * @tparam T Element type, double or float.
+ */
+template <typename T>
+struct Epilogue {
+    const T* rowBias = nullptr;  // M values, one per row of C (e.g. the biases of a DenseLayer), or nullptr
+    const T* colBias = nullptr;  // N values, one per column of C (e.g. a 1 x hidden gate bias), or nullptr
+
+    // Called on disjoint tiles of C, possibly from several threads at once; nullptr for no activation
+    void (*activation)(const void* context, BasicMatrixView<T> tile) = nullptr;
+    const void* context = nullptr;
+};
+
+/**
+ * @brief gemm() on views followed by a fused epilogue: C = epilogue(alpha * A * B + beta * C).
+ *
+ * @param alpha Scale applied to A * B.
+ * @param A The M x K left operand.
+ * @param B The K x N right operand.
+ * @param beta Scale applied to the previous contents of C.
+ * @param C The M x N destination.
+ * @param epilogue Biases and activation applied to each finished tile of C.
+ * @throws std::invalid_argument If the shapes do not match.
+ */
+void gemm(double alpha, ConstMatrixView A, ConstMatrixView B, double beta, MatrixView C,
+          const Epilogue<double>& epilogue);
+void gemm(float alpha, ConstMatrixViewF A, ConstMatrixViewF B, float beta, MatrixViewF C,
+          const Epilogue<float>& epilogue);
+
+/**
+ * @brief How a matrix product is computed.
+ */
+enum class GemmAlgorithm {
+    Blocked,   ///< The packed, cache-blocked kernel: M * N * K multiply-adds, error bounded element by element.
+    Strassen,  ///< Strassen-Winograd recursion down to getStrassenCutoff(): fewer operations, weaker error bound.
+    Auto       ///< Strassen for large, roughly square products (see strassenPays()), Blocked otherwise.
+};
+
+/**
+ * @brief gemm() on views with a choice of algorithm: C = alpha * A * B + beta * C.
+ *
+ * The Strassen-Winograd recursion splits each operand into 2 x 2 blocks and forms the product from 7 block
+ * products and 15 block additions instead of 8 products, recursing until the smallest dimension is at most
+ * getStrassenCutoff(), where the blocked kernel takes over (odd dimensions are peeled off and handled by the
+ * blocked kernel as thin products). l levels cut the multiply-adds by (7/8)^l, at the cost of two scratch
+ * blocks per level (about a third of the size of C, A and B combined over all levels) and of extra additions
+ * that only pay off for large blocks.
+ *
+ * The error bound is normwise rather than element by element. Where the blocked kernel satisfies
+ * |C - Ĉ| <= K u |A| |B| for each element (u the unit roundoff), Strassen-Winograd with n x n operands and
+ * leaf size n0 only guarantees max|C - Ĉ| <= ((n / n0)^log2(18) (n0² + 6 n0) - 6 n) u max|A| max|B|
+ * (Higham, Accuracy and Stability of Numerical Algorithms, 2nd ed., ch. 23): each level multiplies the
+ * worst-case error by up to 4.5 instead of 2, and elements much smaller than max|A| max|B| can lose all their
+ * relative accuracy. Use it for large, well-scaled products where that is acceptable, e.g. offline scoring;
+ * it is never chosen unless asked for.
+ *
+ * @param algorithm The algorithm; Blocked is the same as the gemm() overload without one.
+ * @param alpha Scale applied to A * B.
+ * @param A The M x K left operand.
+ * @param B The K x N right operand.
+ * @param beta Scale applied to the previous contents of C.
+ * @param C The M x N destination, which must not overlap A or B.
+ * @throws std::invalid_argument If the shapes do not match.
+ */
+void gemm(GemmAlgorithm algorithm, double alpha, ConstMatrixView A, ConstMatrixView B, double beta, MatrixView C);
+void gemm(GemmAlgorithm algorithm, float alpha, ConstMatrixViewF A, ConstMatrixViewF B, float beta, MatrixViewF C);
+
+/**
+ * @brief Whether GemmAlgorithm::Auto uses Strassen-Winograd for an M x K by K x N product.
+ *
+ * True when at least one level of recursion is possible (every dimension at least twice the cutoff) and the
+ * product is roughly square (no dimension more than four times another), so that the saved multiply-adds
+ * outweigh the additions and scratch traffic.
+ */
+bool strassenPays(size_t M, size_t N, size_t K);
+
+/**
+ * @brief Set the dimension at or below which the Strassen-Winograd recursion switches to the blocked kernel.
+ *
+ * The best value depends on the machine; it should be large enough that the blocked kernel runs near its peak.
+ *
+ * @param size The new cutoff; values below 16 are raised to 16.
+ */
+void setStrassenCutoff(size_t size);
+
+/**
+ * @brief Get the dimension at or below which the Strassen-Winograd recursion switches to the blocked kernel.
+ *
+ * @return The current cutoff.
+ */
+size_t getStrassenCutoff();
+
+/**
+ * @brief Set the minimum product size (M * N * K multiply-adds) at which gemm() uses the global thread pool.
+ *
+ * @param work The new threshold.
+ */
+void setGemmParallelThreshold(size_t work);
+
+/**
+ * @brief Get the minimum product size at which gemm() uses the global thread pool.
+ *
+ * @return The current threshold.
+ */
+size_t getGemmParallelThreshold();
+
+} // namespace kernels
+
+#endif // GEMM_H
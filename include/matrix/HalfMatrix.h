@@ -0,0 +1,136 @@
+#ifndef HALF_MATRIX_H
+#define HALF_MATRIX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Gemm.h"
+#include "Matrix.h"
+#include "MatrixView.h"
+
+/**
+ * @brief 16-bit floating-point storage formats.
+ */
+enum class HalfFormat {
+    BFloat16,  ///< The top half of a float: same range, 8 significant bits. Safe for weights of any magnitude.
+    Float16    ///< IEEE 754 binary16: 11 significant bits, but values beyond 65504 overflow to infinity.
+};
+
+namespace kernels {
+
+/**
+ * @brief Convert n values to 16-bit storage, rounding to nearest (ties to even).
+ *
+ * Float16 uses the F16C instructions when the active level is AVX2 or above; both formats keep infinities and NaNs.
+ * Doubles are rounded to float first.
+ */
+void narrow(size_t n, const float* in, uint16_t* out, HalfFormat format);
+void narrow(size_t n, const double* in, uint16_t* out, HalfFormat format);
+
+/**
+ * @brief Convert n 16-bit values back to float or double (exact).
+ */
+void widen(size_t n, const uint16_t* in, float* out, HalfFormat format);
+void widen(size_t n, const uint16_t* in, double* out, HalfFormat format);
+
+} // namespace kernels
+
+/**
+ * @brief Row-major matrix stored in 16-bit floating point, for weights that are read far more often than written.
+ *
+ * Half the bytes of a float matrix and a quarter of a double one. There is no arithmetic in 16 bits: the gemm()
+ * overloads below widen a cache-sized block at a time and run the ordinary kernel on it, so memory holds and
+ * streams 16-bit values while the products accumulate in the element type of the other operands.
+ */
+class HalfMatrix {
+private:
+    size_t rows;
+    size_t cols;
+    HalfFormat format;
+    std::vector<uint16_t> data;
+
+    template <typename T>
+    void narrowFrom(BasicMatrixView<const T> values);
+
+public:
+    /**
+     * @brief Construct an empty (0 x 0) matrix.
+     */
+    HalfMatrix();
+
+    /**
+     * @brief Round a matrix or view to 16 bits.
+     *
+     * @param values The values to store (may be strided or transposed).
+     * @param format The storage format.
+     */
+    explicit HalfMatrix(ConstMatrixView values, HalfFormat format = HalfFormat::BFloat16);
+    explicit HalfMatrix(ConstMatrixViewF values, HalfFormat format = HalfFormat::BFloat16);
+
+    // Getters
+    inline size_t getRows() const { return rows; }
+    inline size_t getCols() const { return cols; }
+    inline HalfFormat getFormat() const { return format; }
+    inline const uint16_t* rowData(size_t row) const { return data.data() + row * cols; }
+
+    /**
+     * @brief Value of an element.
+     *
+     * @throws std::out_of_range If the indices are out of range.
+     */
+    float operator()(size_t row, size_t col) const;
+
+    /**
+     * @brief Number of bytes taken by the elements.
+     */
+    inline size_t getStorageBytes() const { return data.size() * sizeof(uint16_t); }
+
+    /**
+     * @brief Widen rows [first, first + count) into a row-major buffer of count x getCols() elements.
+     */
+    void widenRows(size_t first, size_t count, double* out) const;
+    void widenRows(size_t first, size_t count, float* out) const;
+
+    /**
+     * @brief The widened matrix.
+     */
+    template <typename T>
+    BasicMatrix<T> toMatrix(const std::string& name = "UNNAMED") const;
+};
+
+// Explicitly instantiated in HalfMatrix.cpp
+extern template BasicMatrix<double> HalfMatrix::toMatrix<double>(const std::string& name) const;
+extern template BasicMatrix<float> HalfMatrix::toMatrix<float>(const std::string& name) const;
+
+namespace kernels {
+
+/**
+ * @brief gemm() with a 16-bit left operand: C = epilogue(alpha * A * B + beta * C).
+ *
+ * Blocks of rows of A are widened into a workspace buffer of about 256 KB and multiplied as they are, so A is
+ * read from memory at 16 bits per element (the usual case of weights times a batch of inputs).
+ *
+ * @throws std::invalid_argument If the shapes do not match.
+ */
+void gemm(double alpha, const HalfMatrix& A, ConstMatrixView B, double beta, MatrixView C,
+          const Epilogue<double>& epilogue = {});
+void gemm(float alpha, const HalfMatrix& A, ConstMatrixViewF B, float beta, MatrixViewF C,
+          const Epilogue<float>& epilogue = {});
+
+/**
+ * @brief gemm() with a 16-bit right operand: C = epilogue(alpha * A * B + beta * C).
+ *
+ * Blocks of rows of B (slices of the shared dimension) are widened in turn and accumulated into C, with the
+ * epilogue on the last one (inputs times weights, as in a recurrent gate).
+ *
+ * @throws std::invalid_argument If the shapes do not match.
+ */
+void gemm(double alpha, ConstMatrixView A, const HalfMatrix& B, double beta, MatrixView C,
+          const Epilogue<double>& epilogue = {});
+void gemm(float alpha, ConstMatrixViewF A, const HalfMatrix& B, float beta, MatrixViewF C,
+          const Epilogue<float>& epilogue = {});
+
+} // namespace kernels
+
+#endif // HALF_MATRIX_H
@@ -1,6 +1,7 @@
 #ifndef MATRIX_H
 #define MATRIX_H
 
+#include <algorithm>
 #include <cmath>
 #include <compare>
 #include <functional>
@@ -11,20 +12,95 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
+#include "Gemm.h"
+#include "MatrixExpression.h"
+#include "MatrixView.h"
+#include "Random.h"
+#include "Reduce.h"
+#include "Transpose.h"
+#include "Workspace.h"
 
 /**
  * @brief Matrix class for handling matrix operations.
  * 
  * This class provides the basic functionalities needed to implement layers in a neural network.
  * It supports various matrix operations such as addition, subtraction, multiplication, and transposition.
+ * 
+ * The element type is a template parameter: use Matrix (double) by default, or MatrixF (float) to halve the
+ * memory footprint and double the SIMD width. Both are explicitly instantiated in Matrix.cpp.
+ * 
+ * A matrix allocates its buffer from Workspace::current(): the heap by default, or the active workspace inside a
+ * WorkspaceScope, which makes the temporaries of a forward/backward step free to allocate and release.
+ * 
+ * @tparam T Element type, double or float.
  */
-class Matrix {
+template <typename T>
+class BasicMatrix {
+public:
+    using value_type = T;
+    using View = BasicMatrixView<T>;
+    using ConstView = BasicMatrixView<const T>;
+    using iterator = T*;
+    using const_iterator = const T*;
+
 private:
     std::string name;
     size_t rows;
     size_t cols;
-    std::vector<std::vector<double>> data; 
+    size_t stride;              // Leading dimension: distance (in elements) between the starts of consecutive rows
+    std::pmr::vector<T> data;   // Single row-major buffer holding all elements (see Workspace)
+
+    // Pointer to the first element of a row (no bounds checking)
+    inline T* rowPtr(size_t row) {
+        return data.data() + row * stride;
+    }
+
+    inline const T* rowPtr(size_t row) const {
+        return data.data() + row * stride;
+    }
+
+    // Bounds checks for the checked builds of operator[] and rowData()
+    inline void checkIndices(size_t row, size_t col) const {
+        if (row >= rows || col >= cols) {
+            throw std::out_of_range("Matrix indices out of range.");
+        }
+    }
+
+    inline void checkRow(size_t row) const {
+        if (row >= rows) {
+            throw std::out_of_range("Matrix row index out of range.");
+        }
+    }
+
+    // Evaluates an expression of this matrix's shape into its buffer. An expression that reads this matrix at
+    // other positions than the ones being written (e.g. `m - m.view().row(0)`) goes through a scratch buffer.
+    template <MatrixExpression E>
+    void evaluateInPlace(const E& expression) {
+        if (!expression.aliases(data.data(), data.data() + data.size(), stride, true)) {
+            expression_detail::evaluate(expression, data.data(), stride);
+            return;
+        }
+        std::pmr::vector<T> result(rows * cols, Workspace::current());
+        expression_detail::evaluate(expression, result.data(), cols);
+        for (size_t i = 0; i < rows; ++i) {
+            std::copy_n(result.data() + i * cols, cols, rowPtr(i));
+        }
+    }
+
+    // Compound assignment evaluates in place, so the expression may broadcast its operand but not this matrix
+    template <MatrixExpression E>
+    BasicMatrix& assignInPlace(const E& expression) {
+        if (expression.getRows() != rows || expression.getCols() != cols) {
+            throw std::invalid_argument("Compound assignment cannot change the shape of the matrix.");
+        }
+        evaluateInPlace(expression);
+        return *this;
+    }
+
+    template <typename U>
+    friend class BasicMatrix;
 
 public:
     // Constructors and Destructor
@@ -35,19 +111,61 @@ public:
      * @param cols Number of columns.
      * @param name Name of the matrix (optional).
      */
-    Matrix(size_t rows, size_t cols, const std::string& name = "UNNAMED");
+    BasicMatrix(size_t rows, size_t cols, const std::string& name = "UNNAMED");
 
     /**
      * @brief Copy constructor.
      * 
      * @param other The matrix to copy.
      */
-    Matrix(const Matrix& other); // Copy constructor
+    BasicMatrix(const BasicMatrix& other); // Copy constructor
+
+    /**
+     * @brief Move constructor.
+     * 
+     * Takes over the buffer of `other`, which is left as an empty 0 x 0 matrix.
+     * 
+     * @param other The matrix to move from.
+     */
+    BasicMatrix(BasicMatrix&& other) noexcept;
+
+    /**
+     * @brief Construct a matrix by evaluating an expression in a single pass.
+     * 
+     * @param expression The expression to evaluate (see MatrixExpression.h).
+     * @param name Name of the matrix (optional).
+     */
+    template <MatrixExpression E>
+    BasicMatrix(const E& expression, const std::string& name = "Result");
+
+    /**
+     * @brief Construct a matrix by copying the elements of a view.
+     * 
+     * @param view The view to copy (may be strided or transposed).
+     * @param name Name of the matrix (optional).
+     */
+    explicit BasicMatrix(ConstView view, const std::string& name = "UNNAMED");
+
+    BasicMatrix& operator=(const BasicMatrix& other) = default;
+
+    /**
+     * @brief Move assignment.
+     * 
+     * Takes over the buffer of `other`, which is left as an empty 0 x 0 matrix. If the two matrices allocate from
+     * different sources (see Workspace) the elements are copied into this matrix's own storage instead, so a
+     * long-lived matrix never ends up pointing into a workspace. That copy allocates, so unlike the move
+     * constructor this is not noexcept.
+     * 
+     * @param other The matrix to move from.
+     * @return A reference to the matrix.
+     * @throws std::bad_alloc If the elements are copied and the allocation fails.
+     */
+    BasicMatrix& operator=(BasicMatrix&& other);
 
     /**
      * @brief Destroy the Matrix object.
      */
-    ~Matrix() = default;
+    ~BasicMatrix() = default;
 
     // Getters
     inline size_t getRows() const {
@@ -58,17 +176,113 @@ public:
         return cols;
     }
 
-    inline const std::vector<std::vector<double>>& getData() const {
-        return data;
+    inline size_t getStride() const {
+        return stride;
+    }
+
+    /**
+     * @brief Get the underlying row-major buffer.
+     * 
+     * Element (i, j) is located at index i * getStride() + j.
+     * 
+     * @return A span over all elements of the matrix.
+     */
+    inline std::span<const T> getData() const {
+        return std::span<const T>(data);
     }
 
     inline std::string getName() const {
         return name;
     }
 
-    std::span<const double> getRow(size_t row) const;
-    std::span<const double> getCol(size_t col) const;
-    
+    /**
+     * @brief Get a row of the matrix without copying.
+     * 
+     * @param row The row index.
+     * @return A span over the row inside the matrix buffer.
+     */
+    std::span<const T> getRow(size_t row) const;
+
+    /**
+     * @brief Get a column of the matrix without copying.
+     * 
+     * @param col The column index.
+     * @return A rows x 1 view whose row stride steps down the column.
+     */
+    ConstView getCol(size_t col) const;
+
+    // Views
+    /**
+     * @brief Get a view of the whole matrix.
+     * 
+     * Views are invalidated when the matrix is resized or moved from.
+     * 
+     * @return A view sharing this matrix's elements.
+     */
+    inline View view() {
+        return View(data.data(), rows, cols, stride);
+    }
+
+    inline ConstView view() const {
+        return ConstView(data.data(), rows, cols, stride);
+    }
+
+    /**
+     * @brief Matrices can be passed wherever a read-only view is expected.
+     */
+    inline operator ConstView() const {
+        return view();
+    }
+
+    /**
+     * @brief Non-const matrices can be passed wherever a mutable view is expected, e.g. as the output of addInto().
+     */
+    inline operator View() {
+        return view();
+    }
+
+    /**
+     * @brief Get a rectangular block of the matrix without copying.
+     * 
+     * @param row First row of the block.
+     * @param col First column of the block.
+     * @param blockRows Number of rows in the block.
+     * @param blockCols Number of columns in the block.
+     * @return A view of the block.
+     */
+    inline View block(size_t row, size_t col, size_t blockRows, size_t blockCols) {
+        return view().block(row, col, blockRows, blockCols);
+    }
+
+    inline ConstView block(size_t row, size_t col, size_t blockRows, size_t blockCols) const {
+        return view().block(row, col, blockRows, blockCols);
+    }
+
+    /**
+     * @brief Get rows [begin, end) without copying, e.g. one mini-batch of a dataset.
+     * 
+     * @param begin First row.
+     * @param end One past the last row.
+     * @return A view of the rows.
+     */
+    inline View rowRange(size_t begin, size_t end) {
+        return view().rowRange(begin, end);
+    }
+
+    inline ConstView rowRange(size_t begin, size_t end) const {
+        return view().rowRange(begin, end);
+    }
+
+    // Conversion
+    /**
+     * @brief Convert to another element type (e.g. double weights to float for inference).
+     * 
+     * @tparam U The target element type.
+     * @return A copy of the matrix with every element converted.
+     */
+    template <typename U>
+    BasicMatrix<U> cast() const;
+
 
     // Setters
     /**
@@ -76,7 +290,7 @@ public:
      * 
      * @param name The new name.
      */
-    inline Matrix& setName(const std::string& name) {
+    inline BasicMatrix& setName(const std::string& name) {
         this->name = name;
         return *this;
     }
@@ -87,7 +301,7 @@ public:
      * @param newData The new data.
      * @return A reference to the matrix.
      */
-    Matrix& setData(const std::vector<std::vector<double>>& newData);
+    BasicMatrix& setData(const std::vector<std::vector<T>>& newData);
 
     /**
      * @brief Set all elements of the matrix to a specific value.
@@ -95,28 +309,42 @@ public:
      * @param value The value to set.
      * @return A reference to the matrix.
      */
-    Matrix& setData(double value);
+    BasicMatrix& setData(T value);
 
     // Utility Methods
     /**
      * @brief Fill the matrix by hand (from console input).
      */
-    Matrix& fillByHand();
+    BasicMatrix& fillByHand();
 
     /**
      * @brief Print the matrix to the console.
      * 
      * This method prints the matrix along with its name to the console.
      */
-    Matrix& print() const;
+    BasicMatrix& print() const;
 
     /**
      * @brief Randomize the matrix elements within a given range.
      * 
+     * Draws from Philox::global(); seed it to make the values reproducible.
+     * 
      * @param min Minimum value.
      * @param max Maximum value.
      */
-    Matrix& randomize(double min = 0.0, double max = 1.0);
+    BasicMatrix& randomize(T min = T(0), T max = T(1));
+
+    /**
+     * @brief Randomize the matrix elements within a given range, drawing from the given generator.
+     * 
+     * The values only depend on the generator's seed, stream and position, not on the number of threads that
+     * fill the matrix.
+     * 
+     * @param rng The generator.
+     * @param min Minimum value.
+     * @param max Maximum value.
+     */
+    BasicMatrix& randomize(Philox& rng, T min = T(0), T max = T(1));
 
     /**
      * @brief Apply a function to each element of the matrix.
@@ -124,7 +352,7 @@ public:
      * @param func The function to apply.
      * @return A new matrix with the function applied.
      */
-    Matrix applyFunction(const std::function<double(double)>& func) const;
+    BasicMatrix applyFunction(const std::function<T(T)>& func) const;
 
     /**
      * @brief Create an identity matrix.
@@ -133,7 +361,7 @@ public:
      * @param name The name of the matrix (optional).
      * @return The identity matrix.
      */
-    static Matrix createIdentityMatrix(size_t size, const std::string& name = "UNNAMED");
+    static BasicMatrix createIdentityMatrix(size_t size, const std::string& name = "UNNAMED");
 
     /**
      * @brief Check if the matrix is empty.
@@ -149,27 +377,48 @@ public:
     /**
      * @brief Add two matrices.
      * 
-     * @param other The matrix to add.
+     * A 1 x cols row vector or rows x 1 column vector is broadcast across this matrix inside the kernel loop,
+     * without being expanded. The expression operators broadcast the same way: `m + bias`.
+     * 
+     * @param other The matrix (or view) to add; same shape, or a row or column vector.
      * @return The result of the addition.
      */
-    Matrix add(const Matrix& other) const;
+    BasicMatrix add(ConstView other) const;
 
     /**
      * @brief Subtract one matrix from another.
      * 
-     * @param other The matrix to subtract.
+     * @param other The matrix (or view) to subtract; same shape, or a row or column vector (broadcast as in add()).
      * @return The result of the subtraction.
      */
-    Matrix subtract(const Matrix& other) const;
+    BasicMatrix subtract(ConstView other) const;
 
     /**
      * @brief Multiply two matrices.
      * 
-     * @param other The matrix to multiply with.
+     * @param other The matrix (or view) to multiply with. Element-wise, a row or column vector is broadcast as in add().
      * @param elementWise If true, perform element-wise multiplication; otherwise, perform matrix multiplication.
+     * @param algorithm How a matrix product is computed. Strassen-Winograd (or Auto, which picks it for large,
+     *                  roughly square products) is faster for very large operands but has a weaker, normwise
+     *                  error bound; see kernels::GemmAlgorithm. Ignored for element-wise multiplication.
      * @return The result of the multiplication.
      */
-    Matrix multiply(const Matrix& other, bool elementWise = true) const;
+    BasicMatrix multiply(ConstView other, bool elementWise = true,
+                         kernels::GemmAlgorithm algorithm = kernels::GemmAlgorithm::Blocked) const;
+
+    /**
+     * @brief Matrix product with either operand transposed: op(this) * op(other).
+     * 
+     * Transposed operands are read in place, so this is the way to compute e.g. inputᵀ * gradient or
+     * gradient * weightsᵀ without materializing transpose().
+     * 
+     * @param other The matrix (or view) to multiply with.
+     * @param transposeThis Whether to use the transpose of this matrix.
+     * @param transposeOther Whether to use the transpose of other.
+     * @return The matrix product.
+     * @throws std::invalid_argument If the shapes do not match.
+     */
+    BasicMatrix multiply(ConstView other, kernels::Transpose transposeThis, kernels::Transpose transposeOther) const;
 
     /**
      * @brief Multiply the matrix by a scalar.
@@ -177,71 +426,239 @@ public:
      * @param scalar The scalar value.
      * @return The result of the multiplication.
      */
-    Matrix multiply(double scalar) const;
+    BasicMatrix multiply(T scalar) const;
 
     /**
      * @brief Transpose the matrix.
      * 
+     * Uses the cache-blocked (and, for large matrices, multithreaded) kernels in Transpose.h. To use a transpose
+     * in a product, prefer view().transpose() or the transpose flags of multiply(), which copy nothing.
+     * 
      * @return The transposed matrix.
      */
-    Matrix transpose() const;
+    BasicMatrix transpose() const;
+
+    /**
+     * @brief Transpose the matrix in place.
+     * 
+     * Square matrices are transposed without any extra storage; other shapes are transposed into a new buffer
+     * that replaces the current one.
+     * 
+     * @return A reference to the matrix.
+     */
+    BasicMatrix& transposeInPlace();
 
+    // Reductions
     /**
      * @brief Sum the rows of the matrix.
      * 
+     * @param method How each row is accumulated (see kernels::Summation).
      * @return A column vector with the sums.
+     * @throws std::runtime_error If the matrix is empty.
      */
-    Matrix sumRows() const;    // Sums across rows, returns column vector
+    BasicMatrix sumRows(kernels::Summation method = kernels::Summation::Pairwise) const;    // Sums across rows, returns column vector
 
     /**
      * @brief Sum the columns of the matrix.
      * 
+     * @param method How each column is accumulated (see kernels::Summation).
      * @return A row vector with the sums.
+     * @throws std::runtime_error If the matrix is empty.
+     */
+    BasicMatrix sumColumns(kernels::Summation method = kernels::Summation::Pairwise) const;
+
+    /**
+     * @brief Sum of all elements.
+     * 
+     * @param method How the elements are accumulated (see kernels::Summation).
+     * @throws std::runtime_error If the matrix is empty.
+     */
+    T sum(kernels::Summation method = kernels::Summation::Pairwise) const;
+
+    /**
+     * @brief Mean of all elements (pairwise sum divided by the element count).
+     * 
+     * @throws std::runtime_error If the matrix is empty.
+     */
+    T mean() const;
+
+    /**
+     * @brief Largest element.
+     * 
+     * @throws std::runtime_error If the matrix is empty.
+     */
+    T max() const;
+
+    /**
+     * @brief Position of the first largest element, in row-major order.
+     * 
+     * @return The (row, column) of the element.
+     * @throws std::runtime_error If the matrix is empty.
+     */
+    std::pair<size_t, size_t> argmax() const;
+
+    /**
+     * @brief Frobenius norm: the square root of the sum of the squared elements.
+     * 
+     * @throws std::runtime_error If the matrix is empty.
+     */
+    T norm() const;
+
+    // Destination-passing Operations
+    // Each ...Into() writes the result of the operation of the same name into a caller-provided output, which
+    // must already have the result's shape; nothing is allocated for the result, so an output kept across calls
+    // makes a steady-state loop allocation-free. The output may be a matrix or any view with unit column stride
+    // (e.g. a block of a larger matrix). For element-wise operations the output may be one of the operands itself
+    // (the same view); an output that overlaps an operand in any other layout, such as its transpose or a row that
+    // is broadcast, is overwritten before it is read.
+
+    /**
+     * @brief add() into an existing output.
+     * 
+     * @param other The matrix (or view) to add; same shape, or a row or column vector.
+     * @param out The rows x cols output.
+     * @throws std::invalid_argument If the shapes do not match or the output rows are strided.
      */
-    Matrix sumColumns() const;
+    void addInto(ConstView other, View out) const;
+
+    /**
+     * @brief subtract() into an existing output.
+     * 
+     * @throws std::invalid_argument If the shapes do not match or the output rows are strided.
+     */
+    void subtractInto(ConstView other, View out) const;
+
+    /**
+     * @brief multiply() into an existing output.
+     * 
+     * For the matrix product the output is rows x other.getCols() and may have any strides, but must not overlap
+     * either operand.
+     * 
+     * @throws std::invalid_argument If the shapes do not match or element-wise output rows are strided.
+     */
+    void multiplyInto(ConstView other, View out, bool elementWise = true,
+                      kernels::GemmAlgorithm algorithm = kernels::GemmAlgorithm::Blocked) const;
+
+    /**
+     * @brief Matrix product with either operand transposed, op(this) * op(other), into an existing output.
+     * 
+     * The output may have any strides, but must not overlap either operand.
+     * 
+     * @throws std::invalid_argument If the shapes do not match.
+     */
+    void multiplyInto(ConstView other, kernels::Transpose transposeThis, kernels::Transpose transposeOther,
+                      View out) const;
+
+    /**
+     * @brief Scalar multiply() into an existing output.
+     * 
+     * @throws std::invalid_argument If the shapes do not match or the output rows are strided.
+     */
+    void multiplyInto(T scalar, View out) const;
+
+    /**
+     * @brief applyFunction() into an existing output.
+     * 
+     * @throws std::invalid_argument If the shapes do not match or the output rows are strided.
+     */
+    void applyFunctionInto(const std::function<T(T)>& func, View out) const;
+
+    /**
+     * @brief transpose() into an existing cols x rows output, which must not overlap this matrix.
+     * 
+     * @throws std::invalid_argument If the shapes do not match or the output rows are strided.
+     */
+    void transposeInto(View out) const;
+
+    /**
+     * @brief sumRows() into an existing rows x 1 output (e.g. a column of a larger matrix).
+     * 
+     * @throws std::invalid_argument If the output shape does not match.
+     * @throws std::runtime_error If the matrix is empty.
+     */
+    void sumRowsInto(View out, kernels::Summation method = kernels::Summation::Pairwise) const;
+
+    /**
+     * @brief sumColumns() into an existing 1 x cols output.
+     * 
+     * @throws std::invalid_argument If the output shape does not match or the output row is strided.
+     * @throws std::runtime_error If the matrix is empty.
+     */
+    void sumColumnsInto(View out, kernels::Summation method = kernels::Summation::Pairwise) const;
 
     // Overloaded Operators
+    // The arithmetic operators (+, -, element-wise *, and scalar *, /, +, -) are lazy expression templates,
+    // see MatrixExpression.h. They are evaluated when assigned to a Matrix.
+
     /**
-     * @brief Add two matrices using the + operator.
+     * @brief Assign the result of an expression, evaluated in a single pass.
      * 
-     * @param other The matrix to add.
-     * @return The result of the addition.
+     * The matrix keeps its name. If the shape differs, the matrix is resized. An expression that reads this matrix
+     * other than element for element (such as `m - m.view().row(0)`) is evaluated into a scratch buffer first.
+     * 
+     * @param expression The expression to evaluate.
+     * @return A reference to the matrix.
      */
-    Matrix operator+(const Matrix& other) const;
+    template <MatrixExpression E>
+    BasicMatrix& operator=(const E& expression);
 
+    // Compound Assignment (in place; no allocation unless the operand reads this matrix, see evaluateInPlace)
     /**
-     * @brief Subtract one matrix from another using the - operator.
+     * @brief Add a matrix or expression element-wise, in place.
      * 
-     * @param other The matrix to subtract.
-     * @return The result of the subtraction.
+     * @param other The matrix or expression to add; same shape, or a row or column vector (broadcast).
+     * @return A reference to the matrix.
+     * @throws std::invalid_argument If other would broadcast this matrix to a larger shape.
      */
-    Matrix operator-(const Matrix& other) const;
+    template <MatrixOperand E>
+    BasicMatrix& operator+=(const E& other);
 
     /**
-     * @brief Multiply two matrices element-wise using the * operator.
+     * @brief Subtract a matrix or expression element-wise, in place.
      * 
-     * Note: This performs element-wise multiplication, not matrix multiplication.
+     * @param other The matrix or expression to subtract; same shape, or a row or column vector (broadcast).
+     * @return A reference to the matrix.
+     * @throws std::invalid_argument If other would broadcast this matrix to a larger shape.
+     */
+    template <MatrixOperand E>
+    BasicMatrix& operator-=(const E& other);
+
+    /**
+     * @brief Multiply by a matrix or expression element-wise, in place.
      * 
-     * @param other The matrix to multiply with.
-     * @return The result of the multiplication.
+     * @param other The matrix or expression to multiply with; same shape, or a row or column vector (broadcast).
+     * @return A reference to the matrix.
+     * @throws std::invalid_argument If other would broadcast this matrix to a larger shape.
      */
-    Matrix operator*(const Matrix& other) const;
+    template <MatrixOperand E>
+    BasicMatrix& operator*=(const E& other);
 
     /**
-     * @brief Multiply the matrix by a scalar using the * operator.
+     * @brief Multiply every element by a scalar, in place.
      * 
      * @param scalar The scalar value.
-     * @return The result of the multiplication.
+     * @return A reference to the matrix.
      */
-    Matrix operator*(double scalar) const;
+    BasicMatrix& operator*=(T scalar);
 
     /**
-     * @brief Divide the matrix by a scalar using the / operator.
+     * @brief Divide every element by a scalar, in place.
      * 
      * @param scalar The scalar value.
-     * @return The result of the division.
+     * @return A reference to the matrix.
+     */
+    BasicMatrix& operator/=(T scalar);
+
+    /**
+     * @brief Scaled in-place update: this += alpha * x (BLAS axpy).
+     * 
+     * This is the gradient-descent step, e.g. `weights.axpy(-learningRate, weightGradient)`.
+     * 
+     * @param alpha The scale applied to x.
+     * @param x The matrix (or view) to add, with the same dimensions as this matrix.
+     * @return A reference to the matrix.
      */
-    Matrix operator/(double scalar) const;
+    BasicMatrix& axpy(T alpha, ConstView x);
 
     /**
      * @brief Access an element of the matrix.
@@ -250,7 +667,7 @@ public:
      * @param col The column index.
      * @return A reference to the element.
      */
-    double& operator()(size_t row, size_t col);
+    T& operator()(size_t row, size_t col);
 
     /**
      * @brief Access an element of the matrix (const version).
@@ -259,7 +676,64 @@ public:
      * @param col The column index.
      * @return A const reference to the element.
      */
-    const double& operator()(size_t row, size_t col) const;
+    const T& operator()(size_t row, size_t col) const;
+
+    /**
+     * @brief Access an element without bounds checking, for hot loops.
+     * 
+     * The indices are only verified in checked builds (debug builds, or with MATRIX_CHECKED defined), so release
+     * builds compile this to a plain load or store that the compiler can vectorize.
+     * 
+     * @param row The row index.
+     * @param col The column index.
+     * @return A reference to the element.
+     */
+    inline T& operator[](size_t row, size_t col) {
+#ifdef MATRIX_CHECKED
+        checkIndices(row, col);
+#endif
+        return rowPtr(row)[col];
+    }
+
+    inline const T& operator[](size_t row, size_t col) const {
+#ifdef MATRIX_CHECKED
+        checkIndices(row, col);
+#endif
+        return rowPtr(row)[col];
+    }
+
+    // Raw Access
+    /**
+     * @brief Pointer to the first element of a row (checked only in checked builds).
+     * 
+     * The row's getCols() elements follow contiguously; the next row starts getStride() elements later.
+     */
+    inline T* rowData(size_t row) {
+#ifdef MATRIX_CHECKED
+        checkRow(row);
+#endif
+        return rowPtr(row);
+    }
+
+    inline const T* rowData(size_t row) const {
+#ifdef MATRIX_CHECKED
+        checkRow(row);
+#endif
+        return rowPtr(row);
+    }
+
+    /**
+     * @brief Iterators over every element in row-major order.
+     * 
+     * Matrices store their rows back to back (getStride() == getCols()), so these are plain pointers and work with
+     * the standard algorithms and range-for.
+     */
+    inline iterator begin() { return data.data(); }
+    inline iterator end() { return data.data() + data.size(); }
+    inline const_iterator begin() const { return data.data(); }
+    inline const_iterator end() const { return data.data() + data.size(); }
+    inline const_iterator cbegin() const { return begin(); }
+    inline const_iterator cend() const { return end(); }
 
     /**
      * @brief Compare two matrices for equality.
@@ -267,7 +741,7 @@ public:
      * @param other The matrix to compare with.
      * @return True if the matrices are equal, false otherwise.
      */
-    bool operator==(const Matrix& other) const;
+    bool operator==(const BasicMatrix& other) const;
 
     /**
      * @brief Compare two matrices using the three-way comparison operator.
@@ -275,7 +749,7 @@ public:
      * @param other The matrix to compare with.
      * @return The result of the comparison.
      */
-    std::partial_ordering operator<=>(const Matrix& other) const; 
+    std::partial_ordering operator<=>(const BasicMatrix& other) const; 
 
     /**
      * @brief Custom comparison function with tolerance.
@@ -284,7 +758,7 @@ public:
      * @param tolerance The tolerance for comparison.
      * @return True if the matrices are equal within the given tolerance, false otherwise.
      */
-    bool isEqual(const Matrix& other, double tolerance = 1e-5) const;
+    bool isEqual(const BasicMatrix& other, double tolerance = 1e-5) const;
 
     // Friend functions for overloading the << and >> operators
     /**
@@ -296,7 +770,8 @@ public:
      * @param matrix The matrix to output.
      * @return The output stream.
      */
-    friend std::ostream& operator<<(std::ostream& os, const Matrix& matrix);
+    template <typename U>
+    friend std::ostream& operator<<(std::ostream& os, const BasicMatrix<U>& matrix);
 
     /**
      * @brief Input the matrix from a stream.
@@ -307,7 +782,78 @@ public:
      * @param matrix The matrix to input.
      * @return The input stream.
      */
-    friend std::istream& operator>>(std::istream& is, Matrix& matrix);
+    template <typename U>
+    friend std::istream& operator>>(std::istream& is, BasicMatrix<U>& matrix);
 };
 
+// Aliases for the supported element types
+using Matrix = BasicMatrix<double>;
+using MatrixF = BasicMatrix<float>;
+
+template <typename T>
+std::ostream& operator<<(std::ostream& os, const BasicMatrix<T>& matrix);
+
+template <typename T>
+std::istream& operator>>(std::istream& is, BasicMatrix<T>& matrix);
+
+// Explicitly instantiated in Matrix.cpp
+extern template class BasicMatrix<double>;
+extern template class BasicMatrix<float>;
+
+// Expression Evaluation
+template <typename T>
+template <MatrixExpression E>
+BasicMatrix<T>::BasicMatrix(const E& expression, const std::string& name)
+    : name(name), rows(expression.getRows()), cols(expression.getCols()), stride(cols), data(rows * cols, Workspace::current()) {
+    static_assert(std::is_same_v<typename E::value_type, T>, "Expression and matrix must have the same element type.");
+    expression_detail::evaluate(expression, data.data(), stride);
+}
+
+template <typename T>
+template <MatrixExpression E>
+BasicMatrix<T>& BasicMatrix<T>::operator=(const E& expression) {
+    if (rows == expression.getRows() && cols == expression.getCols()) {
+        evaluateInPlace(expression);
+    } else {
+        *this = BasicMatrix(expression, name);
+    }
+    return *this;
+}
+
+template <typename T>
+template <MatrixOperand E>
+BasicMatrix<T>& BasicMatrix<T>::operator+=(const E& other) {
+    return assignInPlace(*this + other);
+}
+
+template <typename T>
+template <MatrixOperand E>
+BasicMatrix<T>& BasicMatrix<T>::operator-=(const E& other) {
+    return assignInPlace(*this - other);
+}
+
+template <typename T>
+template <MatrixOperand E>
+BasicMatrix<T>& BasicMatrix<T>::operator*=(const E& other) {
+    return assignInPlace(*this * other);
+}
+
+template <typename T>
+template <typename U>
+BasicMatrix<U> BasicMatrix<T>::cast() const {
+    BasicMatrix<U> result(rows, cols, name);
+    for (size_t i = 0; i < rows; ++i) {
+        const T* in = rowPtr(i);
+        for (size_t j = 0; j < cols; ++j) {
+            result.rowPtr(i)[j] = static_cast<U>(in[j]);
+        }
+    }
+    return result;
+}
+
+template <typename Derived>
+auto ExpressionNode<Derived>::eval() const {
+    return BasicMatrix<typename Derived::value_type>(static_cast<const Derived&>(*this));
+}
+
 #endif // MATRIX_H
@@ -0,0 +1,462 @@
+#ifndef MATRIX_EXPRESSION_H
+#define MATRIX_EXPRESSION_H
+
+#include "MatrixView.h"
+#include "Simd.h"
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+template <typename T>
+class BasicMatrix;
+
+/**
+ * @brief Lazily evaluated element-wise Matrix arithmetic (expression templates).
+ *
+ * The arithmetic operators (+, -, element-wise *, and the scalar forms) do not compute anything. They return
+ * small expression nodes that describe the computation. When an expression is assigned to (or used to
+ * construct) a Matrix, the whole tree is evaluated in one fused loop that writes each element once, so a
+ * chain of N operations costs one pass and one allocation instead of N.
+ *
+ * Nodes refer to their Matrix operands by reference, just like a function call would. An expression must be
+ * consumed within the statement that creates it; do not store one in an `auto` variable.
+ *
+ * MatrixView operands are allowed too, including views of the matrix being assigned to.
+ *
+ * Every node can tell whether it reads the storage of a destination at other positions than the one being
+ * written (aliases()); assigning such an expression to a matrix evaluates it into a temporary first.
+ *
+ * The binary operators broadcast a row or column vector operand across the other operand, like
+ * BasicMatrix::add(); two vectors of different orientation combine into a full matrix.
+ *
+ * Every node has a value_type. Operands of one expression must share it: float and double matrices are not
+ * mixed implicitly (use BasicMatrix::cast). Scalars are converted to the expression's value_type.
+ */
+
+/**
+ * @brief Satisfied by expression nodes (but not by Matrix itself).
+ */
+template <typename E>
+concept MatrixExpression = std::remove_cvref_t<E>::isExpressionNode;
+
+namespace expression_detail {
+
+template <typename T>
+struct IsMatrix : std::false_type {};
+
+template <typename T>
+struct IsMatrix<BasicMatrix<T>> : std::true_type {};
+
+template <typename T>
+struct IsView : std::false_type {};
+
+template <typename T>
+struct IsView<BasicMatrixView<T>> : std::true_type {};
+
+} // namespace expression_detail
+
+/**
+ * @brief Satisfied by any BasicMatrix (Matrix, MatrixF).
+ */
+template <typename E>
+concept MatrixType = expression_detail::IsMatrix<std::remove_cvref_t<E>>::value;
+
+/**
+ * @brief Satisfied by any BasicMatrixView, mutable or read-only.
+ */
+template <typename E>
+concept MatrixViewType = expression_detail::IsView<std::remove_cvref_t<E>>::value;
+
+/**
+ * @brief Anything that can appear as an operand of a matrix expression.
+ */
+template <typename E>
+concept MatrixOperand = MatrixExpression<E> || MatrixViewType<E> || MatrixType<E>;
+
+/**
+ * @brief Common base of all expression nodes.
+ */
+template <typename Derived>
+class ExpressionNode {
+public:
+    static constexpr bool isExpressionNode = true;
+
+    /**
+     * @brief Evaluate the expression into a new matrix.
+     *
+     * Useful when an expression is the operand of an operation that is not element-wise (such as a matrix product).
+     *
+     * @return The evaluated BasicMatrix<value_type> (defined in Matrix.h).
+     */
+    auto eval() const;
+};
+
+// -------------------- Leaf --------------------------------
+/**
+ * @brief Read-only reference to the elements of a Matrix.
+ */
+template <typename T>
+class MatrixLeaf : public ExpressionNode<MatrixLeaf<T>> {
+private:
+    const T* data;
+    size_t rows;
+    size_t cols;
+    size_t stride;
+
+public:
+    using value_type = T;
+
+    MatrixLeaf(const T* data, size_t rows, size_t cols, size_t stride)
+        : data(data), rows(rows), cols(cols), stride(stride) {}
+
+    inline size_t getRows() const { return rows; }
+    inline size_t getCols() const { return cols; }
+
+    inline bool broadcasts() const { return false; }
+
+    // Another matrix never shares storage with the destination, so the only overlap is the destination itself,
+    // which is safe unless it is broadcast
+    inline bool aliases(const T* begin, const T* end, size_t, bool sameIndex) const {
+        return !sameIndex && rows > 0 && cols > 0 && data < end && data + (rows - 1) * stride + cols > begin;
+    }
+
+    template <bool Broadcast = true>
+    inline T coeff(size_t row, size_t col) const {
+        return data[row * stride + col];
+    }
+};
+
+/**
+ * @brief Read-only reference to the elements of a MatrixView with arbitrary strides.
+ *
+ * Kept separate from MatrixLeaf so that whole matrices keep their unit column stride visible to the compiler.
+ */
+template <typename T>
+class StridedLeaf : public ExpressionNode<StridedLeaf<T>> {
+private:
+    BasicMatrixView<const T> view;
+
+public:
+    using value_type = T;
+
+    explicit StridedLeaf(BasicMatrixView<const T> view) : view(view) {}
+
+    // Whether any element of the view lies in [begin, end)
+    inline bool overlaps(const T* begin, const T* end) const {
+        if (view.getRows() == 0 || view.getCols() == 0) {
+            return false;
+        }
+        const T* first = view.getPointer();
+        const T* last = first + (view.getRows() - 1) * view.getRowStride() + (view.getCols() - 1) * view.getColStride();
+        return first < end && last >= begin;
+    }
+
+    inline size_t getRows() const { return view.getRows(); }
+    inline size_t getCols() const { return view.getCols(); }
+
+    inline bool broadcasts() const { return false; }
+
+    // Only a view with the destination's own layout reads each element at the position it is written to; a
+    // transposed or shifted view of it does not
+    inline bool aliases(const T* begin, const T* end, size_t ldo, bool sameIndex) const {
+        if (!overlaps(begin, end)) {
+            return false;
+        }
+        const bool sameLayout = view.getPointer() == begin && (view.getRowStride() == ldo || view.getRows() <= 1) &&
+                                view.hasContiguousRows();
+        return !(sameIndex && sameLayout);
+    }
+
+    template <bool Broadcast = true>
+    inline T coeff(size_t row, size_t col) const {
+        return view.getPointer()[row * view.getRowStride() + col * view.getColStride()];
+    }
+};
+
+// -------------------- Operations --------------------------
+namespace expression_ops {
+
+struct Add {
+    static constexpr const char* description = "addition";
+    template <typename T>
+    static T apply(T a, T b) { return a + b; }
+};
+
+struct Subtract {
+    static constexpr const char* description = "subtraction";
+    template <typename T>
+    static T apply(T a, T b) { return a - b; }
+};
+
+struct Multiply {
+    static constexpr const char* description = "element-wise multiplication";
+    template <typename T>
+    static T apply(T a, T b) { return a * b; }
+};
+
+struct Divide {
+    template <typename T>
+    static T apply(T a, T b) { return a / b; }
+};
+
+} // namespace expression_ops
+
+// -------------------- Nodes -------------------------------
+/**
+ * @brief Element-wise combination of two expressions of the same shape, or with a vector broadcast.
+ *
+ * An operand with one row or one column is repeated along that dimension (NumPy broadcasting rules), so
+ * `m + bias` adds a rows x 1 bias column to every column of m without expanding it.
+ *
+ * coeff<false>() assumes that no node of the tree broadcasts, which keeps the broadcast checks out of the index
+ * arithmetic of the common case so that it still vectorizes; evaluate() only uses it when broadcasts() is false.
+ */
+template <typename Op, typename L, typename R>
+class BinaryExpression : public ExpressionNode<BinaryExpression<Op, L, R>> {
+private:
+    L left;
+    R right;
+    size_t rows;
+    size_t cols;
+    bool leftRepeatsRow;   // left is a row vector repeated down the rows
+    bool leftRepeatsCol;   // left is a column vector repeated across the columns
+    bool rightRepeatsRow;
+    bool rightRepeatsCol;
+
+public:
+    using value_type = typename L::value_type;
+    static_assert(std::is_same_v<value_type, typename R::value_type>,
+                  "Operands of a matrix expression must have the same element type.");
+
+    BinaryExpression(const L& left, const R& right)
+        : left(left), right(right), rows(std::max(left.getRows(), right.getRows())),
+          cols(std::max(left.getCols(), right.getCols())) {
+        if ((left.getRows() != rows && left.getRows() != 1) || (left.getCols() != cols && left.getCols() != 1) ||
+            (right.getRows() != rows && right.getRows() != 1) || (right.getCols() != cols && right.getCols() != 1)) {
+            throw std::invalid_argument(std::string("Matrices must have the same or broadcastable dimensions for ") +
+                                        Op::description + ".");
+        }
+        leftRepeatsRow = left.getRows() != rows;
+        leftRepeatsCol = left.getCols() != cols;
+        rightRepeatsRow = right.getRows() != rows;
+        rightRepeatsCol = right.getCols() != cols;
+    }
+
+    inline size_t getRows() const { return rows; }
+    inline size_t getCols() const { return cols; }
+
+    inline bool broadcasts() const {
+        return leftRepeatsRow || leftRepeatsCol || rightRepeatsRow || rightRepeatsCol || left.broadcasts() ||
+               right.broadcasts();
+    }
+
+    // A repeated operand reads its elements at other positions than the ones being written
+    inline bool aliases(const value_type* begin, const value_type* end, size_t ldo, bool sameIndex) const {
+        return left.aliases(begin, end, ldo, sameIndex && !leftRepeatsRow && !leftRepeatsCol) ||
+               right.aliases(begin, end, ldo, sameIndex && !rightRepeatsRow && !rightRepeatsCol);
+    }
+
+    template <bool Broadcast = true>
+    inline value_type coeff(size_t row, size_t col) const {
+        if constexpr (Broadcast) {
+            return Op::apply(left.template coeff<true>(leftRepeatsRow ? 0 : row, leftRepeatsCol ? 0 : col),
+                             right.template coeff<true>(rightRepeatsRow ? 0 : row, rightRepeatsCol ? 0 : col));
+        } else {
+            return Op::apply(left.template coeff<false>(row, col), right.template coeff<false>(row, col));
+        }
+    }
+};
+
+/**
+ * @brief Element-wise combination of an expression with a scalar.
+ *
+ * @tparam ScalarOnLeft If true, computes Op(scalar, x), otherwise Op(x, scalar).
+ */
+template <typename Op, typename E, bool ScalarOnLeft>
+class ScalarExpression : public ExpressionNode<ScalarExpression<Op, E, ScalarOnLeft>> {
+public:
+    using value_type = typename E::value_type;
+
+private:
+    E operand;
+    value_type scalar;
+
+public:
+    ScalarExpression(const E& operand, double scalar) : operand(operand), scalar(static_cast<value_type>(scalar)) {}
+
+    inline size_t getRows() const { return operand.getRows(); }
+    inline size_t getCols() const { return operand.getCols(); }
+
+    inline bool broadcasts() const { return operand.broadcasts(); }
+
+    inline bool aliases(const value_type* begin, const value_type* end, size_t ldo, bool sameIndex) const {
+        return operand.aliases(begin, end, ldo, sameIndex);
+    }
+
+    template <bool Broadcast = true>
+    inline value_type coeff(size_t row, size_t col) const {
+        if constexpr (ScalarOnLeft) {
+            return Op::apply(scalar, operand.template coeff<Broadcast>(row, col));
+        } else {
+            return Op::apply(operand.template coeff<Broadcast>(row, col), scalar);
+        }
+    }
+};
+
+// -------------------- Operand Wrapping --------------------
+template <MatrixExpression E>
+inline const E& asExpression(const E& expression) {
+    return expression;
+}
+
+// Templated so that BasicMatrix only has to be complete where an expression is instantiated
+template <typename T>
+inline MatrixLeaf<T> asExpression(const BasicMatrix<T>& matrix) {
+    return MatrixLeaf<T>(matrix.getData().data(), matrix.getRows(), matrix.getCols(), matrix.getStride());
+}
+
+template <typename T>
+inline StridedLeaf<std::remove_const_t<T>> asExpression(const BasicMatrixView<T>& view) {
+    return StridedLeaf<std::remove_const_t<T>>(view);
+}
+
+template <MatrixOperand T>
+using ExpressionOf = std::remove_cvref_t<decltype(asExpression(std::declval<const T&>()))>;
+
+// -------------------- Operators ---------------------------
+template <MatrixOperand L, MatrixOperand R>
+inline auto operator+(const L& left, const R& right) {
+    return BinaryExpression<expression_ops::Add, ExpressionOf<L>, ExpressionOf<R>>(asExpression(left), asExpression(right));
+}
+
+template <MatrixOperand L, MatrixOperand R>
+inline auto operator-(const L& left, const R& right) {
+    return BinaryExpression<expression_ops::Subtract, ExpressionOf<L>, ExpressionOf<R>>(asExpression(left), asExpression(right));
+}
+
+/**
+ * @brief Element-wise (Hadamard) product. Use Matrix::multiply(other, false) for the matrix product.
+ */
+template <MatrixOperand L, MatrixOperand R>
+inline auto operator*(const L& left, const R& right) {
+    return BinaryExpression<expression_ops::Multiply, ExpressionOf<L>, ExpressionOf<R>>(asExpression(left), asExpression(right));
+}
+
+template <MatrixOperand E>
+inline auto operator*(const E& operand, double scalar) {
+    return ScalarExpression<expression_ops::Multiply, ExpressionOf<E>, false>(asExpression(operand), scalar);
+}
+
+template <MatrixOperand E>
+inline auto operator*(double scalar, const E& operand) {
+    return ScalarExpression<expression_ops::Multiply, ExpressionOf<E>, true>(asExpression(operand), scalar);
+}
+
+template <MatrixOperand E>
+inline auto operator/(const E& operand, double scalar) {
+    return ScalarExpression<expression_ops::Divide, ExpressionOf<E>, false>(asExpression(operand), scalar);
+}
+
+template <MatrixOperand E>
+inline auto operator+(const E& operand, double scalar) {
+    return ScalarExpression<expression_ops::Add, ExpressionOf<E>, false>(asExpression(operand), scalar);
+}
+
+template <MatrixOperand E>
+inline auto operator+(double scalar, const E& operand) {
+    return ScalarExpression<expression_ops::Add, ExpressionOf<E>, true>(asExpression(operand), scalar);
+}
+
+template <MatrixOperand E>
+inline auto operator-(const E& operand, double scalar) {
+    return ScalarExpression<expression_ops::Subtract, ExpressionOf<E>, false>(asExpression(operand), scalar);
+}
+
+template <MatrixOperand E>
+inline auto operator-(double scalar, const E& operand) {
+    return ScalarExpression<expression_ops::Subtract, ExpressionOf<E>, true>(asExpression(operand), scalar);
+}
+
+template <MatrixOperand E>
+inline auto operator-(const E& operand) {
+    return ScalarExpression<expression_ops::Multiply, ExpressionOf<E>, false>(asExpression(operand), -1.0);
+}
+
+// -------------------- Evaluation --------------------------
+namespace expression_detail {
+
+// The same fused loop is instantiated once per instruction set so the compiler can vectorize it for each.
+// Element-wise expressions only read the element they write, so there are no loop-carried dependencies.
+template <bool Broadcast, typename E, typename T>
+void evaluateRows(const E& expression, T* out, size_t ldo) {
+    const size_t rows = expression.getRows();
+    const size_t cols = expression.getCols();
+    for (size_t i = 0; i < rows; ++i) {
+        T* row = out + i * ldo;
+#pragma GCC ivdep
+        for (size_t j = 0; j < cols; ++j) {
+            row[j] = expression.template coeff<Broadcast>(i, j);
+        }
+    }
+}
+
+#ifdef NN_SIMD_X86
+template <bool Broadcast, typename E, typename T>
+NN_TARGET_AVX2 void evaluateRowsAvx2(const E& expression, T* out, size_t ldo) {
+    const size_t rows = expression.getRows();
+    const size_t cols = expression.getCols();
+    for (size_t i = 0; i < rows; ++i) {
+        T* row = out + i * ldo;
+#pragma GCC ivdep
+        for (size_t j = 0; j < cols; ++j) {
+            row[j] = expression.template coeff<Broadcast>(i, j);
+        }
+    }
+}
+
+template <bool Broadcast, typename E, typename T>
+NN_TARGET_AVX512 void evaluateRowsAvx512(const E& expression, T* out, size_t ldo) {
+    const size_t rows = expression.getRows();
+    const size_t cols = expression.getCols();
+    for (size_t i = 0; i < rows; ++i) {
+        T* row = out + i * ldo;
+#pragma GCC ivdep
+        for (size_t j = 0; j < cols; ++j) {
+            row[j] = expression.template coeff<Broadcast>(i, j);
+        }
+    }
+}
+#endif
+
+template <bool Broadcast, typename E, typename T>
+void evaluateAtLevel(const E& expression, T* out, size_t ldo) {
+    switch (simd::activeLevel()) {
+#ifdef NN_SIMD_X86
+        case simd::Level::AVX512:
+            return evaluateRowsAvx512<Broadcast>(expression, out, ldo);
+        case simd::Level::AVX2:
+            return evaluateRowsAvx2<Broadcast>(expression, out, ldo);
+#endif
+        default:
+            return evaluateRows<Broadcast>(expression, out, ldo);
+    }
+}
+
+/**
+ * @brief Write every element of an expression to a row-major destination in one pass.
+ */
+template <typename E, typename T>
+void evaluate(const E& expression, T* out, size_t ldo) {
+    if (expression.broadcasts()) {
+        evaluateAtLevel<true>(expression, out, ldo);
+    } else {
+        evaluateAtLevel<false>(expression, out, ldo);
+    }
+}
+
+} // namespace expression_detail
+
+#endif // MATRIX_EXPRESSION_H
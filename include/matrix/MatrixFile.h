@@ -0,0 +1,315 @@
+#ifndef MATRIX_FILE_H
+#define MATRIX_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <iosfwd>
+#include <memory>
+#include <optional>
+#include <string>
+#include "Matrix.h"
+#include "MatrixView.h"
+
+/**
+ * @brief Binary matrix file format.
+ *
+ * A file is a 64-byte header followed by the elements in row-major order, starting at a 64-byte aligned offset:
+ *
+ * | Offset | Size | Field                                                    |
+ * |--------|------|----------------------------------------------------------|
+ * | 0      | 8    | magic "NNMATRIX"                                         |
+ * | 8      | 4    | format version (1)                                       |
+ * | 12     | 4    | byte-order mark 0x01020304, written in the writer's order |
+ * | 16     | 4    | element type (1 = float64, 2 = float32)                  |
+ * | 20     | 4    | element size in bytes                                    |
+ * | 24     | 8    | rows                                                     |
+ * | 32     | 8    | columns                                                  |
+ * | 40     | 8    | offset of the first element                              |
+ * | 48     | 16   | reserved (zero)                                          |
+ *
+ * Unlike the text format of operator<< / operator>>, nothing is parsed: load() is one read, and MappedMatrix maps
+ * the file and uses the elements where they lie.
+ *
+ * For interchange with other tools there is also a delimited text format (readText() / writeText()): one row per
+ * line, with columns separated by whitespace, commas (CSV) or tabs (TSV).
+ */
+namespace matrix_file {
+
+enum class ElementType : uint32_t {
+    Float64 = 1,
+    Float32 = 2
+};
+
+struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    ElementType elementType;
+    uint32_t elementSize;
+    uint64_t rows;
+    uint64_t cols;
+    uint64_t dataOffset;
+    uint64_t reserved[2];
+};
+
+static_assert(sizeof(Header) == 64, "Matrix file header must be 64 bytes.");
+
+// Alignment of the element data within the file (a cache line, and enough for any SIMD load)
+inline constexpr size_t DATA_ALIGNMENT = 64;
+
+/**
+ * @brief Write a matrix (or view) to a binary file.
+ *
+ * @param matrix The elements to write.
+ * @param path Destination file, overwritten if it exists.
+ * @throws std::runtime_error If the file cannot be written.
+ */
+void save(ConstMatrixView matrix, const std::string& path);
+void save(ConstMatrixViewF matrix, const std::string& path);
+
+/**
+ * @brief Read a binary matrix file into a new matrix.
+ *
+ * Files written on a machine with the other byte order are swapped, and files of the other precision are
+ * converted, so load() accepts anything save() produces.
+ *
+ * @tparam T Element type of the result, double or float.
+ * @param path The file to read.
+ * @return The matrix.
+ * @throws std::runtime_error If the file cannot be read or is not a valid matrix file.
+ */
+template <typename T>
+BasicMatrix<T> load(const std::string& path);
+
+extern template BasicMatrix<double> load<double>(const std::string& path);
+extern template BasicMatrix<float> load<float>(const std::string& path);
+
+// Text
+
+/**
+ * @brief Column delimiters understood by the text reader and writer.
+ *
+ * Whitespace accepts any run of spaces and tabs between values (the layout operator<< produces); Comma and Tab
+ * expect exactly one delimiter between values, optionally padded with spaces.
+ */
+enum class Delimiter : char {
+    Whitespace = ' ',
+    Comma = ',',
+    Tab = '\t'
+};
+
+/**
+ * @brief Parse a delimited text matrix from a stream, starting at its current position.
+ *
+ * The stream is read in large blocks and numbers are converted with std::from_chars, so no per-line string or
+ * stream is created. If the stream is seekable, a first pass counts the rows so the values are parsed straight into
+ * the matrix; otherwise they are collected and copied once at the end. Blank lines and a trailing '\r' on each line
+ * are ignored.
+ *
+ * @tparam T Element type of the result, double or float.
+ * @param in The stream to read, which is consumed to its end.
+ * @param delimiter The column delimiter.
+ * @return The matrix.
+ * @throws std::runtime_error If a value is not a number or the rows have different lengths.
+ */
+template <typename T>
+BasicMatrix<T> readText(std::istream& in, Delimiter delimiter = Delimiter::Whitespace);
+
+/**
+ * @brief Parse a delimited text matrix file (see readText()).
+ *
+ * @throws std::runtime_error If the file cannot be opened or is not a valid text matrix.
+ */
+template <typename T>
+BasicMatrix<T> loadText(const std::string& path, Delimiter delimiter = Delimiter::Whitespace);
+
+extern template BasicMatrix<double> readText<double>(std::istream& in, Delimiter delimiter);
+extern template BasicMatrix<float> readText<float>(std::istream& in, Delimiter delimiter);
+extern template BasicMatrix<double> loadText<double>(const std::string& path, Delimiter delimiter);
+extern template BasicMatrix<float> loadText<float>(const std::string& path, Delimiter delimiter);
+
+/**
+ * @brief Write a matrix (or view) as delimited text, one row per line.
+ *
+ * Values are formatted with std::to_chars in their shortest round-trip form into a large buffer that is flushed in
+ * blocks, so readText() restores exactly the same values.
+ *
+ * @param matrix The elements to write.
+ * @param out The stream to write to.
+ * @param delimiter The column delimiter.
+ * @throws std::runtime_error If the stream fails.
+ */
+void writeText(ConstMatrixView matrix, std::ostream& out, Delimiter delimiter = Delimiter::Whitespace);
+void writeText(ConstMatrixViewF matrix, std::ostream& out, Delimiter delimiter = Delimiter::Whitespace);
+
+/**
+ * @brief Write a matrix (or view) to a delimited text file (see writeText()).
+ *
+ * @throws std::runtime_error If the file cannot be written.
+ */
+void saveText(ConstMatrixView matrix, const std::string& path, Delimiter delimiter = Delimiter::Whitespace);
+void saveText(ConstMatrixViewF matrix, const std::string& path, Delimiter delimiter = Delimiter::Whitespace);
+
+} // namespace matrix_file
+
+/**
+ * @brief Read-only matrix backed by a memory-mapped binary matrix file.
+ *
+ * Opening maps the file and validates its header; the elements are used in place, so there is no parsing and no
+ * copy, and pages are only read from disk when first touched. A MappedMatrix converts to a ConstView, so it can be
+ * passed to any Matrix operation or kernel that accepts one.
+ *
+ * The file must have been written with the native byte order and the element type T (use matrix_file::load() to
+ * convert otherwise). On platforms without mmap the file is read into memory instead.
+ *
+ * @tparam T Element type, double or float.
+ */
+template <typename T>
+class BasicMappedMatrix {
+private:
+    const void* mapping = nullptr;
+    size_t mappingSize = 0;
+    const T* data = nullptr;
+    size_t rows = 0;
+    size_t cols = 0;
+
+    void release();
+
+public:
+    using value_type = T;
+    using ConstView = BasicMatrixView<const T>;
+
+    // Constructors and Destructor
+    /**
+     * @brief Map a binary matrix file.
+     *
+     * @param path The file to map.
+     * @throws std::runtime_error If the file cannot be mapped, is not a valid matrix file, or has a different
+     *         byte order or element type.
+     */
+    explicit BasicMappedMatrix(const std::string& path);
+
+    BasicMappedMatrix(BasicMappedMatrix&& other) noexcept;
+    BasicMappedMatrix& operator=(BasicMappedMatrix&& other) noexcept;
+    BasicMappedMatrix(const BasicMappedMatrix&) = delete;
+    BasicMappedMatrix& operator=(const BasicMappedMatrix&) = delete;
+    ~BasicMappedMatrix();
+
+    // Getters
+    inline size_t getRows() const { return rows; }
+    inline size_t getCols() const { return cols; }
+
+    /**
+     * @brief Access an element.
+     *
+     * @throws std::out_of_range If the indices are out of range.
+     */
+    T operator()(size_t row, size_t col) const;
+
+    // Views
+    inline ConstView view() const { return ConstView(data, rows, cols, cols); }
+    inline operator ConstView() const { return view(); }
+
+    /**
+     * @brief Copy the elements into an ordinary, writable matrix.
+     */
+    BasicMatrix<T> toMatrix() const;
+};
+
+using MappedMatrix = BasicMappedMatrix<double>;
+using MappedMatrixF = BasicMappedMatrix<float>;
+
+// Explicitly instantiated in MatrixFile.cpp
+extern template class BasicMappedMatrix<double>;
+extern template class BasicMappedMatrix<float>;
+
+/**
+ * @brief Streams a binary or text matrix file as fixed-size batches of rows.
+ *
+ * Only the batch handed out last and the one being read ahead are in memory, so files far larger than RAM can be
+ * used for training. While the caller works on one batch, the next is read on a background thread:
+ *
+ * @code
+ * BatchReader reader("train.bin", 256);
+ * while (auto batch = reader.next()) {
+ *     network.train(*batch);
+ * }
+ * reader.reset();  // Next epoch
+ * @endcode
+ *
+ * The constructor waits for the first batch, so a file that cannot be opened or whose first rows are invalid is
+ * reported there; errors in later batches are thrown by next(). Batches are allocated on the reader thread, never
+ * from a Workspace, so they may outlive any WorkspaceScope.
+ *
+ * @tparam T Element type of the batches, double or float.
+ */
+template <typename T>
+class BasicBatchReader {
+private:
+    struct Source;
+
+    std::unique_ptr<Source> source;
+    size_t batchRows;
+    std::future<std::optional<BasicMatrix<T>>> pending;  // The batch being read ahead
+
+    void prefetch();
+    void readFirst();
+
+public:
+    // Constructors and Destructor
+    /**
+     * @brief Stream a binary matrix file (see matrix_file::save()).
+     *
+     * @param path The file to read.
+     * @param batchRows Number of rows per batch (the last batch may be shorter).
+     * @throws std::invalid_argument If batchRows is zero.
+     * @throws std::runtime_error If the file cannot be opened or is not a valid matrix file.
+     */
+    BasicBatchReader(const std::string& path, size_t batchRows);
+
+    /**
+     * @brief Stream a delimited text matrix file (see matrix_file::readText()).
+     *
+     * @param path The file to read.
+     * @param batchRows Number of rows per batch (the last batch may be shorter).
+     * @param delimiter The column delimiter.
+     * @throws std::invalid_argument If batchRows is zero.
+     * @throws std::runtime_error If the file cannot be opened or its first batch is invalid.
+     */
+    BasicBatchReader(const std::string& path, size_t batchRows, matrix_file::Delimiter delimiter);
+
+    BasicBatchReader(const BasicBatchReader&) = delete;
+    BasicBatchReader& operator=(const BasicBatchReader&) = delete;
+    ~BasicBatchReader();
+
+    // Getters
+    inline size_t getBatchRows() const { return batchRows; }
+
+    /**
+     * @brief Number of columns of every batch (0 for an empty file).
+     */
+    size_t getCols() const;
+
+    // Reading
+    /**
+     * @brief The next batch, or std::nullopt once the file is exhausted.
+     *
+     * @throws std::runtime_error If the batch could not be read (or an earlier one failed and reset() was not called).
+     */
+    std::optional<BasicMatrix<T>> next();
+
+    /**
+     * @brief Start again from the first row, e.g. for the next epoch.
+     */
+    void reset();
+};
+
+using BatchReader = BasicBatchReader<double>;
+using BatchReaderF = BasicBatchReader<float>;
+
+// Explicitly instantiated in MatrixFile.cpp
+extern template class BasicBatchReader<double>;
+extern template class BasicBatchReader<float>;
+
+#endif // MATRIX_FILE_H
@@ -0,0 +1,207 @@
+#ifndef MATRIX_VIEW_H
+#define MATRIX_VIEW_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+/**
+ * Unchecked element access (operator[] on matrices and views) only verifies its indices in checked builds: debug
+ * builds (NDEBUG not defined) or builds that define MATRIX_CHECKED. operator() is always checked.
+ */
+#if !defined(NDEBUG) && !defined(MATRIX_CHECKED)
+#define MATRIX_CHECKED
+#endif
+
+/**
+ * @brief Non-owning, strided window onto matrix elements.
+ *
+ * A view is a pointer plus a shape and two strides: element (i, j) lives at data[i * rowStride + j * colStride].
+ * That is enough to describe a whole matrix, a block, a range of rows, a single row or column, or a transposed
+ * matrix without copying anything. Views are cheap to pass by value.
+ *
+ * A view does not keep its matrix alive: it must not outlive the matrix it was taken from, and it is invalidated
+ * when that matrix is resized or moved from.
+ *
+ * @tparam T Element type; `double` or `float` for a mutable view, `const double` or `const float` for a read-only one.
+ */
+template <typename T>
+class BasicMatrixView {
+private:
+    T* data;
+    size_t rows;
+    size_t cols;
+    size_t rowStride;
+    size_t colStride;
+
+public:
+    using value_type = std::remove_const_t<T>;
+
+    // Constructors
+    /**
+     * @brief Construct a view over existing elements.
+     *
+     * @param data Pointer to element (0, 0).
+     * @param rows Number of rows.
+     * @param cols Number of columns.
+     * @param rowStride Distance (in elements) between consecutive rows.
+     * @param colStride Distance (in elements) between consecutive columns.
+     */
+    BasicMatrixView(T* data, size_t rows, size_t cols, size_t rowStride, size_t colStride = 1)
+        : data(data), rows(rows), cols(cols), rowStride(rowStride), colStride(colStride) {}
+
+    /**
+     * @brief A mutable view converts to a read-only one.
+     */
+    template <typename U>
+        requires(std::is_same_v<const U, T> && !std::is_same_v<U, T>)
+    BasicMatrixView(const BasicMatrixView<U>& other)
+        : data(other.getPointer()), rows(other.getRows()), cols(other.getCols()),
+          rowStride(other.getRowStride()), colStride(other.getColStride()) {}
+
+    // Getters
+    inline size_t getRows() const { return rows; }
+    inline size_t getCols() const { return cols; }
+    inline size_t getRowStride() const { return rowStride; }
+    inline size_t getColStride() const { return colStride; }
+    inline T* getPointer() const { return data; }
+
+    /**
+     * @brief Check whether each row is stored contiguously (unit column stride).
+     */
+    inline bool hasContiguousRows() const {
+        return colStride == 1 || cols <= 1;
+    }
+
+    /**
+     * @brief Check whether all elements form one contiguous row-major run.
+     */
+    inline bool isContiguous() const {
+        return hasContiguousRows() && (rowStride == cols || rows <= 1);
+    }
+
+    /**
+     * @brief Check whether the view has no elements.
+     */
+    inline bool isEmpty() const {
+        return rows == 0 || cols == 0;
+    }
+
+    // Element Access
+    /**
+     * @brief Access an element of the view.
+     *
+     * @param row The row index.
+     * @param col The column index.
+     * @return A reference to the element.
+     */
+    T& operator()(size_t row, size_t col) const {
+        if (row >= rows || col >= cols) {
+            throw std::out_of_range("Matrix view indices out of range.");
+        }
+        return data[row * rowStride + col * colStride];
+    }
+
+    /**
+     * @brief Access an element without bounds checking (checked only in checked builds, see MATRIX_CHECKED).
+     *
+     * @param row The row index.
+     * @param col The column index.
+     * @return A reference to the element.
+     */
+    T& operator[](size_t row, size_t col) const {
+#ifdef MATRIX_CHECKED
+        if (row >= rows || col >= cols) {
+            throw std::out_of_range("Matrix view indices out of range.");
+        }
+#endif
+        return data[row * rowStride + col * colStride];
+    }
+
+    // Sub-views
+    /**
+     * @brief A rectangular block of this view.
+     *
+     * @param row First row of the block.
+     * @param col First column of the block.
+     * @param blockRows Number of rows in the block.
+     * @param blockCols Number of columns in the block.
+     * @return The block as a view sharing the same elements.
+     */
+    BasicMatrixView block(size_t row, size_t col, size_t blockRows, size_t blockCols) const {
+        if (row + blockRows > rows || col + blockCols > cols) {
+            throw std::out_of_range("Matrix view block out of range.");
+        }
+        return BasicMatrixView(data + row * rowStride + col * colStride, blockRows, blockCols, rowStride, colStride);
+    }
+
+    /**
+     * @brief Rows [begin, end) of this view, e.g. one mini-batch of a dataset.
+     */
+    BasicMatrixView rowRange(size_t begin, size_t end) const {
+        if (begin > end) {
+            throw std::out_of_range("Matrix view row range is reversed.");
+        }
+        return block(begin, 0, end - begin, cols);
+    }
+
+    /**
+     * @brief Columns [begin, end) of this view, e.g. one gate of a stacked weight matrix.
+     */
+    BasicMatrixView colRange(size_t begin, size_t end) const {
+        if (begin > end) {
+            throw std::out_of_range("Matrix view column range is reversed.");
+        }
+        return block(0, begin, rows, end - begin);
+    }
+
+    /**
+     * @brief A single row as a 1 x cols view.
+     */
+    BasicMatrixView row(size_t index) const {
+        return block(index, 0, 1, cols);
+    }
+
+    /**
+     * @brief A single column as a rows x 1 view.
+     */
+    BasicMatrixView col(size_t index) const {
+        return block(0, index, rows, 1);
+    }
+
+    /**
+     * @brief The transpose of this view (no data is moved; the strides are swapped).
+     */
+    BasicMatrixView transpose() const {
+        return BasicMatrixView(data, cols, rows, colStride, rowStride);
+    }
+
+    /**
+     * @brief This view stretched to targetRows x targetCols by NumPy broadcasting rules (no data is copied).
+     *
+     * A dimension of size 1 is repeated with a stride of 0, so a 1 x cols row vector becomes every row and a
+     * rows x 1 column vector (e.g. a bias) becomes every column. Several elements of the result alias one
+     * element, so the result is always read-only.
+     *
+     * @param targetRows Number of rows of the result.
+     * @param targetCols Number of columns of the result.
+     * @return The read-only broadcast view.
+     */
+    BasicMatrixView<const value_type> broadcast(size_t targetRows, size_t targetCols) const {
+        if ((rows != targetRows && rows != 1) || (cols != targetCols && cols != 1)) {
+            throw std::invalid_argument("Cannot broadcast a " + std::to_string(rows) + "x" + std::to_string(cols) +
+                                        " matrix to " + std::to_string(targetRows) + "x" +
+                                        std::to_string(targetCols) + ".");
+        }
+        return BasicMatrixView<const value_type>(data, targetRows, targetCols, rows == targetRows ? rowStride : 0,
+                                                 cols == targetCols ? colStride : 0);
+    }
+};
+
+using MatrixView = BasicMatrixView<double>;
+using ConstMatrixView = BasicMatrixView<const double>;
+using MatrixViewF = BasicMatrixView<float>;
+using ConstMatrixViewF = BasicMatrixView<const float>;
+
+#endif // MATRIX_VIEW_H
@@ -0,0 +1,141 @@
+#ifndef QUANTIZED_MATRIX_H
+#define QUANTIZED_MATRIX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "Gemm.h"
+#include "Matrix.h"
+#include "MatrixView.h"
+
+/**
+ * @brief How many elements share one scale and zero-point.
+ */
+enum class QuantizationGranularity {
+    PerTensor,  ///< One scale for the whole matrix.
+    PerRow      ///< One scale per row, e.g. per output neuron of a weight matrix; tighter, at no extra cost.
+};
+
+/**
+ * @brief How the range of the values is mapped onto [-128, 127].
+ */
+enum class QuantizationScheme {
+    Symmetric,  ///< Zero-point 0 and range [-127, 127]; the usual choice for weights.
+    Asymmetric  ///< [min, max] onto the full range with a zero-point; suits one-sided data such as activations.
+};
+
+/**
+ * @brief Matrix of 8-bit integers with per-tensor or per-row scales and zero-points (post-training quantization).
+ *
+ * Element (i, j) stands for scale[i] * (q(i, j) - zeroPoint[i]). Storing a weight matrix this way takes an eighth
+ * of the bytes of doubles (a quarter of floats), so a memory-bound inference pass reads that much less.
+ *
+ * Rows are zero-padded to a multiple of 64 bytes, which lets the integer kernels run whole 64-byte steps without a
+ * tail; the sum of each row's integers is kept alongside to apply the zero-points after the integer product.
+ * Quantize a transposed view to store a matrix column by column (e.g. the input weights of a recurrent gate,
+ * whose output units are columns).
+ */
+class QuantizedMatrix {
+private:
+    size_t rows;
+    size_t cols;
+    size_t stride;  // Bytes between consecutive rows, a multiple of 64
+    QuantizationGranularity granularity;
+    QuantizationScheme scheme;
+    std::vector<int8_t> data;
+    std::vector<float> scales;       // One per row (repeated for per-tensor quantization)
+    std::vector<int32_t> zeroPoints;  // One per row
+    std::vector<int32_t> rowSums;     // Sum of the stored integers of each row
+
+    template <typename T>
+    void quantize(BasicMatrixView<const T> values);
+
+public:
+    /**
+     * @brief Construct an empty (0 x 0) matrix.
+     */
+    QuantizedMatrix();
+
+    /**
+     * @brief Quantize a matrix or view.
+     *
+     * @param values The values to quantize (may be strided or transposed).
+     * @param granularity Whether each row gets its own scale.
+     * @param scheme Whether the integers are symmetric around zero.
+     */
+    explicit QuantizedMatrix(ConstMatrixView values,
+                             QuantizationGranularity granularity = QuantizationGranularity::PerRow,
+                             QuantizationScheme scheme = QuantizationScheme::Symmetric);
+    explicit QuantizedMatrix(ConstMatrixViewF values,
+                             QuantizationGranularity granularity = QuantizationGranularity::PerRow,
+                             QuantizationScheme scheme = QuantizationScheme::Symmetric);
+
+    // Getters
+    inline size_t getRows() const { return rows; }
+    inline size_t getCols() const { return cols; }
+    inline size_t getStride() const { return stride; }
+    inline QuantizationGranularity getGranularity() const { return granularity; }
+    inline QuantizationScheme getScheme() const { return scheme; }
+    inline std::span<const float> getScales() const { return scales; }
+    inline std::span<const int32_t> getZeroPoints() const { return zeroPoints; }
+    inline std::span<const int32_t> getRowSums() const { return rowSums; }
+
+    /**
+     * @brief The stored integers of a row (getStride() bytes, zero past getCols()).
+     */
+    inline const int8_t* rowData(size_t row) const { return data.data() + row * stride; }
+
+    /**
+     * @brief Dequantized value of an element.
+     *
+     * @throws std::out_of_range If the indices are out of range.
+     */
+    float operator()(size_t row, size_t col) const;
+
+    /**
+     * @brief Number of bytes taken by the integers, scales and zero-points.
+     */
+    size_t getStorageBytes() const;
+
+    /**
+     * @brief The dequantized matrix.
+     */
+    template <typename T>
+    BasicMatrix<T> dequantize() const;
+};
+
+// Explicitly instantiated in QuantizedMatrix.cpp
+extern template BasicMatrix<double> QuantizedMatrix::dequantize<double>() const;
+extern template BasicMatrix<float> QuantizedMatrix::dequantize<float>() const;
+
+namespace kernels {
+
+/**
+ * @brief Quantized matrix product: C = epilogue(A * Bᵀ + beta * C).
+ *
+ * Both operands are stored with the shared dimension K along their rows, so every output element is a dot product
+ * of two contiguous int8 rows, accumulated exactly in int32 and then scaled back to floating point (zero-point
+ * corrections included) before the epilogue's biases and activation run on it. The integer kernel uses AVX-512
+ * VNNI (vpdpbusd) when the CPU has it and the active level is AVX-512, otherwise AVX2 (vpmaddwd) or scalar code.
+ *
+ * A weight matrix W used as W * X is passed as A with the inputs quantized as B = Xᵀ; a weight matrix used as
+ * X * W is quantized transposed and passed as B, with the inputs as A.
+ *
+ * Products with at least getGemmParallelThreshold() multiply-adds are split across ThreadPool::global().
+ *
+ * @param A The M x K left operand.
+ * @param B The N x K right operand (transposed in the product).
+ * @param beta Scale applied to the previous contents of C (0 to overwrite it).
+ * @param C The M x N destination.
+ * @param epilogue Biases and activation applied to C (see Epilogue).
+ * @throws std::invalid_argument If the shapes do not match.
+ */
+void quantizedGemm(const QuantizedMatrix& A, const QuantizedMatrix& B, double beta, MatrixView C,
+                   const Epilogue<double>& epilogue = {});
+void quantizedGemm(const QuantizedMatrix& A, const QuantizedMatrix& B, float beta, MatrixViewF C,
+                   const Epilogue<float>& epilogue = {});
+
+} // namespace kernels
+
+#endif // QUANTIZED_MATRIX_H
@@ -0,0 +1,114 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Philox4x32-10 counter-based random number generator.
+ *
+ * Instead of stepping a hidden state, Philox computes every random block directly from a 128-bit counter and the
+ * 64-bit seed (the key) with ten rounds of a multiply-xor bijection. Block n of a generator therefore never depends
+ * on blocks 0 .. n-1, which makes filling a large buffer trivially parallel: each fill reserves a range of
+ * counters, and every element is derived from its own position in that range. The values are the same whatever
+ * the number of threads, and the same as on any other machine.
+ *
+ * The counter holds the block index in its low 64 bits and the stream number in its high 64 bits, so generators
+ * with the same seed but different streams are independent.
+ *
+ * Filling is thread-safe: concurrent fills reserve disjoint counter ranges. Seeding is not.
+ */
+class Philox {
+private:
+    uint64_t key;
+    uint64_t stream;
+    std::atomic<uint64_t> position;  // Next unused block index
+
+    template <typename T>
+    void fill(T* out, size_t count, T min, T max);
+
+public:
+    using Block = std::array<uint32_t, 4>;
+
+    // Constructors
+    /**
+     * @brief Construct a generator.
+     *
+     * @param seed The key.
+     * @param stream Selects one of 2^64 independent sequences for the same seed.
+     */
+    explicit Philox(uint64_t seed, uint64_t stream = 0);
+
+    Philox(const Philox& other);
+    Philox& operator=(const Philox& other);
+
+    /**
+     * @brief The process-wide generator used by Matrix::randomize() and the layer constructors when none is given.
+     *
+     * It is seeded from std::random_device on first use; call seed() on it to make a whole run reproducible.
+     */
+    static Philox& global();
+
+    // Seeding
+    /**
+     * @brief Restart the generator with a new seed and stream.
+     */
+    Philox& seed(uint64_t seed, uint64_t stream = 0);
+
+    /**
+     * @brief A new generator whose seed is drawn from this one, e.g. to give a layer its own sequence.
+     */
+    Philox split();
+
+    // Getters
+    inline uint64_t getSeed() const { return key; }
+    inline uint64_t getStream() const { return stream; }
+
+    /**
+     * @brief Number of 128-bit blocks drawn so far.
+     */
+    inline uint64_t getPosition() const { return position.load(std::memory_order_relaxed); }
+
+    // Generation
+    /**
+     * @brief The raw Philox4x32-10 bijection: four 32-bit random words for a counter and key.
+     */
+    static Block block(Block counter, std::array<uint32_t, 2> key);
+
+    /**
+     * @brief Next 64 random bits.
+     */
+    uint64_t next();
+
+    /**
+     * @brief Fill a buffer with values uniformly distributed in [min, max).
+     *
+     * Doubles take 53 random bits (two words) and floats 24 bits (one word). Buffers of at least
+     * getParallelThreshold() elements are split across ThreadPool::global().
+     *
+     * @param out The buffer to fill.
+     * @param count Number of elements.
+     * @param min Lower bound (inclusive).
+     * @param max Upper bound (exclusive).
+     */
+    void fillUniform(double* out, size_t count, double min = 0.0, double max = 1.0);
+    void fillUniform(float* out, size_t count, float min = 0.0f, float max = 1.0f);
+
+    /**
+     * @brief Set the minimum number of elements at which fillUniform() uses the global thread pool.
+     *
+     * @param elements The new threshold.
+     */
+    static void setParallelThreshold(size_t elements);
+
+    /**
+     * @brief Get the minimum number of elements at which fillUniform() uses the global thread pool.
+     *
+     * @return The current threshold.
+     */
+    static size_t getParallelThreshold();
+};
+
+#endif // RANDOM_H
@@ -0,0 +1,97 @@
+#ifndef REDUCE_H
+#define REDUCE_H
+
+#include <cstddef>
+
+namespace kernels {
+
+/**
+ * @brief Reduction kernels: sums, extrema and norms over contiguous buffers and row-major matrices.
+ *
+ * The inner loops keep eight independent accumulators, which the compiler maps onto SIMD registers and which hide
+ * the latency of the floating-point adds. Inputs of at least getReductionParallelThreshold() elements are split
+ * across ThreadPool::global() in fixed-size chunks, so the result does not depend on the number of threads.
+ */
+
+/**
+ * @brief How a sum is accumulated.
+ */
+enum class Summation {
+    Naive,     ///< One running sum in index order; the error grows linearly with the length.
+    Pairwise,  ///< Blocks of 128 are summed, then combined as a balanced tree; error grows with log2(length).
+    Kahan      ///< Compensated (Kahan-Babuska) summation; error independent of the length, about 4x the work.
+};
+
+/**
+ * @brief Sum of x[0 .. n).
+ */
+double sum(size_t n, const double* x, Summation method = Summation::Pairwise);
+float sum(size_t n, const float* x, Summation method = Summation::Pairwise);
+
+/**
+ * @brief Euclidean norm of x[0 .. n), with the squares summed pairwise.
+ */
+double norm(size_t n, const double* x);
+float norm(size_t n, const float* x);
+
+/**
+ * @brief Largest element of x[0 .. n); n must be positive.
+ */
+double maxValue(size_t n, const double* x);
+float maxValue(size_t n, const float* x);
+
+/**
+ * @brief Index of the first largest element of x[0 .. n); n must be positive.
+ */
+size_t argmax(size_t n, const double* x);
+size_t argmax(size_t n, const float* x);
+
+/**
+ * @brief out[i] = sum of row i of the rows x cols matrix a.
+ *
+ * @param rows Number of rows.
+ * @param cols Number of columns.
+ * @param a Pointer to the first element.
+ * @param lda Leading dimension of a.
+ * @param out Receives rows sums.
+ * @param method How each row is accumulated.
+ */
+void sumRows(size_t rows, size_t cols, const double* a, size_t lda, double* out,
+             Summation method = Summation::Pairwise);
+void sumRows(size_t rows, size_t cols, const float* a, size_t lda, float* out,
+             Summation method = Summation::Pairwise);
+
+/**
+ * @brief out[j] = sum of column j of the rows x cols matrix a.
+ *
+ * The matrix is read row by row (bands of columns per thread), never down a column.
+ *
+ * @param rows Number of rows.
+ * @param cols Number of columns.
+ * @param a Pointer to the first element.
+ * @param lda Leading dimension of a.
+ * @param out Receives cols sums.
+ * @param method How each column is accumulated.
+ */
+void sumColumns(size_t rows, size_t cols, const double* a, size_t lda, double* out,
+                Summation method = Summation::Pairwise);
+void sumColumns(size_t rows, size_t cols, const float* a, size_t lda, float* out,
+                Summation method = Summation::Pairwise);
+
+/**
+ * @brief Set the minimum number of elements at which the reductions use the global thread pool.
+ *
+ * @param elements The new threshold.
+ */
+void setReductionParallelThreshold(size_t elements);
+
+/**
+ * @brief Get the minimum number of elements at which the reductions use the global thread pool.
+ *
+ * @return The current threshold.
+ */
+size_t getReductionParallelThreshold();
+
+} // namespace kernels
+
+#endif // REDUCE_H
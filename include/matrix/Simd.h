@@ -0,0 +1,163 @@
+#ifndef SIMD_H
+#define SIMD_H
+
+#include <cstddef>
+
+/**
+ * @brief Instruction set selection for the vectorized matrix kernels.
+ *
+ * Kernels are compiled for several x86 instruction sets at once (using per-function target attributes),
+ * and the best one supported by the running CPU is picked at runtime. This keeps the default build portable
+ * while still using AVX2/AVX-512 when they are available.
+ */
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define NN_SIMD_X86 1
+#define NN_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define NN_TARGET_AVX512 __attribute__((target("avx512f")))
+#endif
+
+namespace simd {
+
+/**
+ * @brief Available kernel instruction sets, ordered from least to most capable.
+ */
+enum class Level {
+    Scalar = 0,
+    SSE2 = 1,
+    AVX2 = 2,
+    AVX512 = 3
+};
+
+/**
+ * @brief The most capable instruction set supported by the CPU.
+ *
+ * @return The detected level (cached after the first call).
+ */
+Level detectedLevel();
+
+/**
+ * @brief The instruction set currently used by the kernels.
+ *
+ * @return The active level.
+ */
+Level activeLevel();
+
+/**
+ * @brief Restrict the kernels to a given instruction set.
+ *
+ * Requests above the detected level are clamped to it. This is mainly useful for testing the fallback paths.
+ *
+ * @param level The requested level.
+ * @return The level that is actually used.
+ */
+Level setActiveLevel(Level level);
+
+#ifdef NN_SIMD_X86
+/**
+ * @brief Register traits, one specialization per instruction set and element type.
+ *
+ * Each provides the register type, its lane count and the handful of operations the kernels need, so a
+ * kernel is written once per instruction set and instantiated for both float and double.
+ */
+template <typename T> struct Sse2;
+template <typename T> struct Avx2;
+template <typename T> struct Avx512;
+
+template <>
+struct Sse2<double> {
+    using Reg = __m128d;
+    static constexpr size_t lanes = 2;
+    static Reg load(const double* p) { return _mm_loadu_pd(p); }
+    static void store(double* p, Reg r) { _mm_storeu_pd(p, r); }
+    static Reg set1(double s) { return _mm_set1_pd(s); }
+    static Reg zero() { return _mm_setzero_pd(); }
+    static Reg add(Reg a, Reg b) { return _mm_add_pd(a, b); }
+    static Reg sub(Reg a, Reg b) { return _mm_sub_pd(a, b); }
+    static Reg mul(Reg a, Reg b) { return _mm_mul_pd(a, b); }
+    static Reg fmadd(Reg a, Reg b, Reg c) { return _mm_add_pd(_mm_mul_pd(a, b), c); }  // No FMA in SSE2
+};
+
+template <>
+struct Sse2<float> {
+    using Reg = __m128;
+    static constexpr size_t lanes = 4;
+    static Reg load(const float* p) { return _mm_loadu_ps(p); }
+    static void store(float* p, Reg r) { _mm_storeu_ps(p, r); }
+    static Reg set1(float s) { return _mm_set1_ps(s); }
+    static Reg zero() { return _mm_setzero_ps(); }
+    static Reg add(Reg a, Reg b) { return _mm_add_ps(a, b); }
+    static Reg sub(Reg a, Reg b) { return _mm_sub_ps(a, b); }
+    static Reg mul(Reg a, Reg b) { return _mm_mul_ps(a, b); }
+    static Reg fmadd(Reg a, Reg b, Reg c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+};
+
+template <>
+struct Avx2<double> {
+    using Reg = __m256d;
+    static constexpr size_t lanes = 4;
+    NN_TARGET_AVX2 static Reg load(const double* p) { return _mm256_loadu_pd(p); }
+    NN_TARGET_AVX2 static void store(double* p, Reg r) { _mm256_storeu_pd(p, r); }
+    NN_TARGET_AVX2 static Reg set1(double s) { return _mm256_set1_pd(s); }
+    NN_TARGET_AVX2 static Reg zero() { return _mm256_setzero_pd(); }
+    NN_TARGET_AVX2 static Reg add(Reg a, Reg b) { return _mm256_add_pd(a, b); }
+    NN_TARGET_AVX2 static Reg sub(Reg a, Reg b) { return _mm256_sub_pd(a, b); }
+    NN_TARGET_AVX2 static Reg mul(Reg a, Reg b) { return _mm256_mul_pd(a, b); }
+    NN_TARGET_AVX2 static Reg fmadd(Reg a, Reg b, Reg c) { return _mm256_fmadd_pd(a, b, c); }
+};
+
+template <>
+struct Avx2<float> {
+    using Reg = __m256;
+    static constexpr size_t lanes = 8;
+    NN_TARGET_AVX2 static Reg load(const float* p) { return _mm256_loadu_ps(p); }
+    NN_TARGET_AVX2 static void store(float* p, Reg r) { _mm256_storeu_ps(p, r); }
+    NN_TARGET_AVX2 static Reg set1(float s) { return _mm256_set1_ps(s); }
+    NN_TARGET_AVX2 static Reg zero() { return _mm256_setzero_ps(); }
+    NN_TARGET_AVX2 static Reg add(Reg a, Reg b) { return _mm256_add_ps(a, b); }
+    NN_TARGET_AVX2 static Reg sub(Reg a, Reg b) { return _mm256_sub_ps(a, b); }
+    NN_TARGET_AVX2 static Reg mul(Reg a, Reg b) { return _mm256_mul_ps(a, b); }
+    NN_TARGET_AVX2 static Reg fmadd(Reg a, Reg b, Reg c) { return _mm256_fmadd_ps(a, b, c); }
+};
+
+// AVX-512 also provides masked loads and stores, used to handle loop tails without a scalar loop
+template <>
+struct Avx512<double> {
+    using Reg = __m512d;
+    using Mask = __mmask8;
+    static constexpr size_t lanes = 8;
+    NN_TARGET_AVX512 static Reg load(const double* p) { return _mm512_loadu_pd(p); }
+    NN_TARGET_AVX512 static void store(double* p, Reg r) { _mm512_storeu_pd(p, r); }
+    NN_TARGET_AVX512 static Reg maskLoad(Mask m, const double* p) { return _mm512_maskz_loadu_pd(m, p); }
+    NN_TARGET_AVX512 static void maskStore(double* p, Mask m, Reg r) { _mm512_mask_storeu_pd(p, m, r); }
+    NN_TARGET_AVX512 static Reg set1(double s) { return _mm512_set1_pd(s); }
+    NN_TARGET_AVX512 static Reg zero() { return _mm512_setzero_pd(); }
+    NN_TARGET_AVX512 static Reg add(Reg a, Reg b) { return _mm512_add_pd(a, b); }
+    NN_TARGET_AVX512 static Reg sub(Reg a, Reg b) { return _mm512_sub_pd(a, b); }
+    NN_TARGET_AVX512 static Reg mul(Reg a, Reg b) { return _mm512_mul_pd(a, b); }
+    NN_TARGET_AVX512 static Reg fmadd(Reg a, Reg b, Reg c) { return _mm512_fmadd_pd(a, b, c); }
+    static Mask tailMask(size_t n) { return static_cast<Mask>((1u << n) - 1); }
+};
+
+template <>
+struct Avx512<float> {
+    using Reg = __m512;
+    using Mask = __mmask16;
+    static constexpr size_t lanes = 16;
+    NN_TARGET_AVX512 static Reg load(const float* p) { return _mm512_loadu_ps(p); }
+    NN_TARGET_AVX512 static void store(float* p, Reg r) { _mm512_storeu_ps(p, r); }
+    NN_TARGET_AVX512 static Reg maskLoad(Mask m, const float* p) { return _mm512_maskz_loadu_ps(m, p); }
+    NN_TARGET_AVX512 static void maskStore(float* p, Mask m, Reg r) { _mm512_mask_storeu_ps(p, m, r); }
+    NN_TARGET_AVX512 static Reg set1(float s) { return _mm512_set1_ps(s); }
+    NN_TARGET_AVX512 static Reg zero() { return _mm512_setzero_ps(); }
+    NN_TARGET_AVX512 static Reg add(Reg a, Reg b) { return _mm512_add_ps(a, b); }
+    NN_TARGET_AVX512 static Reg sub(Reg a, Reg b) { return _mm512_sub_ps(a, b); }
+    NN_TARGET_AVX512 static Reg mul(Reg a, Reg b) { return _mm512_mul_ps(a, b); }
+    NN_TARGET_AVX512 static Reg fmadd(Reg a, Reg b, Reg c) { return _mm512_fmadd_ps(a, b, c); }
+    static Mask tailMask(size_t n) { return static_cast<Mask>((1u << n) - 1); }
+};
+#endif
+
+} // namespace simd
+
+#endif // SIMD_H
@@ -0,0 +1,154 @@
+#ifndef SPARSE_MATRIX_H
+#define SPARSE_MATRIX_H
+
+#include <cstddef>
+#include <span>
+#include <vector>
+#include "Matrix.h"
+#include "MatrixView.h"
+
+/**
+ * @brief Sparse matrix in compressed sparse row (CSR) format.
+ *
+ * Only the non-zero elements are stored: row i owns the entries [rowOffsets[i], rowOffsets[i + 1]) of colIndices
+ * and values, with column indices strictly increasing within each row. Intended for inputs such as bag-of-words
+ * or one-hot features, where well under 1% of the elements are non-zero.
+ *
+ * transpose() converts between row-major and column-major compression (the CSR form of the transpose is the CSC
+ * form of the original), so a batch built sample by sample with appendRow() can be turned into the
+ * feature x sample layout that DenseLayer expects.
+ *
+ * @tparam T Element type, double or float.
+ */
+template <typename T>
+class BasicSparseMatrix {
+private:
+    size_t rows;
+    size_t cols;
+    std::vector<size_t> rowOffsets;  // rows + 1 offsets into colIndices / values
+    std::vector<size_t> colIndices;
+    std::vector<T> values;
+    std::vector<size_t> activeRows;  // Rows with at least one entry, in order
+
+public:
+    using value_type = T;
+    using ConstView = BasicMatrixView<const T>;
+    using View = BasicMatrixView<T>;
+
+    // Constructors
+    /**
+     * @brief Construct an all-zero sparse matrix.
+     *
+     * @param rows Number of rows.
+     * @param cols Number of columns.
+     */
+    BasicSparseMatrix(size_t rows, size_t cols);
+
+    /**
+     * @brief Construct from CSR arrays.
+     *
+     * @param rows Number of rows.
+     * @param cols Number of columns.
+     * @param rowOffsets rows + 1 non-decreasing offsets, starting at 0 and ending at values.size().
+     * @param colIndices Column of each stored value, strictly increasing within a row.
+     * @param values The stored values.
+     * @throws std::invalid_argument If the arrays do not describe a valid CSR matrix.
+     */
+    BasicSparseMatrix(size_t rows, size_t cols, std::vector<size_t> rowOffsets, std::vector<size_t> colIndices,
+                      std::vector<T> values);
+
+    /**
+     * @brief Compress a dense matrix or view, keeping its non-zero elements.
+     */
+    static BasicSparseMatrix fromDense(ConstView dense);
+
+    // Building
+    /**
+     * @brief Append a row, e.g. one sample of a batch.
+     *
+     * @param indices Columns of the non-zero elements, strictly increasing.
+     * @param rowValues The non-zero elements.
+     * @return A reference to the matrix.
+     * @throws std::invalid_argument If the sizes differ or an index is out of range or out of order.
+     */
+    BasicSparseMatrix& appendRow(std::span<const size_t> indices, std::span<const T> rowValues);
+
+    // Getters
+    inline size_t getRows() const { return rows; }
+    inline size_t getCols() const { return cols; }
+    inline size_t getNonZeros() const { return values.size(); }
+    inline std::span<const size_t> getRowOffsets() const { return rowOffsets; }
+    inline std::span<const size_t> getColIndices() const { return colIndices; }
+    inline std::span<const T> getValues() const { return values; }
+
+    /**
+     * @brief Rows that contain at least one stored element, in increasing order.
+     */
+    inline std::span<const size_t> getActiveRows() const { return activeRows; }
+
+    /**
+     * @brief Fraction of elements that are stored.
+     */
+    double density() const;
+
+    /**
+     * @brief Value of an element (zero if it is not stored).
+     *
+     * @throws std::out_of_range If the indices are out of range.
+     */
+    T operator()(size_t row, size_t col) const;
+
+    // Conversion
+    BasicMatrix<T> toDense() const;
+
+    /**
+     * @brief The transpose, in CSR form.
+     */
+    BasicSparseMatrix transpose() const;
+
+    // Products
+    /**
+     * @brief Sparse times dense: this * dense.
+     *
+     * Each stored element (i, k, v) adds v * dense(k, :) to row i of the result.
+     *
+     * @param dense The cols x N dense operand.
+     * @return The rows x N product.
+     * @throws std::invalid_argument If the shapes do not match.
+     */
+    BasicMatrix<T> multiply(ConstView dense) const;
+
+    /**
+     * @brief Dense times sparse: dense * this.
+     *
+     * Only the columns of dense that meet a non-empty row of this matrix are read, so the cost is
+     * dense.getRows() * getNonZeros() rather than a full dense product.
+     *
+     * @param dense The M x rows dense operand.
+     * @return The M x cols product.
+     * @throws std::invalid_argument If the shapes do not match.
+     */
+    BasicMatrix<T> leftMultiply(ConstView dense) const;
+
+    /**
+     * @brief target += alpha * dense * thisᵀ, touching only the columns of target that are active rows of this.
+     *
+     * This is the weight-gradient update of a layer whose input is this matrix: columns of the weights that belong
+     * to features absent from the batch are neither read nor written.
+     *
+     * @param alpha Scale applied to the product (e.g. minus the learning rate).
+     * @param dense The M x cols dense operand (e.g. the output gradient).
+     * @param target The M x rows matrix to update.
+     * @throws std::invalid_argument If the shapes do not match.
+     */
+    void accumulateProductTransposed(T alpha, ConstView dense, View target) const;
+};
+
+using SparseMatrix = BasicSparseMatrix<double>;
+using SparseMatrixF = BasicSparseMatrix<float>;
+
+// Explicitly instantiated in SparseMatrix.cpp
+extern template class BasicSparseMatrix<double>;
+extern template class BasicSparseMatrix<float>;
+
+#endif // SPARSE_MATRIX_H
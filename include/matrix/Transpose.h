@@ -0,0 +1,58 @@
+#ifndef TRANSPOSE_H
+#define TRANSPOSE_H
+
+#include <cstddef>
+
+namespace kernels {
+
+/**
+ * @brief Cache-blocked matrix transposition.
+ *
+ * A naive transpose reads one matrix row by row and writes the other column by column, so for large matrices
+ * every write touches a new cache line (and often a new page). These kernels work on square tiles small enough
+ * for both the source and destination tile to stay in L1, and split the tiles across ThreadPool::global() once
+ * the matrix has at least getTransposeParallelThreshold() elements.
+ */
+
+/**
+ * @brief out = inᵀ, where in is rows x cols.
+ *
+ * @param rows Number of rows of in (columns of out).
+ * @param cols Number of columns of in (rows of out).
+ * @param in Pointer to the first element of the source.
+ * @param ldi Leading dimension of the source.
+ * @param out Pointer to the first element of the destination; must not overlap the source.
+ * @param ldo Leading dimension of the destination.
+ */
+void transpose(size_t rows, size_t cols, const double* in, size_t ldi, double* out, size_t ldo);
+void transpose(size_t rows, size_t cols, const float* in, size_t ldi, float* out, size_t ldo);
+
+/**
+ * @brief a = aᵀ for a square n x n matrix, without any extra storage.
+ *
+ * Tiles on the diagonal are transposed in place and every off-diagonal tile is swapped with its mirror image.
+ *
+ * @param n Number of rows and columns.
+ * @param a Pointer to the first element.
+ * @param lda Leading dimension.
+ */
+void transposeInPlace(size_t n, double* a, size_t lda);
+void transposeInPlace(size_t n, float* a, size_t lda);
+
+/**
+ * @brief Set the minimum number of elements at which the transpose kernels use the global thread pool.
+ *
+ * @param elements The new threshold.
+ */
+void setTransposeParallelThreshold(size_t elements);
+
+/**
+ * @brief Get the minimum number of elements at which the transpose kernels use the global thread pool.
+ *
+ * @return The current threshold.
+ */
+size_t getTransposeParallelThreshold();
+
+} // namespace kernels
+
+#endif // TRANSPOSE_H
@@ -0,0 +1,103 @@
+#ifndef WORKSPACE_H
+#define WORKSPACE_H
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+/**
+ * @brief Bump-pointer arena for short-lived Matrix buffers.
+ *
+ * While a WorkspaceScope is active on a thread, every Matrix constructed on that thread takes its buffer from the
+ * workspace instead of the heap. Allocation is a pointer bump, deallocation is a no-op, and all memory is reclaimed
+ * at once when the outermost scope ends. Blocks are kept for the next step; if a step needed more than one block
+ * they are merged into a single block of the combined size, so after the first few steps a steady-state training
+ * or inference loop makes no calls into malloc at all.
+ *
+ * A workspace is not thread-safe: use one per thread (or per network driven by a single thread).
+ *
+ * @code
+ * Workspace workspace;
+ * for (const Matrix& batch : batches) {
+ *     WorkspaceScope scope(workspace);
+ *     Matrix output = network.forward(batch);   // temporaries come from the workspace
+ *     ...
+ * }                                             // everything allocated in the step is released here
+ * @endcode
+ */
+class Workspace : public std::pmr::memory_resource {
+private:
+    struct Block {
+        std::unique_ptr<std::byte[]> memory;
+        size_t size;
+    };
+
+    std::vector<Block> blocks;
+    size_t currentBlock = 0;  // Index of the block being bumped
+    size_t offset = 0;        // Bytes used in the current block
+    size_t used = 0;          // Bytes handed out since the last reset, including alignment padding
+    size_t highWaterMark = 0;
+    size_t depth = 0;         // Number of active scopes using this workspace
+
+    friend class WorkspaceScope;
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+public:
+    // Constructors and Destructor
+    /**
+     * @brief Construct a workspace.
+     *
+     * @param initialCapacity Size in bytes of the first block (0 allocates lazily on first use).
+     */
+    explicit Workspace(size_t initialCapacity = 0);
+    Workspace(const Workspace&) = delete;
+    Workspace& operator=(const Workspace&) = delete;
+    ~Workspace() override = default;
+
+    /**
+     * @brief Release everything allocated so far, keeping (and if needed merging) the blocks for reuse.
+     *
+     * Called automatically when the outermost WorkspaceScope ends; every buffer handed out before is invalidated.
+     */
+    Workspace& reset();
+
+    // Getters
+    inline size_t getBytesUsed() const { return used; }
+    inline size_t getHighWaterMark() const { return highWaterMark; }
+    size_t getCapacity() const;
+    inline size_t getBlockCount() const { return blocks.size(); }
+
+    /**
+     * @brief The memory resource new matrices on this thread allocate from.
+     *
+     * The active workspace inside a WorkspaceScope, std::pmr::new_delete_resource() otherwise.
+     */
+    static std::pmr::memory_resource* current();
+};
+
+/**
+ * @brief Makes a workspace the allocation source for matrices on this thread for the lifetime of the scope.
+ *
+ * Scopes nest: the previous source is restored on exit, and the workspace is reset only when its outermost scope
+ * ends. Matrices constructed inside the scope must not outlive it. Assigning one to a longer-lived matrix is safe,
+ * since assignment copies into the destination's own storage.
+ */
+class WorkspaceScope {
+private:
+    Workspace& workspace;
+    Workspace* previous;
+
+public:
+    explicit WorkspaceScope(Workspace& workspace);
+    ~WorkspaceScope();
+
+    WorkspaceScope(const WorkspaceScope&) = delete;
+    WorkspaceScope& operator=(const WorkspaceScope&) = delete;
+};
+
+#endif // WORKSPACE_H
@@ -0,0 +1,105 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Persistent pool of worker threads for data-parallel kernels.
+ *
+ * Workers are created once and then sleep until work arrives, so dispatching a parallel loop costs a wake-up
+ * instead of a thread creation. The calling thread always takes part in the work, which means a pool with a
+ * thread count of N owns N - 1 workers.
+ *
+ * Only one parallel loop runs at a time. Calls made while the pool is busy (including nested calls from inside
+ * a parallel loop) simply run on the calling thread.
+ */
+class ThreadPool {
+private:
+    std::vector<std::thread> workers;
+    std::atomic<size_t> threadCount{1};
+
+    std::mutex dispatchMutex;                   // Held by the thread that currently owns the workers
+    std::mutex stateMutex;                      // Guards everything below
+    std::condition_variable workAvailable;
+    std::condition_variable workDone;
+
+    const std::function<void(size_t, size_t)>* task = nullptr;
+    size_t taskBegin = 0;
+    size_t taskEnd = 0;
+    size_t taskChunks = 0;
+    size_t generation = 0;                      // Incremented for every dispatched loop
+    size_t pending = 0;                         // Chunks still running on workers
+    bool stopping = false;
+    std::exception_ptr firstError;
+
+    void startWorkers(size_t count);
+    void stopWorkers();
+    void workerLoop(size_t index, size_t startGeneration);
+    void runChunk(size_t chunk);
+
+public:
+    // Constructor and Destructor
+    /**
+     * @brief Construct a new ThreadPool.
+     *
+     * @param threadCount Total number of threads taking part in a parallel loop, including the caller.
+     */
+    explicit ThreadPool(size_t threadCount = defaultThreadCount());
+
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Getters
+    inline size_t getThreadCount() const {
+        return threadCount.load(std::memory_order_relaxed);
+    }
+
+    // Setters
+    /**
+     * @brief Change the number of threads taking part in parallel loops.
+     *
+     * Waits for the running loop (if any) to finish, then restarts the workers.
+     *
+     * @param threadCount The new thread count (0 is treated as 1).
+     * @return A reference to the pool.
+     */
+    ThreadPool& setThreadCount(size_t threadCount);
+
+    // Parallel Execution
+    /**
+     * @brief Split [begin, end) into contiguous chunks and process them in parallel.
+     *
+     * The range is divided into at most getThreadCount() chunks of at least minChunk indices each. Chunk
+     * boundaries only depend on the range, minChunk and the thread count. The call blocks until every chunk has
+     * been processed; the first exception thrown by the body is rethrown on the calling thread.
+     *
+     * @param begin First index.
+     * @param end One past the last index.
+     * @param body Called as body(chunkBegin, chunkEnd) for every chunk.
+     * @param minChunk Minimum number of indices per chunk.
+     */
+    void parallelFor(size_t begin, size_t end, const std::function<void(size_t, size_t)>& body, size_t minChunk = 1);
+
+    /**
+     * @brief The process-wide pool used by the matrix kernels.
+     *
+     * @return The global pool, created on first use with defaultThreadCount() threads.
+     */
+    static ThreadPool& global();
+
+    /**
+     * @brief Number of hardware threads (at least 1).
+     */
+    static size_t defaultThreadCount();
+};
+
+#endif // THREAD_POOL_H
@@ -1,75 +1,157 @@
 #include "../../include/activations/ActivationFunctions.h"
 #include <cmath>
 
+namespace {
+
+// Applies func to every element of a (possibly strided) view, in place
+template <typename T, typename Func>
+void transformInPlace(BasicMatrixView<T> values, Func func) {
+    for (size_t i = 0; i < values.getRows(); ++i) {
+        T* row = values.getPointer() + i * values.getRowStride();
+        if (values.hasContiguousRows()) {
+            for (size_t j = 0; j < values.getCols(); ++j) {
+                row[j] = func(row[j]);
+            }
+        } else {
+            for (size_t j = 0; j < values.getCols(); ++j) {
+                row[j * values.getColStride()] = func(row[j * values.getColStride()]);
+            }
+        }
+    }
+}
+
+// Copies input and transforms the copy with the given activation's in-place kernel
+template <typename T, typename Activation>
+BasicMatrix<T> applyByCopy(const Activation& activation, const BasicMatrix<T>& input) {
+    BasicMatrix<T> output(input);
+    activation.Activation::applyInPlace(output.view());
+    return output;
+}
+
+} // namespace
+
 // -------------------- Sigmoid Activation --------------------
 // Forward Propagation
-Matrix SigmoidActivation::apply(const Matrix& input) const {
-    return input.applyFunction([](double x) { return 1.0 / (1.0 + exp(-x)); });
+template <typename T>
+BasicMatrix<T> BasicSigmoidActivation<T>::apply(const BasicMatrix<T>& input) const {
+    return applyByCopy(*this, input);
+}
+
+template <typename T>
+void BasicSigmoidActivation<T>::applyInPlace(BasicMatrixView<T> values) const {
+    transformInPlace(values, [](T x) { return T(1) / (T(1) + std::exp(-x)); });
 }
 
 // Backward Propagation
-Matrix SigmoidActivation::applyDerivative(const Matrix& input) const {
-    Matrix sigmoidOut = SigmoidActivation().apply(input);
-    Matrix ones(sigmoidOut.getRows(), sigmoidOut.getCols(), "Ones");
-    ones.setData(1.0);
-    return sigmoidOut * (ones - sigmoidOut) ;
+template <typename T>
+BasicMatrix<T> BasicSigmoidActivation<T>::applyDerivative(const BasicMatrix<T>& input) const {
+    BasicMatrix<T> sigmoidOut = BasicSigmoidActivation().apply(input);
+    return sigmoidOut * (1.0 - sigmoidOut);
 }
 
 // -------------------- Swish Activation ----------------------
 // Forward Propagation
-Matrix SwishActivation::apply(const Matrix& input) const {
-    return input * SigmoidActivation::apply(input); 
+template <typename T>
+BasicMatrix<T> BasicSwishActivation<T>::apply(const BasicMatrix<T>& input) const {
+    return applyByCopy(*this, input);
+}
+
+template <typename T>
+void BasicSwishActivation<T>::applyInPlace(BasicMatrixView<T> values) const {
+    transformInPlace(values, [](T x) { return x / (T(1) + std::exp(-x)); });
 }
 
 // Backward Propagation
-Matrix SwishActivation::applyDerivative(const Matrix& input) const {
-    SigmoidActivation sigmoid;
-    return sigmoid.apply(input) + (input * sigmoid.applyDerivative(input)); 
+template <typename T>
+BasicMatrix<T> BasicSwishActivation<T>::applyDerivative(const BasicMatrix<T>& input) const {
+    BasicSigmoidActivation<T> sigmoid;
+    return sigmoid.apply(input) + (input * sigmoid.applyDerivative(input));
 }
 
 // -------------------- ReLU Activation -----------------------
 // Forward Propagation
-Matrix ReLUActivation::apply(const Matrix& input) const {
-    return input.applyFunction([](double x) { return x > 0 ? x : 0; });
+template <typename T>
+BasicMatrix<T> BasicReLUActivation<T>::apply(const BasicMatrix<T>& input) const {
+    return applyByCopy(*this, input);
+}
+
+template <typename T>
+void BasicReLUActivation<T>::applyInPlace(BasicMatrixView<T> values) const {
+    transformInPlace(values, [](T x) { return x > 0 ? x : T(0); });
 }
 
 // Backward Propagation
-Matrix ReLUActivation::applyDerivative(const Matrix& input) const {
-    return input.applyFunction([](double x) { return x > 0 ? 1 : 0; });
+template <typename T>
+BasicMatrix<T> BasicReLUActivation<T>::applyDerivative(const BasicMatrix<T>& input) const {
+    return input.applyFunction([](T x) { return x > 0 ? T(1) : T(0); });
 }
 
 // -------------------- Leaky ReLU Activation -----------------
 // Forward Propagation
-Matrix LeakyReLUActivation::apply(const Matrix& input) const {
-    return input.applyFunction([](double x) { return x > 0 ? x : 0.01 * x; });
+template <typename T>
+BasicMatrix<T> BasicLeakyReLUActivation<T>::apply(const BasicMatrix<T>& input) const {
+    return applyByCopy(*this, input);
+}
+
+template <typename T>
+void BasicLeakyReLUActivation<T>::applyInPlace(BasicMatrixView<T> values) const {
+    transformInPlace(values, [](T x) { return x > 0 ? x : T(0.01) * x; });
 }
 
 // Backward Propagation
-Matrix LeakyReLUActivation::applyDerivative(const Matrix& input) const {
-    return input.applyFunction([](double x) { return x >= 0 ? 1 : 0.01; });
+template <typename T>
+BasicMatrix<T> BasicLeakyReLUActivation<T>::applyDerivative(const BasicMatrix<T>& input) const {
+    return input.applyFunction([](T x) { return x >= 0 ? T(1) : T(0.01); });
 }
 
 // -------------------- Tanh Activation -----------------------
 // Forward Propagation
-Matrix TanhActivation::apply(const Matrix& input) const {
-    return input.applyFunction([](double x) { return tanh(x); });
+template <typename T>
+BasicMatrix<T> BasicTanhActivation<T>::apply(const BasicMatrix<T>& input) const {
+    return applyByCopy(*this, input);
+}
+
+template <typename T>
+void BasicTanhActivation<T>::applyInPlace(BasicMatrixView<T> values) const {
+    transformInPlace(values, [](T x) { return std::tanh(x); });
 }
 
 // Backward Propagation
-Matrix TanhActivation::applyDerivative(const Matrix& input) const {
-    Matrix tanhOut = apply(input);
-    Matrix ones(tanhOut.getRows(), tanhOut.getCols(), "Ones");
-    ones.setData(1.0);
-    return ones - (tanhOut * tanhOut);
+template <typename T>
+BasicMatrix<T> BasicTanhActivation<T>::applyDerivative(const BasicMatrix<T>& input) const {
+    BasicMatrix<T> tanhOut = apply(input);
+    return 1.0 - (tanhOut * tanhOut);
 }
 
 // -------------------- Hard Tanh Activation ------------------
 // Forward Propagation
-Matrix HardTanhActivation::apply(const Matrix& input) const {
-    return input.applyFunction([](double x) { return (x < -1) ? -1 : (x > 1) ? 1 : x; });
+template <typename T>
+BasicMatrix<T> BasicHardTanhActivation<T>::apply(const BasicMatrix<T>& input) const {
+    return applyByCopy(*this, input);
+}
+
+template <typename T>
+void BasicHardTanhActivation<T>::applyInPlace(BasicMatrixView<T> values) const {
+    transformInPlace(values, [](T x) { return (x < -1) ? T(-1) : (x > 1) ? T(1) : x; });
 }
 
 // Backward Propagation
-Matrix HardTanhActivation::applyDerivative(const Matrix& input) const {
-    return input.applyFunction([](double x) { return (x > -1 && x < 1) ? 1 : 0; });
-}
\ No newline at end of file
+template <typename T>
+BasicMatrix<T> BasicHardTanhActivation<T>::applyDerivative(const BasicMatrix<T>& input) const {
+    return input.applyFunction([](T x) { return (x > -1 && x < 1) ? T(1) : T(0); });
+}
+
+// -------------------- Instantiations ------------------------
+template class BasicSigmoidActivation<double>;
+template class BasicSwishActivation<double>;
+template class BasicReLUActivation<double>;
+template class BasicLeakyReLUActivation<double>;
+template class BasicTanhActivation<double>;
+template class BasicHardTanhActivation<double>;
+
+template class BasicSigmoidActivation<float>;
+template class BasicSwishActivation<float>;
+template class BasicReLUActivation<float>;
+template class BasicLeakyReLUActivation<float>;
+template class BasicTanhActivation<float>;
+template class BasicHardTanhActivation<float>;
@@ -1,36 +1,137 @@
 #include "../../include/layers/DenseLayer.h"
 
-// Constructor
-DenseLayer::DenseLayer(size_t inputSize, size_t neurons, std::shared_ptr<ActivationFunction> activationFunc)
-        : StatefulLayer(inputSize, neurons, activationFunc),
+// Constructors
+template <typename T>
+BasicDenseLayer<T>::BasicDenseLayer(size_t inputSize, size_t neurons, std::shared_ptr<BasicActivationFunction<T>> activationFunc)
+        : BasicDenseLayer(inputSize, neurons, std::move(activationFunc), Philox::global()) {}
+
+template <typename T>
+BasicDenseLayer<T>::BasicDenseLayer(size_t inputSize, size_t neurons, std::shared_ptr<BasicActivationFunction<T>> activationFunc,
+                                    Philox& rng)
+        : BasicStatefulLayer<T>(inputSize, neurons, activationFunc),
           weights(neurons, inputSize, "weights"),
           biases(neurons, 1, "biases") {
-    weights.randomize();
-    biases.randomize();
+    weights.randomize(rng);
+    biases.randomize(rng);
 }
 
 // Forward Propagation
-Matrix DenseLayer::forward(const Matrix& input) {
-    inputCache = input;
+template <typename T>
+BasicMatrix<T> BasicDenseLayer<T>::forward(const BasicMatrix<T>& input) {
+    BasicMatrix<T> output(biases.getRows(), input.getCols(), "output");
+    forwardInto(input, output);
+    return output;
+}
 
-    Matrix output = (weights.multiply(input, false) + biases);
+template <typename T>
+void BasicDenseLayer<T>::forwardInto(const BasicMatrix<T>& input, typename BasicMatrix<T>::View output) {
+    if (output.getRows() != biases.getRows() || output.getCols() != input.getCols()) {
+        throw std::invalid_argument("Forward pass: output must be neurons x batch.");
+    }
+    if (!quantizedWeights && !halfWeights) {
+        this->inputCache = input;  // Only backward() reads it, and the inference modes have none
+    }
 
-    return activation->apply(output);
+    // The bias and activation run inside the product, on each tile of the output while it is still in cache
+    if (halfWeights) {
+        kernels::gemm(T(1), *halfWeights, input, T(0), output, this->activation->epilogue(biases.view().getPointer()));
+        return;
+    }
+    if (quantizedWeights) {
+        // Each sample (column of the input) is quantized with its own range
+        const QuantizedMatrix samples(input.view().transpose(), QuantizationGranularity::PerRow,
+                                      QuantizationScheme::Asymmetric);
+        kernels::quantizedGemm(*quantizedWeights, samples, T(0), output,
+                               this->activation->epilogue(biases.view().getPointer()));
+        return;
+    }
+    kernels::gemm(T(1), weights, input, T(0), output, this->activation->epilogue(biases.view().getPointer()));
 }
 
 // Backward Propagation
-Matrix DenseLayer::backward(const Matrix& gradient) {
-    // Compute activation gradient
-    Matrix activationGradient = activation->applyDerivative(forward(inputCache));  // ✅ Now works!
+template <typename T>
+BasicMatrix<T> BasicDenseLayer<T>::backward(const BasicMatrix<T>& gradient) {
+    if (quantizedWeights || halfWeights) {
+        throw std::runtime_error("Backward pass: not available in quantized or half-precision inference mode.");
+    }
 
-    // Compute weight and bias gradients
-    Matrix weightGradient = gradient.multiply(inputCache.transpose(), false);
-    Matrix biasGradient = gradient;
+    // Compute activation gradient
+    BasicMatrix<T> activationGradient = this->activation->applyDerivative(forward(this->inputCache));  // ✅ Now works!
 
-    // Update weights and biases (gradient descent)
-    weights = weights - (weightGradient * 0.01);
-    biases = biases - (biasGradient * 0.01);
+    // Update weights and biases (gradient descent); the weight gradient, gradient * inputᵀ, is accumulated
+    // straight into the weights without forming the transpose or the gradient matrix
+    kernels::gemm(kernels::Transpose::No, kernels::Transpose::Yes, T(-0.01), gradient, this->inputCache,
+                  T(1), weights.view());
+    biases.axpy(-0.01, gradient);
 
     // Compute gradient for previous layer
-    return weights.transpose().multiply(gradient, false);
-}
\ No newline at end of file
+    return weights.multiply(gradient, kernels::Transpose::Yes, kernels::Transpose::No);
+}
+
+// Sparse Forward Propagation
+template <typename T>
+BasicMatrix<T> BasicDenseLayer<T>::forward(const BasicSparseMatrix<T>& input) {
+    if (halfWeights) {
+        throw std::runtime_error("Sparse forward pass: not available with half-precision weights.");
+    }
+    BasicMatrix<T> output = input.leftMultiply(weights);
+
+    // The output is small (neurons x batch), so the bias and activation are a cheap in-place pass; the bias
+    // column is broadcast across the batch rather than expanded
+    output += biases;
+    this->activation->applyInPlace(output.view());
+
+    return output;
+}
+
+// Sparse Backward Propagation
+template <typename T>
+BasicDenseLayer<T>& BasicDenseLayer<T>::backward(const BasicMatrix<T>& gradient, const BasicSparseMatrix<T>& input) {
+    if (halfWeights) {
+        throw std::runtime_error("Backward pass: not available in half-precision inference mode.");
+    }
+    // weights -= 0.01 * gradient * inputᵀ, restricted to the columns of active features
+    input.accumulateProductTransposed(T(-0.01), gradient, weights.view());
+    biases.axpy(-0.01, gradient);
+    return *this;
+}
+
+// Quantized Inference
+template <typename T>
+BasicDenseLayer<T>& BasicDenseLayer<T>::enableQuantization(QuantizationGranularity granularity) {
+    if (halfWeights) {
+        throw std::runtime_error("Quantization: disable half precision first.");
+    }
+    quantizedWeights.emplace(weights.view(), granularity, QuantizationScheme::Symmetric);
+    return *this;
+}
+
+template <typename T>
+BasicDenseLayer<T>& BasicDenseLayer<T>::disableQuantization() {
+    quantizedWeights.reset();
+    return *this;
+}
+
+// Half-Precision Inference
+template <typename T>
+BasicDenseLayer<T>& BasicDenseLayer<T>::enableHalfPrecision(HalfFormat format) {
+    if (quantizedWeights) {
+        throw std::runtime_error("Half precision: disable quantization first.");
+    }
+    disableHalfPrecision();
+    halfWeights.emplace(weights.view(), format);
+    weights = BasicMatrix<T>(0, 0, weights.getName());
+    return *this;
+}
+
+template <typename T>
+BasicDenseLayer<T>& BasicDenseLayer<T>::disableHalfPrecision() {
+    if (halfWeights) {
+        weights = halfWeights->toMatrix<T>(weights.getName());
+        halfWeights.reset();
+    }
+    return *this;
+}
+
+template class BasicDenseLayer<double>;
+template class BasicDenseLayer<float>;
@@ -1,29 +1,38 @@
 #include "../../include/layers/DropoutLayer.h"
 
-// Constructor
-DropoutLayer::DropoutLayer(size_t inputSize, size_t neurons, std::shared_ptr<ActivationFunction> activationFunc, float dropoutRate)
-    : Layer(inputSize, neurons, std::move(activationFunc)), dropoutRate(dropoutRate), rng(std::random_device{}()), dropoutMask(inputSize, 1)  {
-    weights.randomize(-1.0f, 1.0f);
-    biases.randomize(-1.0f, 1.0f);
+// Constructors
+template <typename T>
+BasicDropoutLayer<T>::BasicDropoutLayer(size_t inputSize, size_t neurons, std::shared_ptr<BasicActivationFunction<T>> activationFunc, float dropoutRate)
+    : BasicDropoutLayer(inputSize, neurons, std::move(activationFunc), dropoutRate, Philox::global()) {}
+
+template <typename T>
+BasicDropoutLayer<T>::BasicDropoutLayer(size_t inputSize, size_t neurons, std::shared_ptr<BasicActivationFunction<T>> activationFunc, float dropoutRate,
+                                        Philox& rng)
+    : BasicLayer<T>(inputSize, neurons, std::move(activationFunc)), dropoutRate(dropoutRate), rng(rng.split()), dropoutMask(inputSize, 1)  {
+    this->weights.randomize(rng, -1.0f, 1.0f);
+    this->biases.randomize(rng, -1.0f, 1.0f);
 }
 
 // Forward Propagation
-Matrix DropoutLayer::forward(const Matrix& input) {
-    Matrix output = input;
-    dropoutMask = Matrix(input.getRows(), input.getCols(), "DropoutMask");  // Store active neurons (1 = active, 0 = dropped)
-    std::uniform_real_distribution<float> dist(0.0, 1.0);
+template <typename T>
+BasicMatrix<T> BasicDropoutLayer<T>::forward(const BasicMatrix<T>& input) {
+    BasicMatrix<T> output = input;
+    dropoutMask = BasicMatrix<T>(input.getRows(), input.getCols(), "DropoutMask");  // Store active neurons (1 = active, 0 = dropped)
+    dropoutMask.randomize(rng);  // One uniform draw per neuron, filled in bulk and turned into the mask below
 
-    for (size_t i = 0; i < output.getRows(); ++i) {
-        for (size_t j = 0; j < output.getCols(); ++j) {
-            if (dist(rng) < dropoutRate) {
-                dropoutMask(i, j) = 0.0;  // Mark as dropped
-                output(i, j) = 0.0;  // Disable neuron
-            } else {
-                dropoutMask(i, j) = 1.0;  // Mark as active
-                output(i, j) /= (1.0 - dropoutRate);  // Scale remaining neurons
-            }
-        }
+    // Both matrices are contiguous with the same shape, so one flat pass covers every neuron
+    const T rate = static_cast<T>(dropoutRate);
+    const T scale = T(1) / (T(1) - rate);
+    T* out = output.begin();
+    for (T& mask : dropoutMask) {
+        const bool active = !(mask < rate);
+        mask = active ? T(1) : T(0);  // 1 = active, 0 = dropped
+        *out = active ? *out * scale : T(0);  // Scale remaining neurons, disable dropped ones
+        ++out;
     }
 
     return output;
 }
+
+template class BasicDropoutLayer<double>;
+template class BasicDropoutLayer<float>;
@@ -1,62 +1,148 @@
 #include "../../include/layers/GRULayer.h"
 #include <cmath>
+#include <optional>
 
-// Constructor
-GRULayer::GRULayer(size_t inputSize, size_t hiddenSize)
-        : StatefulLayer(inputSize, hiddenSize, nullptr),
+// Constructors
+template <typename T>
+BasicGRULayer<T>::BasicGRULayer(size_t inputSize, size_t hiddenSize)
+        : BasicGRULayer(inputSize, hiddenSize, Philox::global()) {}
+
+template <typename T>
+BasicGRULayer<T>::BasicGRULayer(size_t inputSize, size_t hiddenSize, Philox& rng)
+        : BasicStatefulLayer<T>(inputSize, hiddenSize, nullptr),
         W_z(inputSize, hiddenSize, "W_z"), W_r(inputSize, hiddenSize, "W_r"), W_h(inputSize, hiddenSize, "W_h"),
         U_z(hiddenSize, hiddenSize, "U_z"), U_r(hiddenSize, hiddenSize, "U_r"), U_h(hiddenSize, hiddenSize, "U_h"),
         b_z(1, hiddenSize, "b_z"), b_r(1, hiddenSize, "b_r"), b_h(1, hiddenSize, "b_h"),
         hiddenState(1, hiddenSize, "hiddenState") {
-    W_z.randomize(); W_r.randomize(); W_h.randomize();
-    U_z.randomize(); U_r.randomize(); U_h.randomize();
-    b_z.randomize(); b_r.randomize(); b_h.randomize();
+    W_z.randomize(rng); W_r.randomize(rng); W_h.randomize(rng);
+    U_z.randomize(rng); U_r.randomize(rng); U_h.randomize(rng);
+    b_z.randomize(rng); b_r.randomize(rng); b_h.randomize(rng);
     hiddenState.setData(0.0);
 }
 
 // Forward Propagation
-Matrix GRULayer::forward(const Matrix& input) {
+template <typename T>
+BasicMatrix<T> BasicGRULayer<T>::forward(const BasicMatrix<T>& input) {
     if (input.isEmpty()) {
         throw std::runtime_error("Forward pass: Input matrix is empty.");
     }
-    inputCache = input;
-    SigmoidActivation sigmoid;
-    TanhActivation tanh;
+    if (!isQuantized() && !isHalfPrecision()) {
+        this->inputCache = input;  // Only backward() reads it, and the inference modes have none
+    }
+    BasicSigmoidActivation<T> sigmoid;
+    BasicTanhActivation<T> tanh;
 
-    Matrix z_t = sigmoid.apply(input.multiply(W_z, false) + hiddenState.multiply(U_z, false) + b_z);
-    Matrix r_t = sigmoid.apply(input.multiply(W_r, false) + hiddenState.multiply(U_r, false) + b_r);
+    // In quantized mode the input is quantized once for all three gates and the hidden state once for the update
+    // and reset gates; only the candidate gate's hiddenState * r_t needs a quantization of its own
+    std::optional<QuantizedMatrix> x, h;
+    if (isQuantized()) {
+        x.emplace(input.view(), QuantizationGranularity::PerRow, QuantizationScheme::Asymmetric);
+        h.emplace(hiddenState.view(), QuantizationGranularity::PerRow, QuantizationScheme::Asymmetric);
+    }
+    auto gate = [&](size_t index, const BasicMatrix<T>& W, const BasicMatrix<T>& hidden,
+                    const std::optional<QuantizedMatrix>& quantizedHidden, const BasicMatrix<T>& U,
+                    const BasicMatrix<T>& b, const BasicActivationFunction<T>& activation) {
+        if (x) {
+            return this->gate(*x, quantizedWeights[index], *quantizedHidden, quantizedWeights[3 + index], b,
+                              activation);
+        }
+        if (isHalfPrecision()) {
+            return this->gate(input, halfWeights[index], hidden, halfWeights[3 + index], b, activation);
+        }
+        return this->gate(input, W, hidden, U, b, activation);
+    };
 
-    Matrix h_tilde = tanh.apply(input.multiply(W_h, false) + (hiddenState * r_t).multiply(U_h, false) + b_h);
+    BasicMatrix<T> z_t = gate(0, W_z, hiddenState, h, U_z, b_z, sigmoid);
+    BasicMatrix<T> r_t = gate(1, W_r, hiddenState, h, U_r, b_r, sigmoid);
 
-    Matrix ones(1, hiddenState.getCols(), "Ones");
-    ones.setData(1.0);
+    const BasicMatrix<T> resetHidden = hiddenState * r_t;
+    std::optional<QuantizedMatrix> quantizedResetHidden;
+    if (x) {
+        quantizedResetHidden.emplace(resetHidden.view(), QuantizationGranularity::PerRow,
+                                     QuantizationScheme::Asymmetric);
+    }
+    BasicMatrix<T> h_tilde = gate(2, W_h, resetHidden, quantizedResetHidden, U_h, b_h, tanh);
 
-    hiddenState = ((ones - z_t) * hiddenState) + (z_t * h_tilde);
+    hiddenState = ((1.0 - z_t) * hiddenState) + (z_t * h_tilde);
     return hiddenState;
 }
 
 // Backward Propagation
-Matrix GRULayer::backward(const Matrix& gradOutput) {
-    if (inputCache.isEmpty(true)) {
+template <typename T>
+BasicMatrix<T> BasicGRULayer<T>::backward(const BasicMatrix<T>& gradOutput) {
+    if (isQuantized() || isHalfPrecision()) {
+        throw std::runtime_error("Backward pass: not available in quantized or half-precision inference mode.");
+    }
+    if (this->inputCache.isEmpty(true)) {
         throw std::runtime_error("Backward pass: forward() must be called before backward().");
     }
 
-    SigmoidActivation sigmoid;
-    TanhActivation tanh;
+    BasicSigmoidActivation<T> sigmoid;
+    BasicTanhActivation<T> tanh;
 
-    Matrix z_t = sigmoid.apply(inputCache.multiply(W_z, false) + hiddenState.multiply(U_z, false) + b_z);
-    Matrix r_t = sigmoid.apply(inputCache.multiply(W_r, false) + hiddenState.multiply(U_r, false) + b_r);
-    Matrix h_tilde = tanh.apply(inputCache.multiply(W_h, false) + (hiddenState * r_t).multiply(U_h, false) + b_h);
+    BasicMatrix<T> z_t = this->gate(this->inputCache, W_z, hiddenState, U_z, b_z, sigmoid);
+    BasicMatrix<T> r_t = this->gate(this->inputCache, W_r, hiddenState, U_r, b_r, sigmoid);
+    BasicMatrix<T> h_tilde = this->gate(this->inputCache, W_h, (hiddenState * r_t).eval(), U_h, b_h, tanh);
 
     // Compute gradients
-    Matrix dH = gradOutput * (Matrix(1, hiddenState.getCols(), "Ones").setData(1.0) - z_t);
-    Matrix dZ = gradOutput * (h_tilde - hiddenState);
-    Matrix dR = dH * (hiddenState.multiply(U_h, false));
+    BasicMatrix<T> dH = gradOutput * (1.0 - z_t);
+    BasicMatrix<T> dZ = gradOutput * (h_tilde - hiddenState);
+    BasicMatrix<T> dR = dH * (hiddenState.multiply(U_h, false));
+
+    // Weight updates: W -= 0.01 * inputᵀ * dGate, accumulated in place with the input read untransposed
+    using kernels::Transpose;
+    kernels::gemm(Transpose::Yes, Transpose::No, T(-0.01), this->inputCache, dZ, T(1), W_z.view());
+    kernels::gemm(Transpose::Yes, Transpose::No, T(-0.01), this->inputCache, dR, T(1), W_r.view());
+    kernels::gemm(Transpose::Yes, Transpose::No, T(-0.01), this->inputCache, dH, T(1), W_h.view());
+
+    return dH.multiply(W_z, Transpose::No, Transpose::Yes);
+}
+
+// Quantized Inference
+template <typename T>
+BasicGRULayer<T>& BasicGRULayer<T>::enableQuantization(QuantizationGranularity granularity) {
+    if (isHalfPrecision()) {
+        throw std::runtime_error("Quantization: disable half precision first.");
+    }
+    quantizedWeights.clear();
+    for (const BasicMatrix<T>* weights : weightMatrices()) {
+        quantizedWeights.emplace_back(weights->view().transpose(), granularity, QuantizationScheme::Symmetric);
+    }
+    return *this;
+}
 
-    // Weight updates
-    W_z = W_z - (inputCache.transpose().multiply(dZ, false) * 0.01);
-    W_r = W_r - (inputCache.transpose().multiply(dR, false) * 0.01);
-    W_h = W_h - (inputCache.transpose().multiply(dH, false) * 0.01);
+template <typename T>
+BasicGRULayer<T>& BasicGRULayer<T>::disableQuantization() {
+    quantizedWeights.clear();
+    return *this;
+}
+
+// Half-Precision Inference
+template <typename T>
+BasicGRULayer<T>& BasicGRULayer<T>::enableHalfPrecision(HalfFormat format) {
+    if (isQuantized()) {
+        throw std::runtime_error("Half precision: disable quantization first.");
+    }
+    disableHalfPrecision();
+    for (BasicMatrix<T>* weights : weightMatrices()) {
+        halfWeights.emplace_back(weights->view(), format);
+        *weights = BasicMatrix<T>(0, 0, weights->getName());
+    }
+    return *this;
+}
 
-    return dH.multiply(W_z.transpose(), false);
+template <typename T>
+BasicGRULayer<T>& BasicGRULayer<T>::disableHalfPrecision() {
+    if (!isHalfPrecision()) {
+        return *this;
+    }
+    size_t index = 0;
+    for (BasicMatrix<T>* weights : weightMatrices()) {
+        *weights = halfWeights[index++].toMatrix<T>(weights->getName());
+    }
+    halfWeights.clear();
+    return *this;
 }
+
+template class BasicGRULayer<double>;
+template class BasicGRULayer<float>;
@@ -1,9 +1,15 @@
 #include "../../include/layers/LSTMLayer.h"
 #include <cmath>
+#include <optional>
 
-// Constructor
-LSTMLayer::LSTMLayer(size_t inputSize, size_t hiddenSize)
-        : StatefulLayer(inputSize, hiddenSize, nullptr),
+// Constructors
+template <typename T>
+BasicLSTMLayer<T>::BasicLSTMLayer(size_t inputSize, size_t hiddenSize)
+        : BasicLSTMLayer(inputSize, hiddenSize, Philox::global()) {}
+
+template <typename T>
+BasicLSTMLayer<T>::BasicLSTMLayer(size_t inputSize, size_t hiddenSize, Philox& rng)
+        : BasicStatefulLayer<T>(inputSize, hiddenSize, nullptr),
         W_f(inputSize, hiddenSize, "W_f"), W_i(inputSize, hiddenSize, "W_i"),
         W_c(inputSize, hiddenSize, "W_c"), W_o(inputSize, hiddenSize, "W_o"),
         U_f(hiddenSize, hiddenSize, "U_f"), U_i(hiddenSize, hiddenSize, "U_i"),
@@ -12,45 +18,66 @@ LSTMLayer::LSTMLayer(size_t inputSize, size_t hiddenSize)
         b_c(1, hiddenSize, "b_c"), b_o(1, hiddenSize, "b_o"),
         hiddenState(1, hiddenSize, "hiddenState"),
         cellState(1, hiddenSize, "cellState") {
-    W_f.randomize(); W_i.randomize(); W_c.randomize(); W_o.randomize();
-    U_f.randomize(); U_i.randomize(); U_c.randomize(); U_o.randomize();
-    b_f.randomize(); b_i.randomize(); b_c.randomize(); b_o.randomize();
+    W_f.randomize(rng); W_i.randomize(rng); W_c.randomize(rng); W_o.randomize(rng);
+    U_f.randomize(rng); U_i.randomize(rng); U_c.randomize(rng); U_o.randomize(rng);
+    b_f.randomize(rng); b_i.randomize(rng); b_c.randomize(rng); b_o.randomize(rng);
     hiddenState.setData(0.0);
     cellState.setData(0.0);
 }
 
 // State Management
-LSTMLayer& LSTMLayer::resetStates() {
+template <typename T>
+BasicLSTMLayer<T>& BasicLSTMLayer<T>::resetStates() {
     hiddenState.setData(0.0);
     cellState.setData(0.0);
-    clearInputCache();
+    this->clearInputCache();
     return *this;
 }
 
 // Forward Propagation
-Matrix LSTMLayer::forward(const Matrix& input) {
+template <typename T>
+BasicMatrix<T> BasicLSTMLayer<T>::forward(const BasicMatrix<T>& input) {
     if (input.isEmpty()) {
         throw std::runtime_error("Forward pass: Input matrix is empty.");
     }
-    inputCache = input;
+    if (!isQuantized() && !isHalfPrecision()) {
+        this->inputCache = input;  // Only backward() reads it, and the inference modes have none
+    }
+
+    BasicSigmoidActivation<T> sigmoid;
+    BasicTanhActivation<T> tanh;
 
-    SigmoidActivation sigmoid;
-    TanhActivation tanh;
+    // In quantized mode the input and hidden state are quantized once and shared by the four gates
+    std::optional<QuantizedMatrix> x, h;
+    if (isQuantized()) {
+        x.emplace(input.view(), QuantizationGranularity::PerRow, QuantizationScheme::Asymmetric);
+        h.emplace(hiddenState.view(), QuantizationGranularity::PerRow, QuantizationScheme::Asymmetric);
+    }
+    auto gate = [&](size_t index, const BasicMatrix<T>& W, const BasicMatrix<T>& U, const BasicMatrix<T>& b,
+                    const BasicActivationFunction<T>& activation) {
+        if (x) {
+            return this->gate(*x, quantizedWeights[index], *h, quantizedWeights[4 + index], b, activation);
+        }
+        if (isHalfPrecision()) {
+            return this->gate(input, halfWeights[index], hiddenState, halfWeights[4 + index], b, activation);
+        }
+        return this->gate(input, W, hiddenState, U, b, activation);
+    };
 
     // Forget Gate
-    Matrix f_t = sigmoid.apply(input.multiply(W_f, false) + hiddenState.multiply(U_f, false) + b_f);
+    BasicMatrix<T> f_t = gate(0, W_f, U_f, b_f, sigmoid);
     
     // Input Gate
-    Matrix i_t = sigmoid.apply(input.multiply(W_i, false) + hiddenState.multiply(U_i, false) + b_i);
+    BasicMatrix<T> i_t = gate(1, W_i, U_i, b_i, sigmoid);
     
     // Candidate Cell State
-    Matrix c_tilde = tanh.apply(input.multiply(W_c, false) + hiddenState.multiply(U_c, false) + b_c);
+    BasicMatrix<T> c_tilde = gate(2, W_c, U_c, b_c, tanh);
     
     // Cell State
     cellState = (f_t * cellState) + (i_t * c_tilde);
     
     // Output Gate
-    Matrix o_t = sigmoid.apply(input.multiply(W_o, false) + hiddenState.multiply(U_o, false) + b_o);
+    BasicMatrix<T> o_t = gate(3, W_o, U_o, b_o, sigmoid);
     
     // Hidden State
     hiddenState = o_t * tanh.apply(cellState);
@@ -59,8 +86,12 @@ Matrix LSTMLayer::forward(const Matrix& input) {
 }
 
 // Backward Propagation
-Matrix LSTMLayer::backward(const Matrix& gradOutput) {
-    if (inputCache.isEmpty(true)) {
+template <typename T>
+BasicMatrix<T> BasicLSTMLayer<T>::backward(const BasicMatrix<T>& gradOutput) {
+    if (isQuantized() || isHalfPrecision()) {
+        throw std::runtime_error("Backward pass: not available in quantized or half-precision inference mode.");
+    }
+    if (this->inputCache.isEmpty(true)) {
         throw std::runtime_error("Backward pass: forward() must be called before backward().");
     }
     if (hiddenState.isEmpty(true) || cellState.isEmpty(true)) {
@@ -69,27 +100,77 @@ Matrix LSTMLayer::backward(const Matrix& gradOutput) {
     if (gradOutput.isEmpty(true)) {
         throw std::runtime_error("Backward pass: gradOutput cannot be empty.");
     }
-    if (gradOutput.getCols() != W_f.transpose().getRows()) {
+    if (gradOutput.getCols() != W_f.getCols()) {
         throw std::runtime_error("Backward pass: gradOutput dimensions do not match transposed weight dimensions.");
     }
 
-    SigmoidActivation sigmoid;
-    TanhActivation tanh;
+    BasicSigmoidActivation<T> sigmoid;
+    BasicTanhActivation<T> tanh;
 
-    Matrix dO = gradOutput * tanh.apply(cellState);
-    Matrix dC = gradOutput * hiddenState;
-    Matrix dF = gradOutput * cellState;
-    Matrix dI = gradOutput * dC;
+    BasicMatrix<T> dO = gradOutput * tanh.apply(cellState);
+    BasicMatrix<T> dC = gradOutput * hiddenState;
+    BasicMatrix<T> dF = gradOutput * cellState;
+    BasicMatrix<T> dI = gradOutput * dC;
 
     try {
-        W_o = W_o - (inputCache.transpose().multiply(dO, false) * 0.01);
-        W_f = W_f - (inputCache.transpose().multiply(dF, false) * 0.01);
-        W_i = W_i - (inputCache.transpose().multiply(dI, false) * 0.01);
-        W_c = W_c - (inputCache.transpose().multiply(dC, false) * 0.01);
+        // W -= 0.01 * inputᵀ * dGate, accumulated in place with the input read untransposed
+        using kernels::Transpose;
+        kernels::gemm(Transpose::Yes, Transpose::No, T(-0.01), this->inputCache, dO, T(1), W_o.view());
+        kernels::gemm(Transpose::Yes, Transpose::No, T(-0.01), this->inputCache, dF, T(1), W_f.view());
+        kernels::gemm(Transpose::Yes, Transpose::No, T(-0.01), this->inputCache, dI, T(1), W_i.view());
+        kernels::gemm(Transpose::Yes, Transpose::No, T(-0.01), this->inputCache, dC, T(1), W_c.view());
     } catch (const std::exception& e) {
         throw std::runtime_error(std::string("Backward pass error: ") + e.what());
     }
 
-    return gradOutput.multiply(W_f.transpose(), false);
+    return gradOutput.multiply(W_f, kernels::Transpose::No, kernels::Transpose::Yes);
+}
+
+// Quantized Inference
+template <typename T>
+BasicLSTMLayer<T>& BasicLSTMLayer<T>::enableQuantization(QuantizationGranularity granularity) {
+    if (isHalfPrecision()) {
+        throw std::runtime_error("Quantization: disable half precision first.");
+    }
+    quantizedWeights.clear();
+    for (const BasicMatrix<T>* weights : weightMatrices()) {
+        quantizedWeights.emplace_back(weights->view().transpose(), granularity, QuantizationScheme::Symmetric);
+    }
+    return *this;
+}
+
+template <typename T>
+BasicLSTMLayer<T>& BasicLSTMLayer<T>::disableQuantization() {
+    quantizedWeights.clear();
+    return *this;
+}
+
+// Half-Precision Inference
+template <typename T>
+BasicLSTMLayer<T>& BasicLSTMLayer<T>::enableHalfPrecision(HalfFormat format) {
+    if (isQuantized()) {
+        throw std::runtime_error("Half precision: disable quantization first.");
+    }
+    disableHalfPrecision();
+    for (BasicMatrix<T>* weights : weightMatrices()) {
+        halfWeights.emplace_back(weights->view(), format);
+        *weights = BasicMatrix<T>(0, 0, weights->getName());
+    }
+    return *this;
+}
+
+template <typename T>
+BasicLSTMLayer<T>& BasicLSTMLayer<T>::disableHalfPrecision() {
+    if (!isHalfPrecision()) {
+        return *this;
+    }
+    size_t index = 0;
+    for (BasicMatrix<T>* weights : weightMatrices()) {
+        *weights = halfWeights[index++].toMatrix<T>(weights->getName());
+    }
+    halfWeights.clear();
+    return *this;
 }
 
+template class BasicLSTMLayer<double>;
+template class BasicLSTMLayer<float>;
@@ -1,16 +1,19 @@
 #include "../../include/layers/Layer.h"
 
 // Getters
-const Matrix& Layer::getWeights() const {
+template <typename T>
+const BasicMatrix<T>& BasicLayer<T>::getWeights() const {
     return weights;
 }
 
-const Matrix& Layer::getBiases() const {
+template <typename T>
+const BasicMatrix<T>& BasicLayer<T>::getBiases() const {
     return biases;
 }
 
 // Setters
-Layer& Layer::setWeights(const Matrix& w) {
+template <typename T>
+BasicLayer<T>& BasicLayer<T>::setWeights(const BasicMatrix<T>& w) {
     if (w.getRows() != weights.getRows() || w.getCols() != weights.getCols()) {
         throw std::invalid_argument("Weight matrix dimensions do not match.");
     }
@@ -18,10 +21,14 @@ Layer& Layer::setWeights(const Matrix& w) {
     return *this;
 }
 
-Layer& Layer::setBiases(const Matrix& b) {
+template <typename T>
+BasicLayer<T>& BasicLayer<T>::setBiases(const BasicMatrix<T>& b) {
     if (b.getRows() != biases.getRows() || b.getCols() != biases.getCols()) {
         throw std::invalid_argument("Bias matrix dimensions do not match.");
     }
     biases = b;
     return *this;
-}
\ No newline at end of file
+}
+
+template class BasicLayer<double>;
+template class BasicLayer<float>;
@@ -1,38 +1,42 @@
 #include "../../include/layers/RNNLayer.h"
 #include <cmath>
 
-// Constructor
-RNNLayer::RNNLayer(size_t inputSize, size_t hiddenSize)
-        : StatefulLayer(inputSize, hiddenSize, nullptr),
+// Constructors
+template <typename T>
+BasicRNNLayer<T>::BasicRNNLayer(size_t inputSize, size_t hiddenSize)
+        : BasicRNNLayer(inputSize, hiddenSize, Philox::global()) {}
+
+template <typename T>
+BasicRNNLayer<T>::BasicRNNLayer(size_t inputSize, size_t hiddenSize, Philox& rng)
+        : BasicStatefulLayer<T>(inputSize, hiddenSize, nullptr),
         W_x(inputSize, hiddenSize, "W_x"),
         W_h(hiddenSize, hiddenSize, "W_h"),
         b(1, hiddenSize, "b"),
         hiddenState(1, hiddenSize, "hiddenState") {
-    W_x.randomize();
-    W_h.randomize();
-    b.randomize();
+    W_x.randomize(rng);
+    W_h.randomize(rng);
+    b.randomize(rng);
     hiddenState.setData(0.0);
 }
 
 // Forward Propagation
-Matrix RNNLayer::forward(const Matrix& input) {
-    inputCache = input; 
+template <typename T>
+BasicMatrix<T> BasicRNNLayer<T>::forward(const BasicMatrix<T>& input) {
+    this->inputCache = input; 
 
     // Compute new hidden state
-    hiddenState = (input.multiply(W_x, false) + hiddenState.multiply(W_h, false) + b).applyFunction([](float x) {
-        return tanh(x);
-    });
+    hiddenState = this->gate(input, W_x, hiddenState, W_h, b, BasicTanhActivation<T>());
 
     return hiddenState; // Output is also the hidden state
 }
 
 // Backward Propagation
-Matrix RNNLayer::backward(const Matrix& gradOutput) {
-    Matrix ones(hiddenState.getRows(), hiddenState.getCols(), "Ones");
-    ones.setData(1.0); 
-
-    Matrix squaredHidden = hiddenState * hiddenState;
-    Matrix dHidden = gradOutput * (ones - squaredHidden);
+template <typename T>
+BasicMatrix<T> BasicRNNLayer<T>::backward(const BasicMatrix<T>& gradOutput) {
+    BasicMatrix<T> dHidden = gradOutput * (1.0 - hiddenState * hiddenState);
 
-    return dHidden.multiply(W_x.transpose(), false);
+    return dHidden.multiply(W_x, kernels::Transpose::No, kernels::Transpose::Yes);
 }
+
+template class BasicRNNLayer<double>;
+template class BasicRNNLayer<float>;
@@ -0,0 +1,295 @@
+#include "../../include/matrix/ElementWise.h"
+#include "../../include/matrix/Simd.h"
+
+namespace kernels {
+
+namespace {
+
+// Each operation provides a scalar form plus one overload per vector register type
+struct AddOp {
+    template <typename T>
+    static T scalar(T a, T b) { return a + b; }
+#ifdef NN_SIMD_X86
+    static __m128d vec(__m128d a, __m128d b) { return _mm_add_pd(a, b); }
+    static __m128 vec(__m128 a, __m128 b) { return _mm_add_ps(a, b); }
+    NN_TARGET_AVX2 static __m256d vec(__m256d a, __m256d b) { return _mm256_add_pd(a, b); }
+    NN_TARGET_AVX2 static __m256 vec(__m256 a, __m256 b) { return _mm256_add_ps(a, b); }
+    NN_TARGET_AVX512 static __m512d vec(__m512d a, __m512d b) { return _mm512_add_pd(a, b); }
+    NN_TARGET_AVX512 static __m512 vec(__m512 a, __m512 b) { return _mm512_add_ps(a, b); }
+#endif
+};
+
+struct SubtractOp {
+    template <typename T>
+    static T scalar(T a, T b) { return a - b; }
+#ifdef NN_SIMD_X86
+    static __m128d vec(__m128d a, __m128d b) { return _mm_sub_pd(a, b); }
+    static __m128 vec(__m128 a, __m128 b) { return _mm_sub_ps(a, b); }
+    NN_TARGET_AVX2 static __m256d vec(__m256d a, __m256d b) { return _mm256_sub_pd(a, b); }
+    NN_TARGET_AVX2 static __m256 vec(__m256 a, __m256 b) { return _mm256_sub_ps(a, b); }
+    NN_TARGET_AVX512 static __m512d vec(__m512d a, __m512d b) { return _mm512_sub_pd(a, b); }
+    NN_TARGET_AVX512 static __m512 vec(__m512 a, __m512 b) { return _mm512_sub_ps(a, b); }
+#endif
+};
+
+struct MultiplyOp {
+    template <typename T>
+    static T scalar(T a, T b) { return a * b; }
+#ifdef NN_SIMD_X86
+    static __m128d vec(__m128d a, __m128d b) { return _mm_mul_pd(a, b); }
+    static __m128 vec(__m128 a, __m128 b) { return _mm_mul_ps(a, b); }
+    NN_TARGET_AVX2 static __m256d vec(__m256d a, __m256d b) { return _mm256_mul_pd(a, b); }
+    NN_TARGET_AVX2 static __m256 vec(__m256 a, __m256 b) { return _mm256_mul_ps(a, b); }
+    NN_TARGET_AVX512 static __m512d vec(__m512d a, __m512d b) { return _mm512_mul_pd(a, b); }
+    NN_TARGET_AVX512 static __m512 vec(__m512 a, __m512 b) { return _mm512_mul_ps(a, b); }
+#endif
+};
+
+// -------------------- Binary kernels ------------------------
+template <typename Op, typename T>
+void binaryScalar(size_t n, const T* a, const T* b, T* out) {
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = Op::scalar(a[i], b[i]);
+    }
+}
+
+#ifdef NN_SIMD_X86
+template <typename Op, typename T>
+void binarySse2(size_t n, const T* a, const T* b, T* out) {
+    using V = simd::Sse2<T>;
+    constexpr size_t L = V::lanes;
+    size_t i = 0;
+    for (; i + L <= n; i += L) {
+        V::store(out + i, Op::vec(V::load(a + i), V::load(b + i)));
+    }
+    for (; i < n; ++i) {
+        out[i] = Op::scalar(a[i], b[i]);
+    }
+}
+
+template <typename Op, typename T>
+NN_TARGET_AVX2 void binaryAvx2(size_t n, const T* a, const T* b, T* out) {
+    using V = simd::Avx2<T>;
+    constexpr size_t L = V::lanes;
+    size_t i = 0;
+    for (; i + 2 * L <= n; i += 2 * L) {
+        const auto r0 = Op::vec(V::load(a + i), V::load(b + i));
+        const auto r1 = Op::vec(V::load(a + i + L), V::load(b + i + L));
+        V::store(out + i, r0);
+        V::store(out + i + L, r1);
+    }
+    for (; i + L <= n; i += L) {
+        V::store(out + i, Op::vec(V::load(a + i), V::load(b + i)));
+    }
+    for (; i < n; ++i) {
+        out[i] = Op::scalar(a[i], b[i]);
+    }
+}
+
+template <typename Op, typename T>
+NN_TARGET_AVX512 void binaryAvx512(size_t n, const T* a, const T* b, T* out) {
+    using V = simd::Avx512<T>;
+    constexpr size_t L = V::lanes;
+    size_t i = 0;
+    for (; i + L <= n; i += L) {
+        V::store(out + i, Op::vec(V::load(a + i), V::load(b + i)));
+    }
+    if (i < n) {
+        // Masked loads/stores handle the remainder without a scalar loop
+        const auto mask = V::tailMask(n - i);
+        V::maskStore(out + i, mask, Op::vec(V::maskLoad(mask, a + i), V::maskLoad(mask, b + i)));
+    }
+}
+#endif
+
+template <typename Op, typename T>
+void dispatchBinary(size_t n, const T* a, const T* b, T* out) {
+    switch (simd::activeLevel()) {
+#ifdef NN_SIMD_X86
+        case simd::Level::AVX512:
+            return binaryAvx512<Op>(n, a, b, out);
+        case simd::Level::AVX2:
+            return binaryAvx2<Op>(n, a, b, out);
+        case simd::Level::SSE2:
+            return binarySse2<Op>(n, a, b, out);
+#endif
+        default:
+            return binaryScalar<Op>(n, a, b, out);
+    }
+}
+
+// -------------------- Scalar broadcast kernels --------------
+template <typename T>
+void scaleScalar(size_t n, const T* a, T scalar, T* out) {
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = a[i] * scalar;
+    }
+}
+
+#ifdef NN_SIMD_X86
+template <typename T>
+void scaleSse2(size_t n, const T* a, T scalar, T* out) {
+    using V = simd::Sse2<T>;
+    const auto s = V::set1(scalar);
+    size_t i = 0;
+    for (; i + V::lanes <= n; i += V::lanes) {
+        V::store(out + i, V::mul(V::load(a + i), s));
+    }
+    for (; i < n; ++i) {
+        out[i] = a[i] * scalar;
+    }
+}
+
+template <typename T>
+NN_TARGET_AVX2 void scaleAvx2(size_t n, const T* a, T scalar, T* out) {
+    using V = simd::Avx2<T>;
+    const auto s = V::set1(scalar);
+    size_t i = 0;
+    for (; i + V::lanes <= n; i += V::lanes) {
+        V::store(out + i, V::mul(V::load(a + i), s));
+    }
+    for (; i < n; ++i) {
+        out[i] = a[i] * scalar;
+    }
+}
+
+template <typename T>
+NN_TARGET_AVX512 void scaleAvx512(size_t n, const T* a, T scalar, T* out) {
+    using V = simd::Avx512<T>;
+    const auto s = V::set1(scalar);
+    size_t i = 0;
+    for (; i + V::lanes <= n; i += V::lanes) {
+        V::store(out + i, V::mul(V::load(a + i), s));
+    }
+    if (i < n) {
+        const auto mask = V::tailMask(n - i);
+        V::maskStore(out + i, mask, V::mul(V::maskLoad(mask, a + i), s));
+    }
+}
+#endif
+
+template <typename T>
+void dispatchScale(size_t n, const T* a, T scalar, T* out) {
+    switch (simd::activeLevel()) {
+#ifdef NN_SIMD_X86
+        case simd::Level::AVX512:
+            return scaleAvx512(n, a, scalar, out);
+        case simd::Level::AVX2:
+            return scaleAvx2(n, a, scalar, out);
+        case simd::Level::SSE2:
+            return scaleSse2(n, a, scalar, out);
+#endif
+        default:
+            return scaleScalar(n, a, scalar, out);
+    }
+}
+
+// -------------------- Scaled accumulation -----------------
+template <typename T>
+void axpyScalar(size_t n, T alpha, const T* x, T* y) {
+    for (size_t i = 0; i < n; ++i) {
+        y[i] += alpha * x[i];
+    }
+}
+
+#ifdef NN_SIMD_X86
+template <typename T>
+void axpySse2(size_t n, T alpha, const T* x, T* y) {
+    using V = simd::Sse2<T>;
+    const auto a = V::set1(alpha);
+    size_t i = 0;
+    for (; i + V::lanes <= n; i += V::lanes) {
+        V::store(y + i, V::fmadd(a, V::load(x + i), V::load(y + i)));
+    }
+    for (; i < n; ++i) {
+        y[i] += alpha * x[i];
+    }
+}
+
+template <typename T>
+NN_TARGET_AVX2 void axpyAvx2(size_t n, T alpha, const T* x, T* y) {
+    using V = simd::Avx2<T>;
+    const auto a = V::set1(alpha);
+    size_t i = 0;
+    for (; i + V::lanes <= n; i += V::lanes) {
+        V::store(y + i, V::fmadd(a, V::load(x + i), V::load(y + i)));
+    }
+    for (; i < n; ++i) {
+        y[i] += alpha * x[i];
+    }
+}
+
+template <typename T>
+NN_TARGET_AVX512 void axpyAvx512(size_t n, T alpha, const T* x, T* y) {
+    using V = simd::Avx512<T>;
+    const auto a = V::set1(alpha);
+    size_t i = 0;
+    for (; i + V::lanes <= n; i += V::lanes) {
+        V::store(y + i, V::fmadd(a, V::load(x + i), V::load(y + i)));
+    }
+    if (i < n) {
+        const auto mask = V::tailMask(n - i);
+        V::maskStore(y + i, mask, V::fmadd(a, V::maskLoad(mask, x + i), V::maskLoad(mask, y + i)));
+    }
+}
+#endif
+
+template <typename T>
+void dispatchAxpy(size_t n, T alpha, const T* x, T* y) {
+    switch (simd::activeLevel()) {
+#ifdef NN_SIMD_X86
+        case simd::Level::AVX512:
+            return axpyAvx512(n, alpha, x, y);
+        case simd::Level::AVX2:
+            return axpyAvx2(n, alpha, x, y);
+        case simd::Level::SSE2:
+            return axpySse2(n, alpha, x, y);
+#endif
+        default:
+            return axpyScalar(n, alpha, x, y);
+    }
+}
+
+} // namespace
+
+void add(size_t n, const double* a, const double* b, double* out) {
+    dispatchBinary<AddOp>(n, a, b, out);
+}
+
+void add(size_t n, const float* a, const float* b, float* out) {
+    dispatchBinary<AddOp>(n, a, b, out);
+}
+
+void subtract(size_t n, const double* a, const double* b, double* out) {
+    dispatchBinary<SubtractOp>(n, a, b, out);
+}
+
+void subtract(size_t n, const float* a, const float* b, float* out) {
+    dispatchBinary<SubtractOp>(n, a, b, out);
+}
+
+void multiply(size_t n, const double* a, const double* b, double* out) {
+    dispatchBinary<MultiplyOp>(n, a, b, out);
+}
+
+void multiply(size_t n, const float* a, const float* b, float* out) {
+    dispatchBinary<MultiplyOp>(n, a, b, out);
+}
+
+void scale(size_t n, const double* a, double scalar, double* out) {
+    dispatchScale(n, a, scalar, out);
+}
+
+void scale(size_t n, const float* a, float scalar, float* out) {
+    dispatchScale(n, a, scalar, out);
+}
+
+void axpy(size_t n, double alpha, const double* x, double* y) {
+    dispatchAxpy(n, alpha, x, y);
+}
+
+void axpy(size_t n, float alpha, const float* x, float* y) {
+    dispatchAxpy(n, alpha, x, y);
+}
+
+} // namespace kernels
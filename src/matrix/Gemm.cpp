@@ -0,0 +1,535 @@
+#include "../../include/matrix/Gemm.h"
+#include "../../include/matrix/Simd.h"
+#include "../../include/parallel/ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+namespace kernels {
+
+namespace {
+
+// Blocking parameters (in elements). A KC x NR sliver of B stays in L1, an MC x KC block of A in L2
+// and a KC x NC panel of B in L3. MC and NC must be multiples of every micro-kernel's MR and NR.
+constexpr size_t KC = 256;
+constexpr size_t MC = 128;
+constexpr size_t NC = 2048;
+
+// Largest register tile of any micro-kernel (AVX-512 float: 8 x 32)
+constexpr size_t MAX_TILE = 8 * 32;
+
+// Products with fewer multiply-adds than this are not worth packing
+constexpr size_t SMALL_GEMM_WORK = 32 * 32 * 32;
+
+// Products with fewer multiply-adds than this stay on the calling thread
+std::atomic<size_t> parallelThreshold{128 * 128 * 128};
+
+// Computes a full MR x NR tile: C = alpha * (packed A sliver) * (packed B sliver) + beta * C
+template <typename T>
+using MicroKernel = void (*)(size_t kc, const T* a, const T* b, T* c, size_t ldc, T alpha, T beta);
+
+template <typename T>
+struct KernelConfig {
+    size_t mr;
+    size_t nr;
+    MicroKernel<T> kernel;
+};
+
+// -------------------- Micro-kernels -------------------------
+// The SIMD kernels hold an MR x (2 registers) tile in registers, so NR is twice the lane count:
+// 16 doubles or 32 floats per row with AVX-512, 8 or 16 with AVX2 and 4 or 8 with SSE2.
+template <typename T, size_t MR, size_t NR>
+void microKernelScalar(size_t kc, const T* a, const T* b, T* c, size_t ldc, T alpha, T beta) {
+    T acc[MR][NR] = {};
+    for (size_t p = 0; p < kc; ++p, a += MR, b += NR) {
+        for (size_t i = 0; i < MR; ++i) {
+            for (size_t j = 0; j < NR; ++j) {
+                acc[i][j] += a[i] * b[j];
+            }
+        }
+    }
+    for (size_t i = 0; i < MR; ++i) {
+        T* row = c + i * ldc;
+        for (size_t j = 0; j < NR; ++j) {
+            row[j] = (beta == T(0)) ? alpha * acc[i][j] : alpha * acc[i][j] + beta * row[j];
+        }
+    }
+}
+
+#ifdef NN_SIMD_X86
+// 4 x (2 * lanes) tile held in 8 SSE2 registers
+template <typename T>
+void microKernelSse2(size_t kc, const T* a, const T* b, T* c, size_t ldc, T alpha, T beta) {
+    using V = simd::Sse2<T>;
+    constexpr size_t L = V::lanes;
+    typename V::Reg acc[4][2];
+    for (size_t i = 0; i < 4; ++i) {
+        acc[i][0] = V::zero();
+        acc[i][1] = V::zero();
+    }
+    for (size_t p = 0; p < kc; ++p, a += 4, b += 2 * L) {
+        const auto b0 = V::load(b);
+        const auto b1 = V::load(b + L);
+#pragma GCC unroll 4
+        for (size_t i = 0; i < 4; ++i) {
+            const auto ai = V::set1(a[i]);
+            acc[i][0] = V::fmadd(ai, b0, acc[i][0]);
+            acc[i][1] = V::fmadd(ai, b1, acc[i][1]);
+        }
+    }
+    const auto va = V::set1(alpha);
+    const auto vb = V::set1(beta);
+    for (size_t i = 0; i < 4; ++i) {
+        T* row = c + i * ldc;
+        for (size_t v = 0; v < 2; ++v) {
+            auto out = V::mul(va, acc[i][v]);
+            if (beta != T(0)) {
+                out = V::fmadd(vb, V::load(row + L * v), out);
+            }
+            V::store(row + L * v, out);
+        }
+    }
+}
+
+// 4 x (2 * lanes) tile held in 8 AVX registers
+template <typename T>
+NN_TARGET_AVX2 void microKernelAvx2(size_t kc, const T* a, const T* b, T* c, size_t ldc, T alpha, T beta) {
+    using V = simd::Avx2<T>;
+    constexpr size_t L = V::lanes;
+    typename V::Reg acc[4][2];
+    for (size_t i = 0; i < 4; ++i) {
+        acc[i][0] = V::zero();
+        acc[i][1] = V::zero();
+    }
+    for (size_t p = 0; p < kc; ++p, a += 4, b += 2 * L) {
+        const auto b0 = V::load(b);
+        const auto b1 = V::load(b + L);
+#pragma GCC unroll 4
+        for (size_t i = 0; i < 4; ++i) {
+            const auto ai = V::set1(a[i]);
+            acc[i][0] = V::fmadd(ai, b0, acc[i][0]);
+            acc[i][1] = V::fmadd(ai, b1, acc[i][1]);
+        }
+    }
+    const auto va = V::set1(alpha);
+    const auto vb = V::set1(beta);
+    for (size_t i = 0; i < 4; ++i) {
+        T* row = c + i * ldc;
+        for (size_t v = 0; v < 2; ++v) {
+            auto out = V::mul(va, acc[i][v]);
+            if (beta != T(0)) {
+                out = V::fmadd(vb, V::load(row + L * v), out);
+            }
+            V::store(row + L * v, out);
+        }
+    }
+}
+
+// 8 x (2 * lanes) tile held in 16 AVX-512 registers
+template <typename T>
+NN_TARGET_AVX512 void microKernelAvx512(size_t kc, const T* a, const T* b, T* c, size_t ldc, T alpha, T beta) {
+    using V = simd::Avx512<T>;
+    constexpr size_t L = V::lanes;
+    typename V::Reg acc[8][2];
+    for (size_t i = 0; i < 8; ++i) {
+        acc[i][0] = V::zero();
+        acc[i][1] = V::zero();
+    }
+    for (size_t p = 0; p < kc; ++p, a += 8, b += 2 * L) {
+        const auto b0 = V::load(b);
+        const auto b1 = V::load(b + L);
+#pragma GCC unroll 8
+        for (size_t i = 0; i < 8; ++i) {
+            const auto ai = V::set1(a[i]);
+            acc[i][0] = V::fmadd(ai, b0, acc[i][0]);
+            acc[i][1] = V::fmadd(ai, b1, acc[i][1]);
+        }
+    }
+    const auto va = V::set1(alpha);
+    const auto vb = V::set1(beta);
+    for (size_t i = 0; i < 8; ++i) {
+        T* row = c + i * ldc;
+        for (size_t v = 0; v < 2; ++v) {
+            auto out = V::mul(va, acc[i][v]);
+            if (beta != T(0)) {
+                out = V::fmadd(vb, V::load(row + L * v), out);
+            }
+            V::store(row + L * v, out);
+        }
+    }
+}
+#endif
+
+template <typename T>
+KernelConfig<T> selectKernel() {
+    switch (simd::activeLevel()) {
+#ifdef NN_SIMD_X86
+        case simd::Level::AVX512:
+            return {8, 2 * simd::Avx512<T>::lanes, microKernelAvx512<T>};
+        case simd::Level::AVX2:
+            return {4, 2 * simd::Avx2<T>::lanes, microKernelAvx2<T>};
+        case simd::Level::SSE2:
+            return {4, 2 * simd::Sse2<T>::lanes, microKernelSse2<T>};
+#endif
+        default:
+            return {4, 4, microKernelScalar<T, 4, 4>};
+    }
+}
+
+// -------------------- Packing -------------------------------
+// Operands are addressed through a row stride (rs) and a column stride (cs), so packing also absorbs
+// strided and transposed views; the micro-kernels only ever see packed, unit-stride data.
+
+// Copies an mc x kc block of A into consecutive MR-row slivers, each stored column by column,
+// so the micro-kernel reads A strictly sequentially. Rows past mc are zero-padded.
+template <typename T>
+void packA(size_t mc, size_t kc, const T* A, size_t rsA, size_t csA, size_t mr, T* packed) {
+    for (size_t i0 = 0; i0 < mc; i0 += mr) {
+        const size_t rowsInSliver = std::min(mr, mc - i0);
+        for (size_t p = 0; p < kc; ++p) {
+            for (size_t i = 0; i < rowsInSliver; ++i) {
+                packed[i] = A[(i0 + i) * rsA + p * csA];
+            }
+            for (size_t i = rowsInSliver; i < mr; ++i) {
+                packed[i] = T(0);
+            }
+            packed += mr;
+        }
+    }
+}
+
+// Copies a kc x nc panel of B into consecutive NR-column slivers, each stored row by row.
+// Columns past nc are zero-padded.
+template <typename T>
+void packB(size_t kc, size_t nc, const T* B, size_t rsB, size_t csB, size_t nr, T* packed) {
+    for (size_t j0 = 0; j0 < nc; j0 += nr) {
+        const size_t colsInSliver = std::min(nr, nc - j0);
+        for (size_t p = 0; p < kc; ++p) {
+            const T* src = B + p * rsB + j0 * csB;
+            if (csB == 1) {
+                std::copy(src, src + colsInSliver, packed);
+            } else {
+                for (size_t j = 0; j < colsInSliver; ++j) {
+                    packed[j] = src[j * csB];
+                }
+            }
+            for (size_t j = colsInSliver; j < nr; ++j) {
+                packed[j] = T(0);
+            }
+            packed += nr;
+        }
+    }
+}
+
+// -------------------- Drivers -------------------------------
+// Scales C by beta (beta == 0 clears it without reading)
+template <typename T>
+void scaleC(size_t M, size_t N, T beta, T* C, size_t ldc) {
+    for (size_t i = 0; i < M; ++i) {
+        T* row = C + i * ldc;
+        if (beta == T(0)) {
+            std::fill(row, row + N, T(0));
+        } else if (beta != T(1)) {
+            for (size_t j = 0; j < N; ++j) {
+                row[j] *= beta;
+            }
+        }
+    }
+}
+
+// Adds the biases to an m x n tile of C whose first element is (row0, col0), then runs the activation on it
+template <typename T>
+void applyEpilogue(const Epilogue<T>& epilogue, size_t row0, size_t col0, size_t m, size_t n, T* c, size_t ldc) {
+    if (epilogue.rowBias || epilogue.colBias) {
+        for (size_t i = 0; i < m; ++i) {
+            T* row = c + i * ldc;
+            const T rowBias = epilogue.rowBias ? epilogue.rowBias[row0 + i] : T(0);
+            if (epilogue.colBias) {
+                const T* colBias = epilogue.colBias + col0;
+                for (size_t j = 0; j < n; ++j) {
+                    row[j] += rowBias + colBias[j];
+                }
+            } else {
+                for (size_t j = 0; j < n; ++j) {
+                    row[j] += rowBias;
+                }
+            }
+        }
+    }
+    if (epilogue.activation) {
+        epilogue.activation(epilogue.context, BasicMatrixView<T>(c, m, n, ldc));
+    }
+}
+
+// Unpacked i-k-j loop for products too small to amortize packing
+template <typename T>
+void gemmSmall(size_t M, size_t N, size_t K, T alpha, const T* A, size_t rsA, size_t csA,
+               const T* B, size_t rsB, size_t csB, T beta, T* C, size_t ldc) {
+    scaleC(M, N, beta, C, ldc);
+    for (size_t i = 0; i < M; ++i) {
+        const T* a = A + i * rsA;
+        T* c = C + i * ldc;
+        for (size_t k = 0; k < K; ++k) {
+            const T aik = alpha * a[k * csA];
+            const T* b = B + k * rsB;
+            if (csB == 1) {
+                for (size_t j = 0; j < N; ++j) {
+                    c[j] += aik * b[j];
+                }
+            } else {
+                for (size_t j = 0; j < N; ++j) {
+                    c[j] += aik * b[j * csB];
+                }
+            }
+        }
+    }
+}
+
+// Runs the micro-kernel over every tile of an mc x nc block of C, whose first element is (row0, col0) of the
+// full product. A non-null epilogue is applied to each tile as soon as it is stored, while it is still in L1.
+template <typename T>
+void macroKernel(const KernelConfig<T>& config, size_t mc, size_t nc, size_t kc,
+                 T alpha, const T* packedA, const T* packedB,
+                 T beta, T* C, size_t ldc, const Epilogue<T>* epilogue, size_t row0, size_t col0) {
+    const size_t mr = config.mr;
+    const size_t nr = config.nr;
+    T edgeTile[MAX_TILE];
+
+    for (size_t j0 = 0; j0 < nc; j0 += nr) {
+        const size_t n = std::min(nr, nc - j0);
+        const T* b = packedB + j0 * kc;
+        for (size_t i0 = 0; i0 < mc; i0 += mr) {
+            const size_t m = std::min(mr, mc - i0);
+            const T* a = packedA + i0 * kc;
+            T* c = C + i0 * ldc + j0;
+
+            if (m == mr && n == nr) {
+                config.kernel(kc, a, b, c, ldc, alpha, beta);
+                if (epilogue) {
+                    applyEpilogue(*epilogue, row0 + i0, col0 + j0, m, n, c, ldc);
+                }
+                continue;
+            }
+            // Partial tile: compute the full tile into scratch space, then merge the valid part
+            config.kernel(kc, a, b, edgeTile, nr, T(1), T(0));
+            for (size_t i = 0; i < m; ++i) {
+                for (size_t j = 0; j < n; ++j) {
+                    const T value = alpha * edgeTile[i * nr + j];
+                    c[i * ldc + j] = (beta == T(0)) ? value : value + beta * c[i * ldc + j];
+                }
+            }
+            if (epilogue) {
+                applyEpilogue(*epilogue, row0 + i0, col0 + j0, m, n, c, ldc);
+            }
+        }
+    }
+}
+
+// Computes rows [rowBegin, rowEnd) and packed columns [colBegin, colEnd) of one (jc, pc) panel.
+// colBegin must be a multiple of NR so it lines up with a packed B sliver. jc is only needed by the epilogue.
+template <typename T>
+void gemmPanel(const KernelConfig<T>& config, size_t rowBegin, size_t rowEnd, size_t colBegin, size_t colEnd,
+               size_t kc, T alpha, const T* A, size_t rsA, size_t csA, const T* packedB,
+               T beta, T* C, size_t ldc, const Epilogue<T>* epilogue, size_t jc) {
+    // Each thread packs A into its own buffer, reused across calls
+    thread_local std::vector<T> packedA;
+    packedA.resize(MC * KC);
+
+    for (size_t ic = rowBegin; ic < rowEnd; ic += MC) {
+        const size_t mc = std::min(MC, rowEnd - ic);
+        packA(mc, kc, A + ic * rsA, rsA, csA, config.mr, packedA.data());
+        macroKernel(config, mc, colEnd - colBegin, kc, alpha, packedA.data(), packedB + colBegin * kc,
+                    beta, C + ic * ldc + colBegin, ldc, epilogue, ic, jc + colBegin);
+    }
+}
+
+// Shared driver for all public entry points; C always has unit column stride here
+template <typename T>
+void gemmStrided(size_t M, size_t N, size_t K,
+                 T alpha, const T* A, size_t rsA, size_t csA,
+                 const T* B, size_t rsB, size_t csB,
+                 T beta, T* C, size_t ldc, const Epilogue<T>* epilogue = nullptr) {
+    if (M == 0 || N == 0) {
+        return;
+    }
+    if (K == 0 || alpha == T(0)) {
+        scaleC(M, N, beta, C, ldc);
+        if (epilogue) {
+            applyEpilogue(*epilogue, 0, 0, M, N, C, ldc);
+        }
+        return;
+    }
+    if (M * N * K < SMALL_GEMM_WORK) {
+        gemmSmall(M, N, K, alpha, A, rsA, csA, B, rsB, csB, beta, C, ldc);
+        if (epilogue) {
+            applyEpilogue(*epilogue, 0, 0, M, N, C, ldc);
+        }
+        return;
+    }
+
+    const KernelConfig<T> config = selectKernel<T>();
+    const size_t mr = config.mr;
+    const size_t nr = config.nr;
+
+    ThreadPool& pool = ThreadPool::global();
+    const bool parallel = M * N * K >= getGemmParallelThreshold() && pool.getThreadCount() > 1;
+
+    // The packed B panel is shared by all threads and reused across calls to avoid allocator traffic
+    thread_local std::vector<T> packedB;
+    packedB.resize(KC * (NC + nr));
+
+    for (size_t jc = 0; jc < N; jc += NC) {
+        const size_t nc = std::min(NC, N - jc);
+        const size_t slivers = (nc + nr - 1) / nr;
+        for (size_t pc = 0; pc < K; pc += KC) {
+            const size_t kc = std::min(KC, K - pc);
+            // Only the first pass over K applies the caller's beta; later passes accumulate.
+            // Only the last pass produces final values, so it alone runs the epilogue.
+            const T betaPass = (pc == 0) ? beta : T(1);
+            const Epilogue<T>* epiloguePass = (pc + kc == K) ? epilogue : nullptr;
+            const T* Bpanel = B + pc * rsB + jc * csB;
+            const T* Apanel = A + pc * csA;
+            T* Cpanel = C + jc;
+
+            if (!parallel) {
+                packB(kc, nc, Bpanel, rsB, csB, nr, packedB.data());
+                gemmPanel(config, 0, M, 0, nc, kc, alpha, Apanel, rsA, csA, packedB.data(), betaPass, Cpanel, ldc,
+                          epiloguePass, jc);
+                continue;
+            }
+
+            T* packed = packedB.data();
+            pool.parallelFor(0, slivers, [&](size_t s0, size_t s1) {
+                packB(kc, std::min(s1 * nr, nc) - s0 * nr, Bpanel + s0 * nr * csB, rsB, csB, nr, packed + s0 * nr * kc);
+            });
+
+            // Split along M when there are enough row tiles to go around, otherwise along N
+            const size_t rowTiles = (M + mr - 1) / mr;
+            if (rowTiles >= pool.getThreadCount() || rowTiles >= slivers) {
+                pool.parallelFor(0, rowTiles, [&](size_t t0, size_t t1) {
+                    gemmPanel(config, t0 * mr, std::min(t1 * mr, M), 0, nc, kc,
+                              alpha, Apanel, rsA, csA, packed, betaPass, Cpanel, ldc, epiloguePass, jc);
+                });
+            } else {
+                pool.parallelFor(0, slivers, [&](size_t s0, size_t s1) {
+                    gemmPanel(config, 0, M, s0 * nr, std::min(s1 * nr, nc), kc,
+                              alpha, Apanel, rsA, csA, packed, betaPass, Cpanel, ldc, epiloguePass, jc);
+                });
+            }
+        }
+    }
+}
+
+// A transposed operand is the stored matrix read with its row and column strides swapped
+template <typename T>
+void gemmTransposed(Transpose transA, Transpose transB, size_t M, size_t N, size_t K,
+                    T alpha, const T* A, size_t lda, const T* B, size_t ldb, T beta, T* C, size_t ldc) {
+    const bool ta = transA == Transpose::Yes;
+    const bool tb = transB == Transpose::Yes;
+    gemmStrided(M, N, K, alpha, A, ta ? 1 : lda, ta ? lda : 1, B, tb ? 1 : ldb, tb ? ldb : 1, beta, C, ldc);
+}
+
+template <typename T>
+void gemmView(T alpha, BasicMatrixView<const T> A, BasicMatrixView<const T> B, T beta, BasicMatrixView<T> C,
+              const Epilogue<T>* epilogue = nullptr) {
+    if (A.getCols() != B.getRows() || C.getRows() != A.getRows() || C.getCols() != B.getCols()) {
+        throw std::invalid_argument("Matrix dimensions do not match for multiplication.");
+    }
+    const size_t M = C.getRows();
+    const size_t N = C.getCols();
+    const size_t K = A.getCols();
+
+    if (C.hasContiguousRows()) {
+        gemmStrided(M, N, K, alpha, A.getPointer(), A.getRowStride(), A.getColStride(),
+                    B.getPointer(), B.getRowStride(), B.getColStride(), beta, C.getPointer(), C.getRowStride(),
+                    epilogue);
+        return;
+    }
+
+    // C is strided (e.g. a transposed view): compute into a row-major scratch block, then scatter
+    thread_local std::vector<T> scratch;
+    scratch.resize(M * N);
+    for (size_t i = 0; i < M; ++i) {
+        for (size_t j = 0; j < N; ++j) {
+            scratch[i * N + j] = (beta == T(0)) ? T(0) : C(i, j);
+        }
+    }
+    gemmStrided(M, N, K, alpha, A.getPointer(), A.getRowStride(), A.getColStride(),
+                B.getPointer(), B.getRowStride(), B.getColStride(), beta, scratch.data(), N, epilogue);
+    for (size_t i = 0; i < M; ++i) {
+        for (size_t j = 0; j < N; ++j) {
+            C(i, j) = scratch[i * N + j];
+        }
+    }
+}
+
+} // namespace
+
+void setGemmParallelThreshold(size_t work) {
+    parallelThreshold.store(work, std::memory_order_relaxed);
+}
+
+size_t getGemmParallelThreshold() {
+    return parallelThreshold.load(std::memory_order_relaxed);
+}
+
+void gemm(size_t M, size_t N, size_t K,
+          double alpha, const double* A, size_t lda,
+          const double* B, size_t ldb,
+          double beta, double* C, size_t ldc) {
+    gemmStrided(M, N, K, alpha, A, lda, 1, B, ldb, 1, beta, C, ldc);
+}
+
+void gemm(size_t M, size_t N, size_t K,
+          float alpha, const float* A, size_t lda,
+          const float* B, size_t ldb,
+          float beta, float* C, size_t ldc) {
+    gemmStrided(M, N, K, alpha, A, lda, 1, B, ldb, 1, beta, C, ldc);
+}
+
+void gemm(Transpose transA, Transpose transB, size_t M, size_t N, size_t K,
+          double alpha, const double* A, size_t lda,
+          const double* B, size_t ldb,
+          double beta, double* C, size_t ldc) {
+    gemmTransposed(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+void gemm(Transpose transA, Transpose transB, size_t M, size_t N, size_t K,
+          float alpha, const float* A, size_t lda,
+          const float* B, size_t ldb,
+          float beta, float* C, size_t ldc) {
+    gemmTransposed(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+void gemm(double alpha, ConstMatrixView A, ConstMatrixView B, double beta, MatrixView C) {
+    gemmView(alpha, A, B, beta, C);
+}
+
+void gemm(float alpha, ConstMatrixViewF A, ConstMatrixViewF B, float beta, MatrixViewF C) {
+    gemmView(alpha, A, B, beta, C);
+}
+
+void gemm(Transpose transA, Transpose transB, double alpha, ConstMatrixView A, ConstMatrixView B,
+          double beta, MatrixView C) {
+    gemmView(alpha, transA == Transpose::Yes ? A.transpose() : A, transB == Transpose::Yes ? B.transpose() : B,
+             beta, C);
+}
+
+void gemm(Transpose transA, Transpose transB, float alpha, ConstMatrixViewF A, ConstMatrixViewF B,
+          float beta, MatrixViewF C) {
+    gemmView(alpha, transA == Transpose::Yes ? A.transpose() : A, transB == Transpose::Yes ? B.transpose() : B,
+             beta, C);
+}
+
+void gemm(double alpha, ConstMatrixView A, ConstMatrixView B, double beta, MatrixView C,
+          const Epilogue<double>& epilogue) {
+    gemmView(alpha, A, B, beta, C, &epilogue);
+}
+
+void gemm(float alpha, ConstMatrixViewF A, ConstMatrixViewF B, float beta, MatrixViewF C,
+          const Epilogue<float>& epilogue) {
+    gemmView(alpha, A, B, beta, C, &epilogue);
+}
+
+} // namespace kernels
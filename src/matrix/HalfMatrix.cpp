@@ -0,0 +1,327 @@
+#include "../../include/matrix/HalfMatrix.h"
+#include "../../include/matrix/Simd.h"
+#include "../../include/matrix/Workspace.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <memory_resource>
+#include <stdexcept>
+
+#ifdef NN_SIMD_X86
+// Every AVX2 CPU also has the F16C conversions
+#define NN_TARGET_AVX2_F16C __attribute__((target("avx2,f16c")))
+#endif
+
+namespace {
+
+// Size of the widened block in the half-precision gemm() overloads: about half an L2
+constexpr size_t WIDEN_BYTES = size_t(256) * 1024;
+
+// Doubles pass through a float buffer of this many elements
+constexpr size_t CHUNK = 256;
+
+// -------------------- Scalar Conversions ------------------
+inline uint16_t toBFloat16(float value) {
+    const uint32_t bits = std::bit_cast<uint32_t>(value);
+    if (std::isnan(value)) {
+        return static_cast<uint16_t>((bits | 0x400000) >> 16);  // Keep it a (quiet) NaN after truncation
+    }
+    return static_cast<uint16_t>((bits + 0x7FFF + ((bits >> 16) & 1)) >> 16);
+}
+
+inline float fromBFloat16(uint16_t half) {
+    return std::bit_cast<float>(uint32_t(half) << 16);
+}
+
+uint16_t toFloat16(float value) {
+    uint32_t bits = std::bit_cast<uint32_t>(value);
+    const uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+    bits &= 0x7FFFFFFF;
+    if (bits >= 0x7F800000) {
+        return sign | 0x7C00 | (bits > 0x7F800000 ? 0x200 : 0);  // Infinity or NaN
+    }
+    if (bits >= 0x477FF000) {
+        return sign | 0x7C00;  // At least 65520, which rounds past the largest half (65504)
+    }
+    if (bits < 0x38800000) {
+        // Below 2^-14: a subnormal half, counting units of 2^-24
+        if (bits < 0x33000000) {
+            return sign;  // At most 2^-25, which rounds to zero
+        }
+        const uint32_t mantissa = (bits & 0x7FFFFF) | 0x800000;
+        const uint32_t shift = 126 - (bits >> 23);
+        uint32_t half = mantissa >> shift;
+        const uint32_t remainder = mantissa & ((uint32_t(1) << shift) - 1);
+        const uint32_t halfway = uint32_t(1) << (shift - 1);
+        if (remainder > halfway || (remainder == halfway && (half & 1))) {
+            ++half;
+        }
+        return sign | static_cast<uint16_t>(half);
+    }
+    // Normal: rebias the exponent from 127 to 15 and round off 13 bits (a carry correctly bumps the exponent)
+    uint32_t half = (bits - 0x38000000) >> 13;
+    const uint32_t remainder = bits & 0x1FFF;
+    if (remainder > 0x1000 || (remainder == 0x1000 && (half & 1))) {
+        ++half;
+    }
+    return sign | static_cast<uint16_t>(half);
+}
+
+float fromFloat16(uint16_t half) {
+    const uint32_t sign = uint32_t(half & 0x8000) << 16;
+    const uint32_t exponent = (half >> 10) & 0x1F;
+    const uint32_t mantissa = half & 0x3FF;
+    if (exponent == 0x1F) {
+        return std::bit_cast<float>(sign | 0x7F800000 | (mantissa << 13));
+    }
+    if (exponent == 0) {
+        const float magnitude = static_cast<float>(mantissa) * 0x1p-24f;  // Zero or subnormal
+        return sign ? -magnitude : magnitude;
+    }
+    return std::bit_cast<float>(sign | ((exponent + 112) << 23) | (mantissa << 13));
+}
+
+void narrowScalar(size_t n, const float* in, uint16_t* out, HalfFormat format) {
+    if (format == HalfFormat::BFloat16) {
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = toBFloat16(in[i]);
+        }
+    } else {
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = toFloat16(in[i]);
+        }
+    }
+}
+
+void widenScalar(size_t n, const uint16_t* in, float* out, HalfFormat format) {
+    if (format == HalfFormat::BFloat16) {
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = fromBFloat16(in[i]);
+        }
+    } else {
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = fromFloat16(in[i]);
+        }
+    }
+}
+
+// -------------------- AVX2 / F16C Conversions -------------
+#ifdef NN_SIMD_X86
+NN_TARGET_AVX2_F16C void narrowAvx2(size_t n, const float* in, uint16_t* out, HalfFormat format) {
+    size_t i = 0;
+    if (format == HalfFormat::BFloat16) {
+        const __m256i bias = _mm256_set1_epi32(0x7FFF);
+        const __m256i one = _mm256_set1_epi32(1);
+        const __m256i quiet = _mm256_set1_epi32(0x400000);
+        for (; i + 8 <= n; i += 8) {
+            const __m256 values = _mm256_loadu_ps(in + i);
+            const __m256i bits = _mm256_castps_si256(values);
+            const __m256i lsb = _mm256_and_si256(_mm256_srli_epi32(bits, 16), one);
+            const __m256i rounded = _mm256_srli_epi32(_mm256_add_epi32(bits, _mm256_add_epi32(bias, lsb)), 16);
+            const __m256i nan = _mm256_srli_epi32(_mm256_or_si256(bits, quiet), 16);
+            const __m256i isNan = _mm256_castps_si256(_mm256_cmp_ps(values, values, _CMP_UNORD_Q));
+            const __m256i halves = _mm256_blendv_epi8(rounded, nan, isNan);
+            const __m128i packed =
+                _mm_packus_epi32(_mm256_castsi256_si128(halves), _mm256_extracti128_si256(halves, 1));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), packed);
+        }
+    } else {
+        for (; i + 8 <= n; i += 8) {
+            const __m128i packed =
+                _mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), packed);
+        }
+    }
+    narrowScalar(n - i, in + i, out + i, format);
+}
+
+NN_TARGET_AVX2_F16C void widenAvx2(size_t n, const uint16_t* in, float* out, HalfFormat format) {
+    size_t i = 0;
+    if (format == HalfFormat::BFloat16) {
+        for (; i + 8 <= n; i += 8) {
+            const __m256i halves = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i)));
+            _mm256_storeu_ps(out + i, _mm256_castsi256_ps(_mm256_slli_epi32(halves, 16)));
+        }
+    } else {
+        for (; i + 8 <= n; i += 8) {
+            _mm256_storeu_ps(out + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i))));
+        }
+    }
+    widenScalar(n - i, in + i, out + i, format);
+}
+#endif
+
+void narrowFloats(size_t n, const float* in, uint16_t* out, HalfFormat format) {
+#ifdef NN_SIMD_X86
+    if (simd::activeLevel() >= simd::Level::AVX2) {
+        return narrowAvx2(n, in, out, format);
+    }
+#endif
+    narrowScalar(n, in, out, format);
+}
+
+void widenFloats(size_t n, const uint16_t* in, float* out, HalfFormat format) {
+#ifdef NN_SIMD_X86
+    if (simd::activeLevel() >= simd::Level::AVX2) {
+        return widenAvx2(n, in, out, format);
+    }
+#endif
+    widenScalar(n, in, out, format);
+}
+
+// -------------------- Products ----------------------------
+template <typename T>
+void gemmHalfLeft(T alpha, const HalfMatrix& A, BasicMatrixView<const T> B, T beta, BasicMatrixView<T> C,
+                  const kernels::Epilogue<T>& epilogue) {
+    if (A.getCols() != B.getRows() || C.getRows() != A.getRows() || C.getCols() != B.getCols()) {
+        throw std::invalid_argument("Matrices have incompatible sizes for multiplication.");
+    }
+    const size_t M = A.getRows();
+    const size_t K = A.getCols();
+    const size_t block = std::max<size_t>(1, WIDEN_BYTES / (sizeof(T) * std::max<size_t>(K, 1)));
+    std::pmr::vector<T> widened(std::min(block, M) * K, Workspace::current());
+    for (size_t i0 = 0; i0 < M; i0 += block) {
+        const size_t count = std::min(block, M - i0);
+        A.widenRows(i0, count, widened.data());
+        kernels::Epilogue<T> rows = epilogue;
+        if (rows.rowBias) {
+            rows.rowBias += i0;
+        }
+        kernels::gemm(alpha, BasicMatrixView<const T>(widened.data(), count, K, K), B, beta,
+                      C.block(i0, 0, count, C.getCols()), rows);
+    }
+}
+
+template <typename T>
+void gemmHalfRight(T alpha, BasicMatrixView<const T> A, const HalfMatrix& B, T beta, BasicMatrixView<T> C,
+                   const kernels::Epilogue<T>& epilogue) {
+    if (A.getCols() != B.getRows() || C.getRows() != A.getRows() || C.getCols() != B.getCols()) {
+        throw std::invalid_argument("Matrices have incompatible sizes for multiplication.");
+    }
+    const size_t K = B.getRows();
+    const size_t N = B.getCols();
+    const size_t block = std::max<size_t>(1, WIDEN_BYTES / (sizeof(T) * std::max<size_t>(N, 1)));
+    std::pmr::vector<T> widened(std::min(block, K) * N, Workspace::current());
+    size_t k0 = 0;
+    do {
+        // Each slice of the shared dimension adds onto the previous ones; the epilogue waits for the last
+        const size_t count = std::min(block, K - k0);
+        B.widenRows(k0, count, widened.data());
+        const bool last = k0 + count >= K;
+        kernels::gemm(alpha, A.colRange(k0, k0 + count), BasicMatrixView<const T>(widened.data(), count, N, N),
+                      k0 == 0 ? beta : T(1), C, last ? epilogue : kernels::Epilogue<T>{});
+        k0 += count;
+    } while (k0 < K);
+}
+
+} // namespace
+
+namespace kernels {
+
+void narrow(size_t n, const float* in, uint16_t* out, HalfFormat format) {
+    narrowFloats(n, in, out, format);
+}
+
+void narrow(size_t n, const double* in, uint16_t* out, HalfFormat format) {
+    float buffer[CHUNK];
+    for (size_t i = 0; i < n; i += CHUNK) {
+        const size_t count = std::min(CHUNK, n - i);
+        std::transform(in + i, in + i + count, buffer, [](double value) { return static_cast<float>(value); });
+        narrowFloats(count, buffer, out + i, format);
+    }
+}
+
+void widen(size_t n, const uint16_t* in, float* out, HalfFormat format) {
+    widenFloats(n, in, out, format);
+}
+
+void widen(size_t n, const uint16_t* in, double* out, HalfFormat format) {
+    float buffer[CHUNK];
+    for (size_t i = 0; i < n; i += CHUNK) {
+        const size_t count = std::min(CHUNK, n - i);
+        widenFloats(count, in + i, buffer, format);
+        std::copy(buffer, buffer + count, out + i);
+    }
+}
+
+void gemm(double alpha, const HalfMatrix& A, ConstMatrixView B, double beta, MatrixView C,
+          const Epilogue<double>& epilogue) {
+    gemmHalfLeft(alpha, A, B, beta, C, epilogue);
+}
+
+void gemm(float alpha, const HalfMatrix& A, ConstMatrixViewF B, float beta, MatrixViewF C,
+          const Epilogue<float>& epilogue) {
+    gemmHalfLeft(alpha, A, B, beta, C, epilogue);
+}
+
+void gemm(double alpha, ConstMatrixView A, const HalfMatrix& B, double beta, MatrixView C,
+          const Epilogue<double>& epilogue) {
+    gemmHalfRight(alpha, A, B, beta, C, epilogue);
+}
+
+void gemm(float alpha, ConstMatrixViewF A, const HalfMatrix& B, float beta, MatrixViewF C,
+          const Epilogue<float>& epilogue) {
+    gemmHalfRight(alpha, A, B, beta, C, epilogue);
+}
+
+} // namespace kernels
+
+// Constructors
+HalfMatrix::HalfMatrix() : rows(0), cols(0), format(HalfFormat::BFloat16) {}
+
+HalfMatrix::HalfMatrix(ConstMatrixView values, HalfFormat format) : format(format) {
+    narrowFrom(values);
+}
+
+HalfMatrix::HalfMatrix(ConstMatrixViewF values, HalfFormat format) : format(format) {
+    narrowFrom(values);
+}
+
+template <typename T>
+void HalfMatrix::narrowFrom(BasicMatrixView<const T> values) {
+    rows = values.getRows();
+    cols = values.getCols();
+    data.resize(rows * cols);
+    std::vector<T> gathered(values.hasContiguousRows() ? 0 : cols);
+    for (size_t i = 0; i < rows; ++i) {
+        const T* row = values.getPointer() + i * values.getRowStride();
+        if (!gathered.empty()) {
+            for (size_t j = 0; j < cols; ++j) {
+                gathered[j] = values[i, j];
+            }
+            row = gathered.data();
+        }
+        kernels::narrow(cols, row, data.data() + i * cols, format);
+    }
+}
+
+// Element Access
+float HalfMatrix::operator()(size_t row, size_t col) const {
+    if (row >= rows || col >= cols) {
+        throw std::out_of_range("Half matrix indices out of range.");
+    }
+    float value;
+    kernels::widen(1, rowData(row) + col, &value, format);
+    return value;
+}
+
+// Conversion
+void HalfMatrix::widenRows(size_t first, size_t count, double* out) const {
+    kernels::widen(count * cols, rowData(first), out, format);
+}
+
+void HalfMatrix::widenRows(size_t first, size_t count, float* out) const {
+    kernels::widen(count * cols, rowData(first), out, format);
+}
+
+template <typename T>
+BasicMatrix<T> HalfMatrix::toMatrix(const std::string& name) const {
+    BasicMatrix<T> result(rows, cols, name);
+    if (rows > 0) {
+        widenRows(0, rows, result.rowData(0));
+    }
+    return result;
+}
+
+template BasicMatrix<double> HalfMatrix::toMatrix<double>(const std::string& name) const;
+template BasicMatrix<float> HalfMatrix::toMatrix<float>(const std::string& name) const;
@@ -1,34 +1,145 @@
 #include "../../include/matrix/Matrix.h"
+#include "../../include/matrix/ElementWise.h"
+#include "../../include/matrix/Gemm.h"
+#include "../../include/matrix/MatrixFile.h"
+
+namespace {
+
+// Runs a kernel over a rows x cols region. When every operand stores its rows back to back the region is
+// handed over as one contiguous run, otherwise the kernel is called once per row.
+template <typename RowKernel>
+void forEachRun(size_t rows, size_t cols, bool contiguous, RowKernel kernel) {
+    if (contiguous) {
+        kernel(0, rows * cols);
+        return;
+    }
+    for (size_t i = 0; i < rows; ++i) {
+        kernel(i, cols);
+    }
+}
+
+// Like forEachRun, but the second operand is a view. Rows of a view with strided columns are gathered into
+// a scratch row first, so the kernel always receives a unit-stride pointer: kernel(row, count, otherRun).
+// A broadcast row vector (row stride 0) hands the same run to every row; a broadcast column vector (column
+// stride 0) fills the scratch row with one value per row. Neither expands the operand to the full shape.
+template <typename T, typename RowKernel>
+void forEachRunWithView(size_t rows, size_t cols, bool contiguous, BasicMatrixView<const T> other, RowKernel kernel) {
+    if (contiguous && other.isContiguous()) {
+        kernel(0, rows * cols, other.getPointer());
+        return;
+    }
+    std::pmr::vector<T> gathered(other.hasContiguousRows() ? 0 : cols, Workspace::current());
+    for (size_t i = 0; i < rows; ++i) {
+        const T* run = other.getPointer() + i * other.getRowStride();
+        if (!gathered.empty()) {
+            for (size_t j = 0; j < cols; ++j) {
+                gathered[j] = run[j * other.getColStride()];
+            }
+            run = gathered.data();
+        }
+        kernel(i, cols, run);
+    }
+}
+
+// The second operand of an element-wise operation, stretched to rows x cols if it is a row or column vector
+template <typename T>
+BasicMatrixView<const T> broadcastOperand(BasicMatrixView<const T> other, size_t rows, size_t cols,
+                                          const char* description) {
+    if (other.getRows() == rows && other.getCols() == cols) {
+        return other;
+    }
+    if ((other.getRows() != rows && other.getRows() != 1) || (other.getCols() != cols && other.getCols() != 1)) {
+        throw std::invalid_argument(std::string("Matrices must have the same or broadcastable dimensions for ") +
+                                    description + ".");
+    }
+    return other.broadcast(rows, cols);
+}
+
+// Checks the output of an ...Into() operation: exactly the result's shape and, for the element-wise kernels
+// that write whole runs, unit column stride
+template <typename T>
+void checkOutput(BasicMatrixView<T> out, size_t rows, size_t cols, bool contiguousRows, const char* description) {
+    if (out.getRows() != rows || out.getCols() != cols) {
+        throw std::invalid_argument("Output must be " + std::to_string(rows) + "x" + std::to_string(cols) + " for " +
+                                    description + ".");
+    }
+    if (contiguousRows && !out.hasContiguousRows()) {
+        throw std::invalid_argument(std::string("Output rows must be contiguous for ") + description + ".");
+    }
+}
+
+} // namespace
 
 // Constructors
-Matrix::Matrix(size_t rows, size_t cols, const std::string& name)
-    : rows(rows), cols(cols), name(name), data(rows, std::vector<double>(cols, 0.0)) {}
+template <typename T>
+BasicMatrix<T>::BasicMatrix(size_t rows, size_t cols, const std::string& name)
+    : name(name), rows(rows), cols(cols), stride(cols), data(rows * cols, T(0), Workspace::current()) {}
+
+template <typename T>
+BasicMatrix<T>::BasicMatrix(const BasicMatrix& other)
+    : name(other.name), rows(other.rows), cols(other.cols), stride(other.stride),
+      data(other.data, Workspace::current()) {}
+
+template <typename T>
+BasicMatrix<T>::BasicMatrix(ConstView view, const std::string& name)
+    : name(name), rows(view.getRows()), cols(view.getCols()), stride(view.getCols()),
+      data(rows * cols, Workspace::current()) {
+    if (view.hasContiguousRows()) {
+        for (size_t i = 0; i < rows; ++i) {
+            std::copy_n(view.getPointer() + i * view.getRowStride(), cols, rowPtr(i));
+        }
+    } else if (view.getRowStride() == 1) {
+        // A transposed view, e.g. a sample-major dataset read feature-major: use the blocked transpose
+        kernels::transpose(cols, rows, view.getPointer(), view.getColStride(), data.data(), stride);
+    } else {
+        for (size_t i = 0; i < rows; ++i) {
+            for (size_t j = 0; j < cols; ++j) {
+                rowPtr(i)[j] = view[i, j];
+            }
+        }
+    }
+}
 
-Matrix::Matrix(const Matrix& other)
-    : name(other.name), rows(other.rows), cols(other.cols), data(other.data) {}
+template <typename T>
+BasicMatrix<T>::BasicMatrix(BasicMatrix&& other) noexcept
+    : name(std::move(other.name)), rows(std::exchange(other.rows, 0)), cols(std::exchange(other.cols, 0)),
+      stride(std::exchange(other.stride, 0)), data(std::move(other.data)) {}
+
+template <typename T>
+BasicMatrix<T>& BasicMatrix<T>::operator=(BasicMatrix&& other) {
+    if (this == &other) {
+        return *this;
+    }
+    name = std::move(other.name);
+    rows = std::exchange(other.rows, 0);
+    cols = std::exchange(other.cols, 0);
+    stride = std::exchange(other.stride, 0);
+    data = std::move(other.data);
+    other.data.clear();  // Only has an effect when the elements were copied across allocation sources
+    return *this;
+}
 
 // Getters
-std::span<const double> Matrix::getRow(size_t row) const {
+template <typename T>
+std::span<const T> BasicMatrix<T>::getRow(size_t row) const {
     if (row >= rows) {
         throw std::out_of_range("Row index out of range.");
     }
-    return std::span<const double>(data[row]);
+    return std::span<const T>(rowPtr(row), cols);
 }
 
-std::span<const double> Matrix::getCol(size_t col) const {
+template <typename T>
+typename BasicMatrix<T>::ConstView BasicMatrix<T>::getCol(size_t col) const {
     if (col >= cols) {
         throw std::out_of_range("Column index out of range.");
     }
-    std::vector<double> colData(rows);
-    for (size_t i = 0; i < rows; ++i) {
-        colData[i] = data[i][col];
-    }
-    return std::span<const double>(colData);
+    return view().col(col);
 }
 
 
 // Setters
-Matrix& Matrix::setData(const std::vector<std::vector<double>>& newData) {
+template <typename T>
+BasicMatrix<T>& BasicMatrix<T>::setData(const std::vector<std::vector<T>>& newData) {
     if (newData.empty()) {
         throw std::invalid_argument("Data cannot be empty.");
     }
@@ -38,75 +149,79 @@ Matrix& Matrix::setData(const std::vector<std::vector<double>>& newData) {
             throw std::invalid_argument("All rows must have the same number of columns.");
         }
     }
-    data = newData;
     rows = newData.size();
     cols = newCols;
+    stride = newCols;
+    data.resize(rows * stride);
+    for (size_t i = 0; i < rows; ++i) {
+        std::copy(newData[i].begin(), newData[i].end(), rowPtr(i));
+    }
 
     return *this;
 }
 
-Matrix& Matrix::setData(double value) {
-    for (size_t i = 0; i < rows; ++i) {
-        for (size_t j = 0; j < cols; ++j) {
-            data[i][j] = value;
-        }
-    }
+template <typename T>
+BasicMatrix<T>& BasicMatrix<T>::setData(T value) {
+    std::fill(data.begin(), data.end(), value);
     return *this;
 }
 
 // Utility Methods
-Matrix& Matrix::fillByHand() {
+template <typename T>
+BasicMatrix<T>& BasicMatrix<T>::fillByHand() {
     std::cin >> *this;
     return *this;
 }
 
-Matrix& Matrix::print() const {
+template <typename T>
+BasicMatrix<T>& BasicMatrix<T>::print() const {
     std::cout << "Matrix name: " << name << "\n";
     std::cout << *this;
-    return const_cast<Matrix&>(*this);
+    return const_cast<BasicMatrix&>(*this);
 }
 
-Matrix& Matrix::randomize(double min, double max) {
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_real_distribution<> dis(min, max);
+template <typename T>
+BasicMatrix<T>& BasicMatrix<T>::randomize(T min, T max) {
+    return randomize(Philox::global(), min, max);
+}
 
+template <typename T>
+BasicMatrix<T>& BasicMatrix<T>::randomize(Philox& rng, T min, T max) {
+    if (stride == cols) {
+        rng.fillUniform(data.data(), rows * cols, min, max);
+        return *this;
+    }
     for (size_t i = 0; i < rows; ++i) {
-        for (size_t j = 0; j < cols; ++j) {
-            data[i][j] = dis(gen);
-        }
+        rng.fillUniform(rowPtr(i), cols, min, max);
     }
     return *this;
 }
 
-Matrix Matrix::applyFunction(const std::function<double(double)>& func) const {
-    Matrix result(rows, cols, "Result");
-    for (size_t i = 0; i < rows; ++i) {
-        for (size_t j = 0; j < cols; ++j) {
-            result.data[i][j] = func(data[i][j]);
-        }
-    }
+template <typename T>
+BasicMatrix<T> BasicMatrix<T>::applyFunction(const std::function<T(T)>& func) const {
+    BasicMatrix result(rows, cols, "Result");
+    applyFunctionInto(func, result);
     return result;
 }
 
-Matrix Matrix::createIdentityMatrix(size_t size, const std::string& name) {
-    Matrix identity(size, size, name);
+template <typename T>
+BasicMatrix<T> BasicMatrix<T>::createIdentityMatrix(size_t size, const std::string& name) {
+    BasicMatrix identity(size, size, name);
     for (size_t i = 0; i < size; ++i) {
-        identity.data[i][i] = 1.0;
+        identity.rowPtr(i)[i] = 1.0;
     }
     return identity;
 }
 
-bool Matrix::isEmpty(bool checkForNonZeroData ) const {
+template <typename T>
+bool BasicMatrix<T>::isEmpty(bool checkForNonZeroData ) const {
     if (rows == 0 || cols == 0 || data.empty()) {
         return true;
     }
     if (checkForNonZeroData) {
-        for (const auto& row : data) {
-            for (double value : row) {
-                if (value != 0.0) {
-                    return false;  // Matrix has meaningful data
-                }
+        for (T value : data) {
+            if (value != 0.0) {
+                return false;  // Matrix has meaningful data
             }
         }
         return true;  // Only zero values are present
@@ -115,163 +230,309 @@ bool Matrix::isEmpty(bool checkForNonZeroData ) const {
 }
 
 // Matrix Operations
-Matrix Matrix::add(const Matrix& other) const {
-    if (rows != other.rows || cols != other.cols) {
-        throw std::invalid_argument("Matrices must have the same dimensions for addition.");
-    }
-    Matrix result(rows, cols, "Result");
-    for (size_t i = 0; i < rows; ++i) {
-        for (size_t j = 0; j < cols; ++j) {
-            result.data[i][j] = data[i][j] + other.data[i][j];
-        }
-    }
+template <typename T>
+BasicMatrix<T> BasicMatrix<T>::add(ConstView other) const {
+    BasicMatrix result(rows, cols, "Result");
+    addInto(other, result);
     return result;
 }
 
-Matrix Matrix::subtract(const Matrix& other) const {
-    if (rows != other.rows || cols != other.cols) {
-        throw std::invalid_argument("Matrices must have the same dimensions for subtraction.");
-    }
-    Matrix result(rows, cols, "Result");
-    for (size_t i = 0; i < rows; ++i) {
-        for (size_t j = 0; j < cols; ++j) {
-            result.data[i][j] = data[i][j] - other.data[i][j];
-        }
-    }
+template <typename T>
+BasicMatrix<T> BasicMatrix<T>::subtract(ConstView other) const {
+    BasicMatrix result(rows, cols, "Result");
+    subtractInto(other, result);
+    return result;
+}
+
+template <typename T>
+BasicMatrix<T> BasicMatrix<T>::multiply(ConstView other, bool elementWise, kernels::GemmAlgorithm algorithm) const {
+    BasicMatrix result(rows, elementWise ? cols : other.getCols(), "Result");
+    multiplyInto(other, result, elementWise, algorithm);
+    return result;
+}
+
+template <typename T>
+BasicMatrix<T> BasicMatrix<T>::multiply(ConstView other, kernels::Transpose transposeThis,
+                                        kernels::Transpose transposeOther) const {
+    BasicMatrix result(transposeThis == kernels::Transpose::Yes ? cols : rows,
+                       transposeOther == kernels::Transpose::Yes ? other.getRows() : other.getCols(), "Result");
+    multiplyInto(other, transposeThis, transposeOther, result);
+    return result;
+}
+
+template <typename T>
+BasicMatrix<T> BasicMatrix<T>::multiply(T scalar) const {
+    BasicMatrix result(rows, cols, "Result");
+    multiplyInto(scalar, result);
+    return result;
+}
+
+template <typename T>
+BasicMatrix<T> BasicMatrix<T>::transpose() const {
+    BasicMatrix result(cols, rows, "Transposed");
+    transposeInto(result);
+    return result;
+}
+
+template <typename T>
+BasicMatrix<T>& BasicMatrix<T>::transposeInPlace() {
+    if (rows == cols) {
+        kernels::transposeInPlace(rows, data.data(), stride);
+        return *this;
+    }
+    // The new buffer comes from the same allocation source as the old one (see Workspace)
+    std::pmr::vector<T> transposed(rows * cols, data.get_allocator());
+    kernels::transpose(rows, cols, data.data(), stride, transposed.data(), rows);
+    data.swap(transposed);
+    std::swap(rows, cols);
+    stride = cols;
+    return *this;
+}
+
+template <typename T>
+BasicMatrix<T> BasicMatrix<T>::sumRows(kernels::Summation method) const {
+    BasicMatrix result(rows, 1, "sumRows");
+    sumRowsInto(result, method);
+    return result;
+}
+
+template <typename T>
+BasicMatrix<T> BasicMatrix<T>::sumColumns(kernels::Summation method) const {
+    BasicMatrix result(1, cols, "sumColumns");
+    sumColumnsInto(result, method);
     return result;
 }
 
-Matrix Matrix::multiply(const Matrix& other, bool elementWise) const {
+// Destination-passing Operations
+template <typename T>
+void BasicMatrix<T>::addInto(ConstView other, View out) const {
+    const ConstView operand = broadcastOperand(other, rows, cols, "addition");
+    checkOutput(out, rows, cols, true, "addition");
+    forEachRunWithView(rows, cols, stride == cols && out.isContiguous(), operand,
+                       [&](size_t row, size_t count, const T* run) {
+        kernels::add(count, rowPtr(row), run, out.getPointer() + row * out.getRowStride());
+    });
+}
+
+template <typename T>
+void BasicMatrix<T>::subtractInto(ConstView other, View out) const {
+    const ConstView operand = broadcastOperand(other, rows, cols, "subtraction");
+    checkOutput(out, rows, cols, true, "subtraction");
+    forEachRunWithView(rows, cols, stride == cols && out.isContiguous(), operand,
+                       [&](size_t row, size_t count, const T* run) {
+        kernels::subtract(count, rowPtr(row), run, out.getPointer() + row * out.getRowStride());
+    });
+}
+
+template <typename T>
+void BasicMatrix<T>::multiplyInto(ConstView other, View out, bool elementWise,
+                                  kernels::GemmAlgorithm algorithm) const {
     if (elementWise) {
-        if (rows != other.rows || cols != other.cols) {
-            throw std::invalid_argument("Matrices must have the same dimensions for element-wise multiplication.");
-        }
-        Matrix result(rows, cols, "Result");
-        for (size_t i = 0; i < rows; ++i) {
-            for (size_t j = 0; j < cols; ++j) {
-                result.data[i][j] = data[i][j] * other.data[i][j];
-            }
-        }
-        return result;
+        const ConstView operand = broadcastOperand(other, rows, cols, "element-wise multiplication");
+        checkOutput(out, rows, cols, true, "element-wise multiplication");
+        forEachRunWithView(rows, cols, stride == cols && out.isContiguous(), operand,
+                           [&](size_t row, size_t count, const T* run) {
+            kernels::multiply(count, rowPtr(row), run, out.getPointer() + row * out.getRowStride());
+        });
     } else {
-        if (cols != other.rows) {
+        if (cols != other.getRows()) {
             throw std::invalid_argument("Matrices have incompatible sizes for multiplication.");
         }
-        Matrix result(rows, other.cols, "Result");
-        for (size_t i = 0; i < rows; ++i) {
-            for (size_t j = 0; j < other.cols; ++j) {
-                result.data[i][j] = 0;
-                for (size_t k = 0; k < cols; ++k) {
-                    result.data[i][j] += data[i][k] * other.data[k][j];
-                }
-            }
-        }
-        return result;
+        checkOutput(out, rows, other.getCols(), false, "multiplication");
+        kernels::gemm(algorithm, T(1), view(), other, T(0), out);
     }
 }
 
-Matrix Matrix::multiply(double scalar) const {
-    Matrix result(rows, cols, "Result");
-    for (size_t i = 0; i < rows; ++i) {
-        for (size_t j = 0; j < cols; ++j) {
-            result.data[i][j] = data[i][j] * scalar;
-        }
+template <typename T>
+void BasicMatrix<T>::multiplyInto(ConstView other, kernels::Transpose transposeThis,
+                                  kernels::Transpose transposeOther, View out) const {
+    const ConstView a = (transposeThis == kernels::Transpose::Yes) ? view().transpose() : view();
+    const ConstView b = (transposeOther == kernels::Transpose::Yes) ? other.transpose() : other;
+    if (a.getCols() != b.getRows()) {
+        throw std::invalid_argument("Matrices have incompatible sizes for multiplication.");
     }
-    return result;
+    checkOutput(out, a.getRows(), b.getCols(), false, "multiplication");
+    kernels::gemm(T(1), a, b, T(0), out);
 }
 
-Matrix Matrix::transpose() const {
-    Matrix result(cols, rows, "Transposed");
+template <typename T>
+void BasicMatrix<T>::multiplyInto(T scalar, View out) const {
+    checkOutput(out, rows, cols, true, "scalar multiplication");
+    forEachRun(rows, cols, stride == cols && out.isContiguous(), [&](size_t row, size_t count) {
+        kernels::scale(count, rowPtr(row), scalar, out.getPointer() + row * out.getRowStride());
+    });
+}
+
+template <typename T>
+void BasicMatrix<T>::applyFunctionInto(const std::function<T(T)>& func, View out) const {
+    checkOutput(out, rows, cols, true, "applyFunction");
     for (size_t i = 0; i < rows; ++i) {
+        const T* in = rowPtr(i);
+        T* result = out.getPointer() + i * out.getRowStride();
         for (size_t j = 0; j < cols; ++j) {
-            result.data[j][i] = data[i][j];
+            result[j] = func(in[j]);
         }
     }
-    return result;
 }
 
-Matrix Matrix::sumRows() const {
+template <typename T>
+void BasicMatrix<T>::transposeInto(View out) const {
+    checkOutput(out, cols, rows, true, "transpose");
+    kernels::transpose(rows, cols, data.data(), stride, out.getPointer(), out.getRowStride());
+}
+
+template <typename T>
+void BasicMatrix<T>::sumRowsInto(View out, kernels::Summation method) const {
     if (rows == 0 || cols == 0 || data.empty()) {
         throw std::runtime_error("Cannot sum rows of an empty matrix.");
     }
-
-    Matrix result(rows, 1, "sumRows");
-    for (size_t i = 0; i < rows; i++) {
-        double sum = 0.0;
-        for (size_t j = 0; j < cols; j++) {
-            sum += data[i][j];
-        }
-        result(i, 0) = sum;
+    checkOutput(out, rows, 1, false, "sumRows");
+    if (out.getRowStride() == 1) {
+        kernels::sumRows(rows, cols, data.data(), stride, out.getPointer(), method);
+        return;
+    }
+    // A column of a larger matrix: sum into workspace scratch, then scatter
+    std::pmr::vector<T> sums(rows, Workspace::current());
+    kernels::sumRows(rows, cols, data.data(), stride, sums.data(), method);
+    for (size_t i = 0; i < rows; ++i) {
+        out.getPointer()[i * out.getRowStride()] = sums[i];
     }
-    return result;
 }
 
-Matrix Matrix::sumColumns() const {
+template <typename T>
+void BasicMatrix<T>::sumColumnsInto(View out, kernels::Summation method) const {
     if (rows == 0 || cols == 0 || data.empty()) {
         throw std::runtime_error("Cannot sum rows of an empty matrix.");
     }
+    checkOutput(out, 1, cols, true, "sumColumns");
 
-    Matrix result(1, cols, "sumColumns");
-    for (size_t j = 0; j < cols; j++) {
-        double sum = 0.0;
-        for (size_t i = 0; i < rows; i++) {
-            sum += data[i][j];
-        }
-        result(0, j) = sum;
+    // Accumulated row by row so the buffer is read sequentially
+    kernels::sumColumns(rows, cols, data.data(), stride, out.getPointer(), method);
+}
+
+template <typename T>
+T BasicMatrix<T>::sum(kernels::Summation method) const {
+    if (isEmpty()) {
+        throw std::runtime_error("Cannot reduce an empty matrix.");
     }
-    return result;
+    if (stride == cols) {
+        return kernels::sum(rows * cols, data.data(), method);
+    }
+    return sumRows(method).sum(method);
 }
 
-// Overloaded Operators
-Matrix Matrix::operator+(const Matrix& other) const {
-    return add(other);
+template <typename T>
+T BasicMatrix<T>::mean() const {
+    return sum() / static_cast<T>(rows * cols);
 }
 
-Matrix Matrix::operator-(const Matrix& other) const {
-    return subtract(other);
+template <typename T>
+T BasicMatrix<T>::max() const {
+    if (isEmpty()) {
+        throw std::runtime_error("Cannot reduce an empty matrix.");
+    }
+    if (stride == cols) {
+        return kernels::maxValue(rows * cols, data.data());
+    }
+    T best = kernels::maxValue(cols, rowPtr(0));
+    for (size_t i = 1; i < rows; ++i) {
+        best = std::max(best, kernels::maxValue(cols, rowPtr(i)));
+    }
+    return best;
 }
 
-Matrix Matrix::operator*(const Matrix& other) const {
-    return multiply(other, true); // Use element-wise multiplication
+template <typename T>
+std::pair<size_t, size_t> BasicMatrix<T>::argmax() const {
+    if (isEmpty()) {
+        throw std::runtime_error("Cannot reduce an empty matrix.");
+    }
+    if (stride == cols) {
+        const size_t index = kernels::argmax(rows * cols, data.data());
+        return {index / cols, index % cols};
+    }
+    std::pair<size_t, size_t> best{0, kernels::argmax(cols, rowPtr(0))};
+    for (size_t i = 1; i < rows; ++i) {
+        const size_t j = kernels::argmax(cols, rowPtr(i));
+        if (rowPtr(i)[j] > rowPtr(best.first)[best.second]) {
+            best = {i, j};
+        }
+    }
+    return best;
 }
 
-Matrix Matrix::operator*(double scalar) const {
-    return multiply(scalar);
+template <typename T>
+T BasicMatrix<T>::norm() const {
+    if (isEmpty()) {
+        throw std::runtime_error("Cannot reduce an empty matrix.");
+    }
+    if (stride == cols) {
+        return kernels::norm(rows * cols, data.data());
+    }
+    T squares = T(0);
+    for (size_t i = 0; i < rows; ++i) {
+        const T rowNorm = kernels::norm(cols, rowPtr(i));
+        squares += rowNorm * rowNorm;
+    }
+    return std::sqrt(squares);
 }
 
-Matrix Matrix::operator/(double scalar) const {
-    return multiply(1/scalar);
+// Compound Assignment
+template <typename T>
+BasicMatrix<T>& BasicMatrix<T>::operator*=(T scalar) {
+    forEachRun(rows, cols, stride == cols, [&](size_t row, size_t count) {
+        kernels::scale(count, rowPtr(row), scalar, rowPtr(row));
+    });
+    return *this;
+}
+
+template <typename T>
+BasicMatrix<T>& BasicMatrix<T>::operator/=(T scalar) {
+    return *this = *this / scalar;
 }
 
-double& Matrix::operator()(size_t row, size_t col) {
+template <typename T>
+BasicMatrix<T>& BasicMatrix<T>::axpy(T alpha, ConstView x) {
+    if (rows != x.getRows() || cols != x.getCols()) {
+        throw std::invalid_argument("Matrices must have the same dimensions for axpy.");
+    }
+    forEachRunWithView(rows, cols, stride == cols, x, [&](size_t row, size_t count, const T* run) {
+        kernels::axpy(count, alpha, run, rowPtr(row));
+    });
+    return *this;
+}
+
+// Overloaded Operators
+template <typename T>
+T& BasicMatrix<T>::operator()(size_t row, size_t col) {
     if (row >= rows || col >= cols) {
         throw std::out_of_range("Matrix indices out of range.");
     }
-    return data[row][col];
+    return rowPtr(row)[col];
 }
 
-const double& Matrix::operator()(size_t row, size_t col) const {
+template <typename T>
+const T& BasicMatrix<T>::operator()(size_t row, size_t col) const {
     if (row >= rows || col >= cols) {
         throw std::out_of_range("Matrix indices out of range.");
     }
-    return data[row][col];
+    return rowPtr(row)[col];
 }
 
-bool Matrix::operator==(const Matrix& other) const {
+template <typename T>
+bool BasicMatrix<T>::operator==(const BasicMatrix& other) const {
     if (rows != other.rows || cols != other.cols) {
         return false;
     }
     for (size_t i = 0; i < rows; ++i) {
-        for (size_t j = 0; j < cols; ++j) {
-            if (data[i][j] != other.data[i][j]) {
-                return false;
-            }
+        if (!std::equal(rowPtr(i), rowPtr(i) + cols, other.rowPtr(i))) {
+            return false;
         }
     }
     return true;
 }
 
-std::partial_ordering Matrix::operator<=>(const Matrix& other) const {
+template <typename T>
+std::partial_ordering BasicMatrix<T>::operator<=>(const BasicMatrix& other) const {
     size_t totalElements1 = rows * cols;
     size_t totalElements2 = other.rows * other.cols;
 
@@ -279,29 +540,34 @@ std::partial_ordering Matrix::operator<=>(const Matrix& other) const {
         return totalElements1 <=> totalElements2;
     }
 
-    double sum1 = 0;
-    double sum2 = 0;
+    T sum1 = 0;
+    T sum2 = 0;
     for (size_t i = 0; i < rows; ++i) {
+        const T* row = rowPtr(i);
         for (size_t j = 0; j < cols; ++j) {
-            sum1 += data[i][j];
+            sum1 += row[j];
         }
     }
     for (size_t i = 0; i < other.rows; ++i) {
+        const T* row = other.rowPtr(i);
         for (size_t j = 0; j < other.cols; ++j) {
-            sum2 += other.data[i][j];
+            sum2 += row[j];
         }
     }
 
     return sum1 <=> sum2;
 }
 
-bool Matrix::isEqual(const Matrix& other, double tolerance) const {
+template <typename T>
+bool BasicMatrix<T>::isEqual(const BasicMatrix& other, double tolerance) const {
     if (rows != other.rows || cols != other.cols) {
         return false;
     }
     for (size_t i = 0; i < rows; ++i) {
+        const T* a = rowPtr(i);
+        const T* b = other.rowPtr(i);
         for (size_t j = 0; j < cols; ++j) {
-            if (std::fabs(data[i][j] - other.data[i][j]) > tolerance) {
+            if (std::fabs(a[j] - b[j]) > tolerance) {
                 return false;
             }
         }
@@ -310,50 +576,44 @@ bool Matrix::isEqual(const Matrix& other, double tolerance) const {
 }
 
 // Friend functions for overloading the << and >> operators
-std::ostream& operator<<(std::ostream& os, const Matrix& matrix) {
+template <typename T>
+std::ostream& operator<<(std::ostream& os, const BasicMatrix<T>& matrix) {
     for (size_t i = 0; i < matrix.rows; ++i) {
+        const T* row = matrix.rowPtr(i);
         for (size_t j = 0; j < matrix.cols; ++j) {
-            os << std::setw(8) << matrix.data[i][j] << " ";
+            os << std::setw(8) << row[j] << " ";
         }
         os << "\n";
     }
     return os;
 }
 
-std::istream& operator>>(std::istream& is, Matrix& matrix) {
+template <typename T>
+std::istream& operator>>(std::istream& is, BasicMatrix<T>& matrix) {
     if (is.tellg() == std::streampos(-1)) {
         // Console input
         std::cout << "Enter the values for a " << matrix.rows << "x" << matrix.cols << " matrix:\n";
         for (size_t i = 0; i < matrix.rows; ++i) {
             for (size_t j = 0; j < matrix.cols; ++j) {
                 std::cout << "m[" << i << "][" << j << "] = ";
-                is >> matrix.data[i][j];
+                is >> matrix.rowPtr(i)[j];
             }
         }
     } else {
-        // File input
-        std::vector<std::vector<double>> tempData;
-        size_t cols = 0;
-        std::string line;
-
-        while (std::getline(is, line)) {
-            std::istringstream lineStream(line);
-            std::vector<double> row;
-            double value;
-            while (lineStream >> value) {
-                row.push_back(value);
-            }
-            if (cols == 0) {
-                cols = row.size();
-            } else if (row.size() != cols) {
-                throw std::runtime_error("Inconsistent number of columns in matrix data.");
-            }
-            tempData.push_back(row);
-        }
-
-        matrix.rows = tempData.size();
-        matrix.cols = cols;
-        matrix.data = tempData;
+        // File input: blocked from_chars parser (see matrix_file::readText)
+        BasicMatrix<T> parsed = matrix_file::readText<T>(is);
+        matrix.rows = parsed.rows;
+        matrix.cols = parsed.cols;
+        matrix.stride = parsed.stride;
+        matrix.data = std::move(parsed.data);
     }
     return is;
 }
+
+template class BasicMatrix<double>;
+template class BasicMatrix<float>;
+
+template std::ostream& operator<<(std::ostream& os, const BasicMatrix<double>& matrix);
+template std::ostream& operator<<(std::ostream& os, const BasicMatrix<float>& matrix);
+template std::istream& operator>>(std::istream& is, BasicMatrix<double>& matrix);
+template std::istream& operator>>(std::istream& is, BasicMatrix<float>& matrix);
@@ -0,0 +1,795 @@
+#include "../../include/matrix/MatrixFile.h"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+#include <future>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define MATRIX_FILE_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define MATRIX_FILE_HAS_MMAP 0
+#endif
+
+namespace matrix_file {
+
+namespace {
+
+constexpr char MAGIC[8] = {'N', 'N', 'M', 'A', 'T', 'R', 'I', 'X'};
+constexpr uint32_t VERSION = 1;
+constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+template <typename T>
+constexpr ElementType elementTypeOf() {
+    return std::is_same_v<T, double> ? ElementType::Float64 : ElementType::Float32;
+}
+
+constexpr size_t elementSizeOf(ElementType type) {
+    return type == ElementType::Float64 ? sizeof(double) : sizeof(float);
+}
+
+template <typename U>
+U byteSwap(U value) {
+    unsigned char bytes[sizeof(U)];
+    std::memcpy(bytes, &value, sizeof(U));
+    std::reverse(bytes, bytes + sizeof(U));
+    std::memcpy(&value, bytes, sizeof(U));
+    return value;
+}
+
+void swapHeader(Header& header) {
+    header.version = byteSwap(header.version);
+    header.elementType = static_cast<ElementType>(byteSwap(static_cast<uint32_t>(header.elementType)));
+    header.elementSize = byteSwap(header.elementSize);
+    header.rows = byteSwap(header.rows);
+    header.cols = byteSwap(header.cols);
+    header.dataOffset = byteSwap(header.dataOffset);
+}
+
+// Checks everything but the byte order and element type; returns the number of data bytes the header promises
+size_t validateHeader(const Header& header, size_t fileSize, const std::string& path) {
+    if (header.version != VERSION) {
+        throw std::runtime_error("Unsupported matrix file version in " + path + ".");
+    }
+    if ((header.elementType != ElementType::Float64 && header.elementType != ElementType::Float32) ||
+        header.elementSize != elementSizeOf(header.elementType)) {
+        throw std::runtime_error("Unknown element type in matrix file " + path + ".");
+    }
+    if (header.dataOffset < sizeof(Header) || header.dataOffset % header.elementSize != 0) {
+        throw std::runtime_error("Invalid data offset in matrix file " + path + ".");
+    }
+    const uint64_t limit = std::numeric_limits<size_t>::max() / header.elementSize;
+    if (header.cols != 0 && header.rows > limit / header.cols) {
+        throw std::runtime_error("Matrix file " + path + " is too large.");
+    }
+    const size_t bytes = static_cast<size_t>(header.rows * header.cols) * header.elementSize;
+    if (header.dataOffset > fileSize || fileSize - header.dataOffset < bytes) {
+        throw std::runtime_error("Matrix file " + path + " is truncated.");
+    }
+    return bytes;
+}
+
+// Returns true if the file was written with the other byte order (and swaps the header to native order)
+bool readByteOrder(Header& header, const std::string& path) {
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::runtime_error("Not a matrix file: " + path);
+    }
+    if (header.byteOrder == BYTE_ORDER_MARK) {
+        return false;
+    }
+    if (header.byteOrder != byteSwap(BYTE_ORDER_MARK)) {
+        throw std::runtime_error("Invalid byte-order mark in matrix file " + path + ".");
+    }
+    swapHeader(header);
+    return true;
+}
+
+template <typename T>
+void saveImpl(BasicMatrixView<const T> matrix, const std::string& path) {
+    const size_t count = matrix.getRows() * matrix.getCols();
+
+    // Header padded up to the aligned data offset, then the elements: a contiguous matrix is written straight
+    // from its own storage, anything else is gathered behind the header and written at once
+    Header header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.byteOrder = BYTE_ORDER_MARK;
+    header.elementType = elementTypeOf<T>();
+    header.elementSize = sizeof(T);
+    header.rows = matrix.getRows();
+    header.cols = matrix.getCols();
+    header.dataOffset = (sizeof(Header) + DATA_ALIGNMENT - 1) / DATA_ALIGNMENT * DATA_ALIGNMENT;
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("Cannot open matrix file for writing: " + path);
+    }
+    std::vector<char> buffer(header.dataOffset, 0);
+    std::memcpy(buffer.data(), &header, sizeof(Header));
+    if (matrix.isContiguous()) {
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        out.write(reinterpret_cast<const char*>(matrix.getPointer()),
+                  static_cast<std::streamsize>(count * sizeof(T)));
+    } else {
+        buffer.resize(header.dataOffset + count * sizeof(T));
+        T* elements = reinterpret_cast<T*>(buffer.data() + header.dataOffset);
+        for (size_t i = 0; i < matrix.getRows(); ++i) {
+            for (size_t j = 0; j < matrix.getCols(); ++j) {
+                elements[i * matrix.getCols() + j] = matrix[i, j];
+            }
+        }
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    }
+    if (!out) {
+        throw std::runtime_error("Failed to write matrix file: " + path);
+    }
+}
+
+// Converts count elements of the stored type (possibly byte-swapped) into T
+template <typename T, typename Stored>
+void convertElements(const char* bytes, size_t count, bool swapped, T* out) {
+    for (size_t k = 0; k < count; ++k) {
+        Stored value;
+        std::memcpy(&value, bytes + k * sizeof(Stored), sizeof(Stored));
+        out[k] = static_cast<T>(swapped ? byteSwap(value) : value);
+    }
+}
+
+// Header of an opened binary file, in native byte order, and whether the elements need swapping
+struct BinaryLayout {
+    Header header;
+    bool swapped;
+};
+
+// Opens a binary matrix file, validates its header and leaves the stream at the first element
+BinaryLayout openBinary(std::ifstream& in, const std::string& path) {
+    in.open(path, std::ios::binary | std::ios::ate);
+    if (!in) {
+        throw std::runtime_error("Cannot open matrix file: " + path);
+    }
+    const size_t fileSize = static_cast<size_t>(in.tellg());
+    in.seekg(0);
+    BinaryLayout layout{};
+    if (fileSize < sizeof(Header) || !in.read(reinterpret_cast<char*>(&layout.header), sizeof(Header))) {
+        throw std::runtime_error("Not a matrix file: " + path);
+    }
+    layout.swapped = readByteOrder(layout.header, path);
+    validateHeader(layout.header, fileSize, path);
+    in.seekg(static_cast<std::streamoff>(layout.header.dataOffset));
+    return layout;
+}
+
+// Reads the next out.getRows() rows from the current position into out, converting them if needed
+template <typename T>
+void readBinaryRows(std::istream& in, const BinaryLayout& layout, BasicMatrixView<T> out, const std::string& path) {
+    const Header& header = layout.header;
+    const size_t rowBytes = header.cols * header.elementSize;
+    const size_t bytes = out.getRows() * rowBytes;
+    if (!layout.swapped && header.elementType == elementTypeOf<T>() && out.isContiguous()) {
+        // Native layout: read straight into the matrix
+        in.read(reinterpret_cast<char*>(out.getPointer()), static_cast<std::streamsize>(bytes));
+    } else {
+        std::vector<char> raw(bytes);
+        in.read(raw.data(), static_cast<std::streamsize>(bytes));
+        for (size_t i = 0; i < out.getRows(); ++i) {
+            T* row = out.getPointer() + i * out.getRowStride();
+            if (header.elementType == ElementType::Float64) {
+                convertElements<T, double>(raw.data() + i * rowBytes, header.cols, layout.swapped, row);
+            } else {
+                convertElements<T, float>(raw.data() + i * rowBytes, header.cols, layout.swapped, row);
+            }
+        }
+    }
+    if (!in) {
+        throw std::runtime_error("Failed to read matrix file: " + path);
+    }
+}
+
+} // namespace
+
+void save(ConstMatrixView matrix, const std::string& path) {
+    saveImpl(matrix, path);
+}
+
+void save(ConstMatrixViewF matrix, const std::string& path) {
+    saveImpl(matrix, path);
+}
+
+template <typename T>
+BasicMatrix<T> load(const std::string& path) {
+    std::ifstream in;
+    const BinaryLayout layout = openBinary(in, path);
+    BasicMatrix<T> result(layout.header.rows, layout.header.cols, "Loaded");
+    readBinaryRows(in, layout, result.view(), path);
+    return result;
+}
+
+template BasicMatrix<double> load<double>(const std::string& path);
+template BasicMatrix<float> load<float>(const std::string& path);
+
+// Text
+
+namespace {
+
+// Size of the blocks the text reader reads and the text writer flushes
+constexpr size_t TEXT_BLOCK = size_t(1) << 20;
+
+// Longest shortest-form value (e.g. -2.2250738585072014e-308) plus a delimiter
+constexpr size_t MAX_FIELD = 32;
+
+inline bool isBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+bool isBlankLine(const char* begin, const char* end) {
+    return std::all_of(begin, end, isBlank);
+}
+
+// Reads a stream in large blocks and hands out one line at a time
+class LineSource {
+private:
+    std::istream& in;
+    std::vector<char> buffer;
+    size_t begin = 0;  // Unconsumed bytes are [begin, end)
+    size_t end = 0;
+    bool exhausted = false;
+
+public:
+    explicit LineSource(std::istream& in) : in(in), buffer(TEXT_BLOCK) {}
+
+    // Sets [first, last) to the next line without its '\n' (valid until the next call); false at the end
+    bool next(const char*& first, const char*& last) {
+        while (true) {
+            const char* start = buffer.data() + begin;
+            if (const void* newline = std::memchr(start, '\n', end - begin)) {
+                first = start;
+                last = static_cast<const char*>(newline);
+                begin = static_cast<size_t>(last - buffer.data()) + 1;
+                return true;
+            }
+            if (exhausted) {
+                if (begin == end) {
+                    return false;
+                }
+                first = start;
+                last = buffer.data() + end;  // Last line without a '\n'
+                begin = end;
+                return true;
+            }
+            // Move the unfinished line to the front and refill behind it
+            const size_t carried = end - begin;
+            std::memmove(buffer.data(), start, carried);
+            begin = 0;
+            end = carried;
+            if (carried == buffer.size()) {
+                buffer.resize(buffer.size() * 2);  // A single line longer than the buffer
+            }
+            in.read(buffer.data() + end, static_cast<std::streamsize>(buffer.size() - end));
+            end += static_cast<size_t>(in.gcount());
+            exhausted = !in;
+        }
+    }
+};
+
+// Calls onLine(first, last) for every line of the stream
+template <typename OnLine>
+void forEachLine(std::istream& in, OnLine&& onLine) {
+    LineSource lines(in);
+    const char* first;
+    const char* last;
+    while (lines.next(first, last)) {
+        onLine(first, last);
+    }
+}
+
+template <typename T>
+const char* parseValue(const char* first, const char* last, T& value, size_t line) {
+    if (first != last && *first == '+') {
+        ++first;  // from_chars does not accept an explicit plus sign
+    }
+    const auto [ptr, ec] = std::from_chars(first, last, value);
+    if (ec == std::errc::result_out_of_range) {
+        throw std::runtime_error("Value out of range in matrix data at line " + std::to_string(line) + ".");
+    }
+    if (ec != std::errc()) {
+        throw std::runtime_error("Invalid number in matrix data at line " + std::to_string(line) + ".");
+    }
+    return ptr;
+}
+
+// Parses the values of one line, calling sink(index, value) for each; returns the number of values
+template <typename T, typename Sink>
+size_t parseLine(const char* first, const char* last, Delimiter delimiter, size_t line, Sink&& sink) {
+    size_t count = 0;
+    T value;
+    if (delimiter == Delimiter::Whitespace) {
+        while (true) {
+            while (first != last && isBlank(*first)) {
+                ++first;
+            }
+            if (first == last) {
+                return count;
+            }
+            first = parseValue(first, last, value, line);
+            if (first != last && !isBlank(*first)) {
+                throw std::runtime_error("Invalid number in matrix data at line " + std::to_string(line) + ".");
+            }
+            sink(count++, value);
+        }
+    }
+    const char separator = static_cast<char>(delimiter);
+    auto skipPadding = [&] {
+        while (first != last && *first != separator && isBlank(*first)) {
+            ++first;
+        }
+    };
+    while (true) {
+        skipPadding();
+        first = parseValue(first, last, value, line);
+        sink(count++, value);
+        skipPadding();
+        if (first == last) {
+            return count;
+        }
+        if (*first != separator) {
+            throw std::runtime_error("Invalid number in matrix data at line " + std::to_string(line) + ".");
+        }
+        ++first;
+    }
+}
+
+[[noreturn]] void throwInconsistentColumns() {
+    throw std::runtime_error("Inconsistent number of columns in matrix data.");
+}
+
+// Single pass for streams that cannot be rewound: values are collected, then copied into the matrix once
+template <typename T>
+BasicMatrix<T> readTextCollected(std::istream& in, Delimiter delimiter) {
+    std::vector<T> values;
+    size_t rows = 0;
+    size_t cols = 0;
+    size_t line = 0;
+    forEachLine(in, [&](const char* first, const char* last) {
+        ++line;
+        if (isBlankLine(first, last)) {
+            return;
+        }
+        const size_t count = parseLine<T>(first, last, delimiter, line, [&](size_t, T value) {
+            values.push_back(value);
+        });
+        if (rows == 0) {
+            cols = count;
+        } else if (count != cols) {
+            throwInconsistentColumns();
+        }
+        ++rows;
+    });
+    return BasicMatrix<T>(BasicMatrixView<const T>(values.data(), rows, cols, cols), "Loaded");
+}
+
+template <typename T>
+void writeTextImpl(BasicMatrixView<const T> matrix, std::ostream& out, Delimiter delimiter) {
+    std::vector<char> buffer(TEXT_BLOCK);
+    char* const begin = buffer.data();
+    char* const end = begin + buffer.size();
+    char* next = begin;
+    const char separator = static_cast<char>(delimiter);
+    for (size_t i = 0; i < matrix.getRows(); ++i) {
+        for (size_t j = 0; j < matrix.getCols(); ++j) {
+            if (static_cast<size_t>(end - next) < MAX_FIELD) {
+                out.write(begin, next - begin);
+                next = begin;
+            }
+            next = std::to_chars(next, end, matrix[i, j]).ptr;
+            *next++ = (j + 1 == matrix.getCols()) ? '\n' : separator;
+        }
+    }
+    out.write(begin, next - begin);
+    if (!out) {
+        throw std::runtime_error("Failed to write matrix data.");
+    }
+}
+
+} // namespace
+
+template <typename T>
+BasicMatrix<T> readText(std::istream& in, Delimiter delimiter) {
+    const std::streampos start = in.tellg();
+    if (start == std::streampos(-1)) {
+        return readTextCollected<T>(in, delimiter);
+    }
+
+    // First pass: count the rows and take the width from the first one
+    size_t rows = 0;
+    size_t cols = 0;
+    size_t line = 0;
+    forEachLine(in, [&](const char* first, const char* last) {
+        ++line;
+        if (isBlankLine(first, last)) {
+            return;
+        }
+        if (rows == 0) {
+            cols = parseLine<T>(first, last, delimiter, line, [](size_t, T) {});
+        }
+        ++rows;
+    });
+
+    // Second pass: parse every row straight into its place in the matrix
+    BasicMatrix<T> result(rows, cols, "Loaded");
+    typename BasicMatrix<T>::View out = result.view();
+    in.clear();
+    in.seekg(start);
+    size_t row = 0;
+    line = 0;
+    forEachLine(in, [&](const char* first, const char* last) {
+        ++line;
+        if (isBlankLine(first, last)) {
+            return;
+        }
+        if (row == rows) {
+            throw std::runtime_error("Matrix data changed while it was being read.");
+        }
+        T* target = out.getPointer() + row * out.getRowStride();
+        const size_t count = parseLine<T>(first, last, delimiter, line, [&](size_t index, T value) {
+            if (index >= cols) {
+                throwInconsistentColumns();
+            }
+            target[index] = value;
+        });
+        if (count != cols) {
+            throwInconsistentColumns();
+        }
+        ++row;
+    });
+    if (row != rows) {
+        throw std::runtime_error("Matrix data changed while it was being read.");
+    }
+    return result;
+}
+
+template <typename T>
+BasicMatrix<T> loadText(const std::string& path, Delimiter delimiter) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        throw std::runtime_error("Cannot open matrix file: " + path);
+    }
+    return readText<T>(in, delimiter);
+}
+
+template BasicMatrix<double> readText<double>(std::istream& in, Delimiter delimiter);
+template BasicMatrix<float> readText<float>(std::istream& in, Delimiter delimiter);
+template BasicMatrix<double> loadText<double>(const std::string& path, Delimiter delimiter);
+template BasicMatrix<float> loadText<float>(const std::string& path, Delimiter delimiter);
+
+void writeText(ConstMatrixView matrix, std::ostream& out, Delimiter delimiter) {
+    writeTextImpl(matrix, out, delimiter);
+}
+
+void writeText(ConstMatrixViewF matrix, std::ostream& out, Delimiter delimiter) {
+    writeTextImpl(matrix, out, delimiter);
+}
+
+namespace {
+
+template <typename T>
+void saveTextImpl(BasicMatrixView<const T> matrix, const std::string& path, Delimiter delimiter) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("Cannot open matrix file for writing: " + path);
+    }
+    writeTextImpl(matrix, out, delimiter);
+}
+
+} // namespace
+
+void saveText(ConstMatrixView matrix, const std::string& path, Delimiter delimiter) {
+    saveTextImpl(matrix, path, delimiter);
+}
+
+void saveText(ConstMatrixViewF matrix, const std::string& path, Delimiter delimiter) {
+    saveTextImpl(matrix, path, delimiter);
+}
+
+} // namespace matrix_file
+
+// Constructors and Destructor
+template <typename T>
+BasicMappedMatrix<T>::BasicMappedMatrix(const std::string& path) {
+    using namespace matrix_file;
+#if MATRIX_FILE_HAS_MMAP
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Cannot open matrix file: " + path);
+    }
+    struct stat info{};
+    if (::fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(Header)) {
+        ::close(fd);
+        throw std::runtime_error("Not a matrix file: " + path);
+    }
+    mappingSize = static_cast<size_t>(info.st_size);
+    void* address = ::mmap(nullptr, mappingSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);  // The mapping keeps the file alive
+    if (address == MAP_FAILED) {
+        mappingSize = 0;
+        throw std::runtime_error("Cannot map matrix file: " + path);
+    }
+    mapping = address;
+#else
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) {
+        throw std::runtime_error("Cannot open matrix file: " + path);
+    }
+    mappingSize = static_cast<size_t>(in.tellg());
+    in.seekg(0);
+    char* buffer = new char[mappingSize];
+    mapping = buffer;
+    if (mappingSize < sizeof(Header) || !in.read(buffer, static_cast<std::streamsize>(mappingSize))) {
+        release();
+        throw std::runtime_error("Not a matrix file: " + path);
+    }
+#endif
+
+    try {
+        Header header;
+        std::memcpy(&header, mapping, sizeof(Header));
+        if (readByteOrder(header, path)) {
+            throw std::runtime_error("Matrix file " + path + " has the other byte order; use matrix_file::load().");
+        }
+        validateHeader(header, mappingSize, path);
+        if (header.elementType != elementTypeOf<T>()) {
+            throw std::runtime_error("Matrix file " + path + " has a different element type.");
+        }
+        data = reinterpret_cast<const T*>(static_cast<const char*>(mapping) + header.dataOffset);
+        rows = header.rows;
+        cols = header.cols;
+    } catch (...) {
+        release();
+        throw;
+    }
+}
+
+template <typename T>
+BasicMappedMatrix<T>::BasicMappedMatrix(BasicMappedMatrix&& other) noexcept
+    : mapping(std::exchange(other.mapping, nullptr)), mappingSize(std::exchange(other.mappingSize, 0)),
+      data(std::exchange(other.data, nullptr)), rows(std::exchange(other.rows, 0)),
+      cols(std::exchange(other.cols, 0)) {}
+
+template <typename T>
+BasicMappedMatrix<T>& BasicMappedMatrix<T>::operator=(BasicMappedMatrix&& other) noexcept {
+    if (this != &other) {
+        release();
+        mapping = std::exchange(other.mapping, nullptr);
+        mappingSize = std::exchange(other.mappingSize, 0);
+        data = std::exchange(other.data, nullptr);
+        rows = std::exchange(other.rows, 0);
+        cols = std::exchange(other.cols, 0);
+    }
+    return *this;
+}
+
+template <typename T>
+BasicMappedMatrix<T>::~BasicMappedMatrix() {
+    release();
+}
+
+template <typename T>
+void BasicMappedMatrix<T>::release() {
+    if (mapping != nullptr) {
+#if MATRIX_FILE_HAS_MMAP
+        ::munmap(const_cast<void*>(mapping), mappingSize);
+#else
+        delete[] static_cast<const char*>(mapping);
+#endif
+    }
+    mapping = nullptr;
+    mappingSize = 0;
+    data = nullptr;
+    rows = 0;
+    cols = 0;
+}
+
+// Access
+template <typename T>
+T BasicMappedMatrix<T>::operator()(size_t row, size_t col) const {
+    if (row >= rows || col >= cols) {
+        throw std::out_of_range("Matrix indices out of range.");
+    }
+    return data[row * cols + col];
+}
+
+template <typename T>
+BasicMatrix<T> BasicMappedMatrix<T>::toMatrix() const {
+    return BasicMatrix<T>(view(), "Mapped");
+}
+
+template class BasicMappedMatrix<double>;
+template class BasicMappedMatrix<float>;
+
+// Batch reader
+
+template <typename T>
+struct BasicBatchReader<T>::Source {
+    std::string path;
+    std::ifstream in;
+    bool text = false;
+    matrix_file::Delimiter delimiter = matrix_file::Delimiter::Whitespace;
+    size_t cols = 0;
+
+    // Binary files
+    matrix_file::BinaryLayout layout{};
+    size_t rowsRead = 0;
+
+    // Text files
+    std::unique_ptr<matrix_file::LineSource> lines;
+    size_t line = 0;
+
+    explicit Source(const std::string& path) : path(path) {}
+
+    void rewind() {
+        in.clear();
+        if (text) {
+            in.seekg(0);
+            lines = std::make_unique<matrix_file::LineSource>(in);
+            line = 0;
+        } else {
+            in.seekg(static_cast<std::streamoff>(layout.header.dataOffset));
+            rowsRead = 0;
+        }
+    }
+
+    std::optional<BasicMatrix<T>> readBinaryBatch(size_t batchRows) {
+        const size_t count = std::min<size_t>(batchRows, layout.header.rows - rowsRead);
+        if (count == 0) {
+            return std::nullopt;
+        }
+        BasicMatrix<T> batch(count, cols, "Batch");
+        matrix_file::readBinaryRows(in, layout, batch.view(), path);
+        rowsRead += count;
+        return batch;
+    }
+
+    std::optional<BasicMatrix<T>> readTextBatch(size_t batchRows) {
+        std::optional<BasicMatrix<T>> batch;
+        size_t row = 0;
+        const char* first;
+        const char* last;
+        while (row < batchRows && lines->next(first, last)) {
+            ++line;
+            if (matrix_file::isBlankLine(first, last)) {
+                continue;
+            }
+            if (cols == 0) {
+                // The first row of the file sets the width
+                std::vector<T> values;
+                matrix_file::parseLine<T>(first, last, delimiter, line, [&](size_t, T value) {
+                    values.push_back(value);
+                });
+                cols = values.size();
+                batch.emplace(batchRows, cols, "Batch");
+                std::copy(values.begin(), values.end(), batch->view().getPointer());
+            } else {
+                if (!batch) {
+                    batch.emplace(batchRows, cols, "Batch");
+                }
+                typename BasicMatrix<T>::View out = batch->view();
+                T* target = out.getPointer() + row * out.getRowStride();
+                const size_t count = matrix_file::parseLine<T>(first, last, delimiter, line,
+                                                               [&](size_t index, T value) {
+                    if (index >= cols) {
+                        matrix_file::throwInconsistentColumns();
+                    }
+                    target[index] = value;
+                });
+                if (count != cols) {
+                    matrix_file::throwInconsistentColumns();
+                }
+            }
+            ++row;
+        }
+        if (batch && row < batchRows) {
+            batch = BasicMatrix<T>(batch->view().rowRange(0, row), "Batch");  // Last, shorter batch
+        }
+        return batch;
+    }
+
+    std::optional<BasicMatrix<T>> readBatch(size_t batchRows) {
+        return text ? readTextBatch(batchRows) : readBinaryBatch(batchRows);
+    }
+};
+
+// Constructors and Destructor
+template <typename T>
+BasicBatchReader<T>::BasicBatchReader(const std::string& path, size_t batchRows)
+    : source(std::make_unique<Source>(path)), batchRows(batchRows) {
+    if (batchRows == 0) {
+        throw std::invalid_argument("Batch size must be positive.");
+    }
+    source->layout = matrix_file::openBinary(source->in, path);
+    source->cols = source->layout.header.cols;
+    readFirst();
+}
+
+template <typename T>
+BasicBatchReader<T>::BasicBatchReader(const std::string& path, size_t batchRows, matrix_file::Delimiter delimiter)
+    : source(std::make_unique<Source>(path)), batchRows(batchRows) {
+    if (batchRows == 0) {
+        throw std::invalid_argument("Batch size must be positive.");
+    }
+    source->in.open(path, std::ios::binary);
+    if (!source->in) {
+        throw std::runtime_error("Cannot open matrix file: " + path);
+    }
+    source->text = true;
+    source->delimiter = delimiter;
+    source->lines = std::make_unique<matrix_file::LineSource>(source->in);
+    readFirst();
+}
+
+template <typename T>
+BasicBatchReader<T>::~BasicBatchReader() {
+    // The read-ahead uses the source, so it has to finish first
+    if (pending.valid()) {
+        pending.wait();
+    }
+}
+
+// Getters
+template <typename T>
+size_t BasicBatchReader<T>::getCols() const {
+    return source->cols;
+}
+
+// Reading
+template <typename T>
+void BasicBatchReader<T>::prefetch() {
+    pending = std::async(std::launch::async, [this] { return source->readBatch(batchRows); });
+}
+
+template <typename T>
+void BasicBatchReader<T>::readFirst() {
+    // Also read on the background thread, so that no batch is ever allocated from the caller's Workspace; waiting
+    // here reports a bad file from the constructor
+    prefetch();
+    std::promise<std::optional<BasicMatrix<T>>> first;
+    first.set_value(pending.get());
+    pending = first.get_future();
+}
+
+template <typename T>
+std::optional<BasicMatrix<T>> BasicBatchReader<T>::next() {
+    if (!pending.valid()) {
+        throw std::runtime_error("A previous batch could not be read; call reset() to start again.");
+    }
+    std::optional<BasicMatrix<T>> batch = pending.get();
+    if (batch) {
+        prefetch();
+    } else {
+        std::promise<std::optional<BasicMatrix<T>>> end;
+        end.set_value(std::nullopt);
+        pending = end.get_future();
+    }
+    return batch;
+}
+
+template <typename T>
+void BasicBatchReader<T>::reset() {
+    if (pending.valid()) {
+        pending.wait();
+    }
+    source->rewind();
+    prefetch();
+}
+
+template class BasicBatchReader<double>;
+template class BasicBatchReader<float>;
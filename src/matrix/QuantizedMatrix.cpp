@@ -0,0 +1,360 @@
+#include "../../include/matrix/QuantizedMatrix.h"
+#include "../../include/matrix/Simd.h"
+#include "../../include/parallel/ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+
+#ifdef NN_SIMD_X86
+#define NN_TARGET_AVX512_VNNI __attribute__((target("avx512f,avx512bw,avx512vnni")))
+#endif
+
+namespace {
+
+// Rows are padded to this many bytes (one AVX-512 register), so the kernels never need a tail
+constexpr size_t ROW_ALIGNMENT = 64;
+
+// Output tile: rows of A times rows of B whose dot products are computed together, sharing their loads
+constexpr size_t TILE = 4;
+
+// Rows of A per parallel task (a multiple of TILE)
+constexpr size_t BAND = 32;
+
+struct Parameters {
+    float scale;
+    int32_t zeroPoint;
+};
+
+Parameters chooseParameters(double min, double max, QuantizationScheme scheme) {
+    if (scheme == QuantizationScheme::Symmetric) {
+        const double range = std::max(std::abs(min), std::abs(max));
+        return {range > 0 ? static_cast<float>(range / 127.0) : 1.0f, 0};
+    }
+    // The range always includes zero, so that zero (padding, ReLU outputs) is represented exactly
+    min = std::min(min, 0.0);
+    max = std::max(max, 0.0);
+    if (max == min) {
+        return {1.0f, 0};
+    }
+    const float scale = static_cast<float>((max - min) / 255.0);
+    const double zeroPoint = std::clamp(std::round(-128.0 - min / scale), -128.0, 127.0);
+    return {scale, static_cast<int32_t>(zeroPoint)};
+}
+
+// dots[r * TILE + c] = a[r] · b[c] over depth bytes (a multiple of ROW_ALIGNMENT)
+using TileKernel = void (*)(const int8_t* const* a, const int8_t* const* b, size_t depth, int32_t* dots);
+
+struct Kernel {
+    TileKernel tile;
+    bool biasedA;  // The kernel computes (a + 128) · b, which the caller corrects with the row sums of b
+};
+
+void tileScalar(const int8_t* const* a, const int8_t* const* b, size_t depth, int32_t* dots) {
+    for (size_t r = 0; r < TILE; ++r) {
+        for (size_t c = 0; c < TILE; ++c) {
+            int32_t sum = 0;
+            for (size_t k = 0; k < depth; ++k) {
+                sum += int32_t(a[r][k]) * int32_t(b[c][k]);
+            }
+            dots[r * TILE + c] = sum;
+        }
+    }
+}
+
+#ifdef NN_SIMD_X86
+NN_TARGET_AVX2 inline int32_t horizontalSum(__m256i v) {
+    __m128i sum = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4E));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xB1));
+    return _mm_cvtsi128_si32(sum);
+}
+
+// Sign-extends 16 bytes at a time to 16-bit lanes and multiply-adds pairs into 32-bit lanes (vpmaddwd), which is
+// exact for int8 inputs. Runs as two 4 x 2 passes so the accumulators and operands fit in the 16 registers.
+NN_TARGET_AVX2 void tileAvx2(const int8_t* const* a, const int8_t* const* b, size_t depth, int32_t* dots) {
+    for (size_t c0 = 0; c0 < TILE; c0 += 2) {
+        __m256i acc[TILE][2];
+        for (size_t r = 0; r < TILE; ++r) {
+            acc[r][0] = _mm256_setzero_si256();
+            acc[r][1] = _mm256_setzero_si256();
+        }
+        for (size_t k = 0; k < depth; k += 16) {
+            const __m256i b0 = _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(b[c0] + k)));
+            const __m256i b1 = _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(b[c0 + 1] + k)));
+            for (size_t r = 0; r < TILE; ++r) {
+                const __m256i ar = _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a[r] + k)));
+                acc[r][0] = _mm256_add_epi32(acc[r][0], _mm256_madd_epi16(ar, b0));
+                acc[r][1] = _mm256_add_epi32(acc[r][1], _mm256_madd_epi16(ar, b1));
+            }
+        }
+        for (size_t r = 0; r < TILE; ++r) {
+            dots[r * TILE + c0] = horizontalSum(acc[r][0]);
+            dots[r * TILE + c0 + 1] = horizontalSum(acc[r][1]);
+        }
+    }
+}
+
+// vpdpbusd multiplies unsigned by signed bytes and adds groups of four into 32-bit lanes, 64 bytes per instruction.
+// Flipping the sign bit of a turns it into the unsigned a + 128.
+NN_TARGET_AVX512_VNNI void tileVnni(const int8_t* const* a, const int8_t* const* b, size_t depth, int32_t* dots) {
+    const __m512i flip = _mm512_set1_epi8(static_cast<char>(0x80));
+    __m512i acc[TILE][TILE];
+    for (size_t r = 0; r < TILE; ++r) {
+        for (size_t c = 0; c < TILE; ++c) {
+            acc[r][c] = _mm512_setzero_si512();
+        }
+    }
+    for (size_t k = 0; k < depth; k += 64) {
+        __m512i bc[TILE];
+        for (size_t c = 0; c < TILE; ++c) {
+            bc[c] = _mm512_loadu_si512(b[c] + k);
+        }
+        for (size_t r = 0; r < TILE; ++r) {
+            const __m512i ar = _mm512_xor_si512(_mm512_loadu_si512(a[r] + k), flip);
+            for (size_t c = 0; c < TILE; ++c) {
+                acc[r][c] = _mm512_dpbusd_epi32(acc[r][c], ar, bc[c]);
+            }
+        }
+    }
+    for (size_t r = 0; r < TILE; ++r) {
+        for (size_t c = 0; c < TILE; ++c) {
+            // GCC 12 implements the 512-bit reduce, extract and cast intrinsics with an uninitialized merge source
+            // (-Wuninitialized), so the lanes are summed from memory; this runs once per tile, not per step
+            alignas(64) int32_t lanes[16];
+            _mm512_store_si512(lanes, acc[r][c]);
+            int32_t dot = 0;
+            for (int32_t lane : lanes) {
+                dot += lane;
+            }
+            dots[r * TILE + c] = dot;
+        }
+    }
+}
+
+bool hasVnni() {
+    static const bool supported = [] {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx512vnni") && __builtin_cpu_supports("avx512bw");
+    }();
+    return supported;
+}
+#endif
+
+Kernel selectKernel() {
+#ifdef NN_SIMD_X86
+    switch (simd::activeLevel()) {
+        case simd::Level::AVX512:
+            if (hasVnni()) {
+                return {tileVnni, true};
+            }
+            return {tileAvx2, false};
+        case simd::Level::AVX2:
+            return {tileAvx2, false};
+        default:
+            break;
+    }
+#endif
+    return {tileScalar, false};
+}
+
+template <typename T>
+void quantizedGemmImpl(const QuantizedMatrix& A, const QuantizedMatrix& B, T beta, BasicMatrixView<T> C,
+                       const kernels::Epilogue<T>& epilogue) {
+    if (A.getCols() != B.getCols() || C.getRows() != A.getRows() || C.getCols() != B.getRows()) {
+        throw std::invalid_argument("Quantized matrices have incompatible sizes for multiplication.");
+    }
+    const size_t M = A.getRows();
+    const size_t N = B.getRows();
+    if (M == 0 || N == 0) {
+        return;
+    }
+    if (M < TILE && N > M) {
+        // A few rows of inputs against many weights (e.g. one sample through a gate): tile the transposed product
+        // instead, so the tiles are full and there are enough bands to share out
+        const kernels::Epilogue<T> swapped{epilogue.colBias, epilogue.rowBias, epilogue.activation, epilogue.context};
+        quantizedGemmImpl(B, A, beta, C.transpose(), swapped);
+        return;
+    }
+
+    const Kernel kernel = selectKernel();
+    const int64_t K = static_cast<int64_t>(A.getCols());
+    const size_t depth = A.getStride();
+    const std::span<const float> scaleA = A.getScales();
+    const std::span<const float> scaleB = B.getScales();
+    const std::span<const int32_t> zeroA = A.getZeroPoints();
+    const std::span<const int32_t> zeroB = B.getZeroPoints();
+    const std::span<const int32_t> sumA = A.getRowSums();
+    const std::span<const int32_t> sumB = B.getRowSums();
+
+    auto band = [&](size_t b0, size_t b1) {
+        const size_t i0 = b0 * BAND;
+        const size_t i1 = std::min(b1 * BAND, M);
+        const int8_t* a[TILE];
+        const int8_t* b[TILE];
+        int32_t dots[TILE * TILE];
+        for (size_t i = i0; i < i1; i += TILE) {
+            // Rows past the edge repeat the last one and their results are dropped
+            const size_t tileRows = std::min(TILE, i1 - i);
+            for (size_t r = 0; r < TILE; ++r) {
+                a[r] = A.rowData(i + std::min(r, tileRows - 1));
+            }
+            for (size_t j = 0; j < N; j += TILE) {
+                const size_t tileCols = std::min(TILE, N - j);
+                for (size_t c = 0; c < TILE; ++c) {
+                    b[c] = B.rowData(j + std::min(c, tileCols - 1));
+                }
+                kernel.tile(a, b, depth, dots);
+
+                // sum over k of (a - za)(b - zb) = a·b - zb Σa - za Σb + K za zb, then scaled back
+                for (size_t r = 0; r < tileRows; ++r) {
+                    const int64_t za = zeroA[i + r];
+                    for (size_t c = 0; c < tileCols; ++c) {
+                        const int64_t zb = zeroB[j + c];
+                        int64_t dot = dots[r * TILE + c];
+                        if (kernel.biasedA) {
+                            dot -= int64_t(128) * sumB[j + c];
+                        }
+                        const int64_t centred = dot - zb * sumA[i + r] - za * sumB[j + c] + K * za * zb;
+                        T value = T(scaleA[i + r]) * T(scaleB[j + c]) * T(centred);
+                        if (epilogue.rowBias) {
+                            value += epilogue.rowBias[i + r];
+                        }
+                        if (epilogue.colBias) {
+                            value += epilogue.colBias[j + c];
+                        }
+                        T& out = C[i + r, j + c];
+                        out = (beta == T(0)) ? value : value + beta * out;
+                    }
+                }
+            }
+        }
+        if (epilogue.activation) {
+            epilogue.activation(epilogue.context, C.block(i0, 0, i1 - i0, N));
+        }
+    };
+
+    const size_t bands = (M + BAND - 1) / BAND;
+    ThreadPool& pool = ThreadPool::global();
+    if (M * N * A.getCols() < kernels::getGemmParallelThreshold() || pool.getThreadCount() == 1 || bands < 2) {
+        band(0, bands);
+        return;
+    }
+    pool.parallelFor(0, bands, band);
+}
+
+} // namespace
+
+// Constructors
+QuantizedMatrix::QuantizedMatrix()
+    : rows(0), cols(0), stride(0), granularity(QuantizationGranularity::PerRow),
+      scheme(QuantizationScheme::Symmetric) {}
+
+QuantizedMatrix::QuantizedMatrix(ConstMatrixView values, QuantizationGranularity granularity,
+                                 QuantizationScheme scheme)
+    : granularity(granularity), scheme(scheme) {
+    quantize(values);
+}
+
+QuantizedMatrix::QuantizedMatrix(ConstMatrixViewF values, QuantizationGranularity granularity,
+                                 QuantizationScheme scheme)
+    : granularity(granularity), scheme(scheme) {
+    quantize(values);
+}
+
+template <typename T>
+void QuantizedMatrix::quantize(BasicMatrixView<const T> values) {
+    rows = values.getRows();
+    cols = values.getCols();
+    stride = (cols + ROW_ALIGNMENT - 1) / ROW_ALIGNMENT * ROW_ALIGNMENT;
+    data.assign(rows * stride, 0);
+    scales.resize(rows);
+    zeroPoints.resize(rows);
+    rowSums.assign(rows, 0);
+
+    auto rangeOf = [&](size_t r0, size_t r1) {
+        double min = std::numeric_limits<double>::infinity();
+        double max = -min;
+        for (size_t i = r0; i < r1; ++i) {
+            for (size_t j = 0; j < cols; ++j) {
+                const double value = values[i, j];
+                min = std::min(min, value);
+                max = std::max(max, value);
+            }
+        }
+        return (min <= max) ? std::pair(min, max) : std::pair(0.0, 0.0);
+    };
+
+    Parameters shared{};
+    if (granularity == QuantizationGranularity::PerTensor) {
+        const auto [min, max] = rangeOf(0, rows);
+        shared = chooseParameters(min, max, scheme);
+    }
+    const float low = (scheme == QuantizationScheme::Symmetric) ? -127.0f : -128.0f;
+    for (size_t i = 0; i < rows; ++i) {
+        Parameters parameters = shared;
+        if (granularity == QuantizationGranularity::PerRow) {
+            const auto [min, max] = rangeOf(i, i + 1);
+            parameters = chooseParameters(min, max, scheme);
+        }
+        scales[i] = parameters.scale;
+        zeroPoints[i] = parameters.zeroPoint;
+
+        const float inverse = 1.0f / parameters.scale;
+        const float zeroPoint = static_cast<float>(parameters.zeroPoint);
+        int8_t* row = data.data() + i * stride;
+        int32_t sum = 0;
+        for (size_t j = 0; j < cols; ++j) {
+            const float scaled = std::nearbyint(static_cast<float>(values[i, j]) * inverse) + zeroPoint;
+            const float q = std::clamp(scaled, low, 127.0f);
+            row[j] = static_cast<int8_t>(q);
+            sum += row[j];
+        }
+        rowSums[i] = sum;
+    }
+}
+
+// Element Access
+float QuantizedMatrix::operator()(size_t row, size_t col) const {
+    if (row >= rows || col >= cols) {
+        throw std::out_of_range("Quantized matrix indices out of range.");
+    }
+    return scales[row] * static_cast<float>(int32_t(rowData(row)[col]) - zeroPoints[row]);
+}
+
+size_t QuantizedMatrix::getStorageBytes() const {
+    return data.size() + scales.size() * sizeof(float) + (zeroPoints.size() + rowSums.size()) * sizeof(int32_t);
+}
+
+// Conversion
+template <typename T>
+BasicMatrix<T> QuantizedMatrix::dequantize() const {
+    BasicMatrix<T> result(rows, cols, "dequantized");
+    for (size_t i = 0; i < rows; ++i) {
+        const int8_t* in = rowData(i);
+        T* out = result.rowData(i);
+        const T scale = scales[i];
+        for (size_t j = 0; j < cols; ++j) {
+            out[j] = scale * T(int32_t(in[j]) - zeroPoints[i]);
+        }
+    }
+    return result;
+}
+
+template BasicMatrix<double> QuantizedMatrix::dequantize<double>() const;
+template BasicMatrix<float> QuantizedMatrix::dequantize<float>() const;
+
+namespace kernels {
+
+void quantizedGemm(const QuantizedMatrix& A, const QuantizedMatrix& B, double beta, MatrixView C,
+                   const Epilogue<double>& epilogue) {
+    quantizedGemmImpl(A, B, beta, C, epilogue);
+}
+
+void quantizedGemm(const QuantizedMatrix& A, const QuantizedMatrix& B, float beta, MatrixViewF C,
+                   const Epilogue<float>& epilogue) {
+    quantizedGemmImpl(A, B, beta, C, epilogue);
+}
+
+} // namespace kernels
@@ -0,0 +1,175 @@
+#include "../../include/matrix/Random.h"
+#include "../../include/parallel/ThreadPool.h"
+#include <algorithm>
+#include <random>
+
+namespace {
+
+// Philox4x32 multipliers and Weyl key increments (Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3")
+constexpr uint32_t M0 = 0xD2511F53;
+constexpr uint32_t M1 = 0xCD9E8D57;
+constexpr uint32_t W0 = 0x9E3779B9;
+constexpr uint32_t W1 = 0xBB67AE85;
+constexpr int ROUNDS = 10;
+
+// Blocks generated together; the rounds run across the group so the compiler can vectorize them
+constexpr size_t GROUP = 16;
+
+// Buffers with fewer elements than this are filled on the calling thread
+std::atomic<size_t> parallelThreshold{1 << 16};
+
+inline uint32_t low(uint64_t x) {
+    return static_cast<uint32_t>(x);
+}
+
+inline uint32_t high(uint64_t x) {
+    return static_cast<uint32_t>(x >> 32);
+}
+
+// words[w][i] = word w of block first + i
+void generateGroup(uint64_t first, uint64_t stream, uint64_t key, uint32_t (&words)[4][GROUP]) {
+    uint32_t c0[GROUP], c1[GROUP], c2[GROUP], c3[GROUP];
+    for (size_t i = 0; i < GROUP; ++i) {
+        c0[i] = low(first + i);
+        c1[i] = high(first + i);
+        c2[i] = low(stream);
+        c3[i] = high(stream);
+    }
+    uint32_t k0 = low(key);
+    uint32_t k1 = high(key);
+    for (int round = 0; round < ROUNDS; ++round) {
+        for (size_t i = 0; i < GROUP; ++i) {
+            const uint64_t p0 = uint64_t(M0) * c0[i];
+            const uint64_t p1 = uint64_t(M1) * c2[i];
+            const uint32_t n0 = high(p1) ^ c1[i] ^ k0;
+            const uint32_t n2 = high(p0) ^ c3[i] ^ k1;
+            c0[i] = n0;
+            c1[i] = low(p1);
+            c2[i] = n2;
+            c3[i] = low(p0);
+        }
+        k0 += W0;
+        k1 += W1;
+    }
+    std::copy(c0, c0 + GROUP, words[0]);
+    std::copy(c1, c1 + GROUP, words[1]);
+    std::copy(c2, c2 + GROUP, words[2]);
+    std::copy(c3, c3 + GROUP, words[3]);
+}
+
+// Uniform [0, 1) from the top 24 bits of a word / the top 53 bits of two words
+inline float toUnit(uint32_t w) {
+    return static_cast<float>(w >> 8) * 0x1p-24f;
+}
+
+inline double toUnit(uint32_t hi, uint32_t lo) {
+    return static_cast<double>(((uint64_t(hi) << 32) | lo) >> 11) * 0x1p-53;
+}
+
+} // namespace
+
+// Constructors
+Philox::Philox(uint64_t seed, uint64_t stream) : key(seed), stream(stream), position(0) {}
+
+Philox::Philox(const Philox& other)
+    : key(other.key), stream(other.stream), position(other.position.load(std::memory_order_relaxed)) {}
+
+Philox& Philox::operator=(const Philox& other) {
+    key = other.key;
+    stream = other.stream;
+    position.store(other.position.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    return *this;
+}
+
+Philox& Philox::global() {
+    static Philox instance = [] {
+        std::random_device rd;
+        return Philox((uint64_t(rd()) << 32) | rd());
+    }();
+    return instance;
+}
+
+// Seeding
+Philox& Philox::seed(uint64_t seed, uint64_t stream) {
+    key = seed;
+    this->stream = stream;
+    position.store(0, std::memory_order_relaxed);
+    return *this;
+}
+
+Philox Philox::split() {
+    return Philox(next());
+}
+
+// Generation
+Philox::Block Philox::block(Block counter, std::array<uint32_t, 2> key) {
+    for (int round = 0; round < ROUNDS; ++round) {
+        const uint64_t p0 = uint64_t(M0) * counter[0];
+        const uint64_t p1 = uint64_t(M1) * counter[2];
+        counter = {high(p1) ^ counter[1] ^ key[0], low(p1), high(p0) ^ counter[3] ^ key[1], low(p0)};
+        key[0] += W0;
+        key[1] += W1;
+    }
+    return counter;
+}
+
+uint64_t Philox::next() {
+    const uint64_t index = position.fetch_add(1, std::memory_order_relaxed);
+    const Block words = block({low(index), high(index), low(stream), high(stream)}, {low(key), high(key)});
+    return (uint64_t(words[0]) << 32) | words[1];
+}
+
+template <typename T>
+void Philox::fill(T* out, size_t count, T min, T max) {
+    if (count == 0) {
+        return;
+    }
+    // Element e comes from block base + e / perBlock, whichever thread generates it
+    constexpr size_t perBlock = sizeof(T) == sizeof(double) ? 2 : 4;
+    const size_t blocks = (count + perBlock - 1) / perBlock;
+    const uint64_t base = position.fetch_add(blocks, std::memory_order_relaxed);
+    const T scale = max - min;
+
+    auto body = [&](size_t g0, size_t g1) {
+        uint32_t words[4][GROUP];
+        for (size_t g = g0; g < g1; ++g) {
+            generateGroup(base + g * GROUP, stream, key, words);
+            const size_t first = g * GROUP * perBlock;
+            const size_t n = std::min(GROUP * perBlock, count - first);
+            T* dst = out + first;
+            for (size_t k = 0; k < n; ++k) {
+                const size_t i = k / perBlock;
+                const size_t lane = k % perBlock;
+                if constexpr (perBlock == 2) {
+                    dst[k] = min + scale * toUnit(words[2 * lane][i], words[2 * lane + 1][i]);
+                } else {
+                    dst[k] = min + scale * toUnit(words[lane][i]);
+                }
+            }
+        }
+    };
+
+    const size_t groups = (blocks + GROUP - 1) / GROUP;
+    ThreadPool& pool = ThreadPool::global();
+    if (count < getParallelThreshold() || pool.getThreadCount() == 1 || groups == 1) {
+        body(0, groups);
+        return;
+    }
+    pool.parallelFor(0, groups, body);
+}
+
+void Philox::fillUniform(double* out, size_t count, double min, double max) {
+    fill(out, count, min, max);
+}
+
+void Philox::fillUniform(float* out, size_t count, float min, float max) {
+    fill(out, count, min, max);
+}
+
+void Philox::setParallelThreshold(size_t elements) {
+    parallelThreshold.store(elements, std::memory_order_relaxed);
+}
+
+size_t Philox::getParallelThreshold() {
+    return parallelThreshold.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,355 @@
+#include "../../include/matrix/Reduce.h"
+#include "../../include/parallel/ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <vector>
+
+namespace kernels {
+
+namespace {
+
+// Independent accumulators per loop (two AVX2 registers of doubles, one of floats)
+constexpr size_t LANES = 8;
+
+// Leaf size of the pairwise tree
+constexpr size_t BLOCK = 128;
+
+// Unit of parallel work for long vectors; fixed, so the grouping of the additions never depends on the thread count
+constexpr size_t CHUNK = size_t(1) << 14;
+
+// Columns per parallel band in sumColumns (a band of doubles is 2 KB, and stays in L1 while the rows stream past)
+constexpr size_t BAND = 256;
+
+// Inputs with fewer elements than this stay on the calling thread
+std::atomic<size_t> parallelThreshold{size_t(1) << 17};
+
+template <typename T>
+T combineLanes(const T (&acc)[LANES]) {
+    return ((acc[0] + acc[1]) + (acc[2] + acc[3])) + ((acc[4] + acc[5]) + (acc[6] + acc[7]));
+}
+
+// Value contributed by x: itself for sums, its square for norms
+template <bool Squares, typename T>
+inline T term(T x) {
+    if constexpr (Squares) {
+        return x * x;
+    } else {
+        return x;
+    }
+}
+
+template <bool Squares, typename T>
+T naiveSum(size_t n, const T* x) {
+    T sum = T(0);
+    for (size_t i = 0; i < n; ++i) {
+        sum += term<Squares>(x[i]);
+    }
+    return sum;
+}
+
+template <bool Squares, typename T>
+T blockSum(size_t n, const T* x) {
+    T acc[LANES] = {};
+    size_t i = 0;
+    for (; i + LANES <= n; i += LANES) {
+        for (size_t k = 0; k < LANES; ++k) {
+            acc[k] += term<Squares>(x[i + k]);
+        }
+    }
+    T sum = combineLanes(acc);
+    for (; i < n; ++i) {
+        sum += term<Squares>(x[i]);
+    }
+    return sum;
+}
+
+template <bool Squares, typename T>
+T pairwiseSum(size_t n, const T* x) {
+    if (n <= BLOCK) {
+        return blockSum<Squares>(n, x);
+    }
+    // Split near the middle, on a lane boundary
+    const size_t half = (n / 2 + LANES - 1) / LANES * LANES;
+    return pairwiseSum<Squares>(half, x) + pairwiseSum<Squares>(n - half, x + half);
+}
+
+// One step of Kahan-Babuska (Neumaier) summation: sum + compensation holds the exact running total
+template <typename T>
+inline void compensatedAdd(T& sum, T& compensation, T value) {
+    const T t = sum + value;
+    compensation += (std::abs(sum) >= std::abs(value)) ? (sum - t) + value : (value - t) + sum;
+    sum = t;
+}
+
+template <typename T>
+T kahanSum(size_t n, const T* x) {
+    T sums[LANES] = {};
+    T compensations[LANES] = {};
+    size_t i = 0;
+    for (; i + LANES <= n; i += LANES) {
+        for (size_t k = 0; k < LANES; ++k) {
+            compensatedAdd(sums[k], compensations[k], x[i + k]);
+        }
+    }
+    T sum = T(0);
+    T compensation = T(0);
+    for (size_t k = 0; k < LANES; ++k) {
+        compensatedAdd(sum, compensation, sums[k]);
+        compensation += compensations[k];
+    }
+    for (; i < n; ++i) {
+        compensatedAdd(sum, compensation, x[i]);
+    }
+    return sum + compensation;
+}
+
+template <typename T>
+T serialSum(size_t n, const T* x, Summation method) {
+    switch (method) {
+        case Summation::Naive:
+            return naiveSum<false>(n, x);
+        case Summation::Kahan:
+            return kahanSum(n, x);
+        case Summation::Pairwise:
+        default:
+            return pairwiseSum<false>(n, x);
+    }
+}
+
+// Runs body(chunkBegin, chunkEnd) over [0, chunks), on the global pool when there is enough work
+void forEachChunk(size_t chunks, size_t work, const std::function<void(size_t, size_t)>& body) {
+    ThreadPool& pool = ThreadPool::global();
+    if (work < getReductionParallelThreshold() || pool.getThreadCount() == 1 || chunks < 2) {
+        body(0, chunks);
+        return;
+    }
+    pool.parallelFor(0, chunks, body);
+}
+
+// Reduces each CHUNK of x with chunkReduce, in parallel, and returns the partial results in order
+template <typename T, typename ChunkReduce>
+std::vector<T> reduceChunks(size_t n, const T* x, ChunkReduce chunkReduce) {
+    const size_t chunks = (n + CHUNK - 1) / CHUNK;
+    std::vector<T> partials(chunks);
+    forEachChunk(chunks, n, [&](size_t c0, size_t c1) {
+        for (size_t c = c0; c < c1; ++c) {
+            const size_t begin = c * CHUNK;
+            partials[c] = chunkReduce(std::min(CHUNK, n - begin), x + begin);
+        }
+    });
+    return partials;
+}
+
+template <typename T>
+T sumImpl(size_t n, const T* x, Summation method) {
+    if (n < getReductionParallelThreshold()) {
+        return serialSum(n, x, method);
+    }
+    const std::vector<T> partials = reduceChunks(n, x, [method](size_t m, const T* chunk) {
+        return serialSum(m, chunk, method);
+    });
+    return serialSum(partials.size(), partials.data(), method);
+}
+
+template <typename T>
+T normImpl(size_t n, const T* x) {
+    if (n < getReductionParallelThreshold()) {
+        return std::sqrt(pairwiseSum<true>(n, x));
+    }
+    const std::vector<T> partials = reduceChunks(n, x, [](size_t m, const T* chunk) {
+        return pairwiseSum<true>(m, chunk);
+    });
+    return std::sqrt(pairwiseSum<false>(partials.size(), partials.data()));
+}
+
+template <typename T>
+T serialMax(size_t n, const T* x) {
+    T acc[LANES];
+    std::fill(acc, acc + LANES, x[0]);
+    size_t i = 0;
+    for (; i + LANES <= n; i += LANES) {
+        for (size_t k = 0; k < LANES; ++k) {
+            acc[k] = x[i + k] > acc[k] ? x[i + k] : acc[k];
+        }
+    }
+    T best = *std::max_element(acc, acc + LANES);
+    for (; i < n; ++i) {
+        best = x[i] > best ? x[i] : best;
+    }
+    return best;
+}
+
+template <typename T>
+T maxImpl(size_t n, const T* x) {
+    if (n < getReductionParallelThreshold()) {
+        return serialMax(n, x);
+    }
+    const std::vector<T> partials = reduceChunks(n, x, serialMax<T>);
+    return serialMax(partials.size(), partials.data());
+}
+
+template <typename T>
+size_t argmaxImpl(size_t n, const T* x) {
+    // Find the value with the vectorized maximum, then its first position
+    const T best = maxImpl(n, x);
+    const size_t index = static_cast<size_t>(std::find(x, x + n, best) - x);
+    return index < n ? index : 0;  // Only a NaN maximum is not found again
+}
+
+template <typename T>
+void sumRowsImpl(size_t rows, size_t cols, const T* a, size_t lda, T* out, Summation method) {
+    if (cols >= getReductionParallelThreshold()) {
+        // Long rows: each row is split across the pool by sum()
+        for (size_t i = 0; i < rows; ++i) {
+            out[i] = sumImpl(cols, a + i * lda, method);
+        }
+        return;
+    }
+    forEachChunk(rows, rows * cols, [&](size_t r0, size_t r1) {
+        for (size_t i = r0; i < r1; ++i) {
+            out[i] = serialSum(cols, a + i * lda, method);
+        }
+    });
+}
+
+// Number of levels of the tree pairwiseColumns() builds over rows rows; each needs width elements of scratch
+inline size_t pairwiseLevels(size_t rows) {
+    size_t levels = 0;
+    for (; rows > BLOCK; rows -= rows / 2) {
+        ++levels;
+    }
+    return levels;
+}
+
+// out[0 .. width) = column sums of rows [r0, r1), accumulated as a balanced tree over the rows. scratch holds
+// pairwiseLevels(r1 - r0) * width elements: the right half of a node is summed into the first width of them, and
+// both halves pass the rest down.
+template <typename T>
+void pairwiseColumns(size_t r0, size_t r1, size_t width, const T* a, size_t lda, T* out, T* scratch) {
+    if (r1 - r0 <= BLOCK) {
+        std::fill(out, out + width, T(0));
+        for (size_t i = r0; i < r1; ++i) {
+            const T* row = a + i * lda;
+            for (size_t j = 0; j < width; ++j) {
+                out[j] += row[j];
+            }
+        }
+        return;
+    }
+    const size_t middle = r0 + (r1 - r0) / 2;
+    T* right = scratch;
+    pairwiseColumns(r0, middle, width, a, lda, out, scratch + width);
+    pairwiseColumns(middle, r1, width, a, lda, right, scratch + width);
+    for (size_t j = 0; j < width; ++j) {
+        out[j] += right[j];
+    }
+}
+
+// Column sums of one band of columns; adjacent columns are independent, so every loop vectorizes across them
+template <typename T>
+void sumBand(size_t rows, size_t width, const T* a, size_t lda, T* out, Summation method) {
+    switch (method) {
+        case Summation::Naive:
+            std::fill(out, out + width, T(0));
+            for (size_t i = 0; i < rows; ++i) {
+                const T* row = a + i * lda;
+                for (size_t j = 0; j < width; ++j) {
+                    out[j] += row[j];
+                }
+            }
+            return;
+        case Summation::Kahan: {
+            std::vector<T> compensations(width, T(0));
+            std::fill(out, out + width, T(0));
+            for (size_t i = 0; i < rows; ++i) {
+                const T* row = a + i * lda;
+                for (size_t j = 0; j < width; ++j) {
+                    compensatedAdd(out[j], compensations[j], row[j]);
+                }
+            }
+            for (size_t j = 0; j < width; ++j) {
+                out[j] += compensations[j];
+            }
+            return;
+        }
+        case Summation::Pairwise:
+        default: {
+            std::vector<T> scratch(pairwiseLevels(rows) * width);
+            pairwiseColumns(size_t(0), rows, width, a, lda, out, scratch.data());
+            return;
+        }
+    }
+}
+
+template <typename T>
+void sumColumnsImpl(size_t rows, size_t cols, const T* a, size_t lda, T* out, Summation method) {
+    const size_t bands = (cols + BAND - 1) / BAND;
+    forEachChunk(bands, rows * cols, [&](size_t b0, size_t b1) {
+        for (size_t b = b0; b < b1; ++b) {
+            const size_t j0 = b * BAND;
+            sumBand(rows, std::min(BAND, cols - j0), a + j0, lda, out + j0, method);
+        }
+    });
+}
+
+} // namespace
+
+double sum(size_t n, const double* x, Summation method) {
+    return sumImpl(n, x, method);
+}
+
+float sum(size_t n, const float* x, Summation method) {
+    return sumImpl(n, x, method);
+}
+
+double norm(size_t n, const double* x) {
+    return normImpl(n, x);
+}
+
+float norm(size_t n, const float* x) {
+    return normImpl(n, x);
+}
+
+double maxValue(size_t n, const double* x) {
+    return maxImpl(n, x);
+}
+
+float maxValue(size_t n, const float* x) {
+    return maxImpl(n, x);
+}
+
+size_t argmax(size_t n, const double* x) {
+    return argmaxImpl(n, x);
+}
+
+size_t argmax(size_t n, const float* x) {
+    return argmaxImpl(n, x);
+}
+
+void sumRows(size_t rows, size_t cols, const double* a, size_t lda, double* out, Summation method) {
+    sumRowsImpl(rows, cols, a, lda, out, method);
+}
+
+void sumRows(size_t rows, size_t cols, const float* a, size_t lda, float* out, Summation method) {
+    sumRowsImpl(rows, cols, a, lda, out, method);
+}
+
+void sumColumns(size_t rows, size_t cols, const double* a, size_t lda, double* out, Summation method) {
+    sumColumnsImpl(rows, cols, a, lda, out, method);
+}
+
+void sumColumns(size_t rows, size_t cols, const float* a, size_t lda, float* out, Summation method) {
+    sumColumnsImpl(rows, cols, a, lda, out, method);
+}
+
+void setReductionParallelThreshold(size_t elements) {
+    parallelThreshold.store(elements, std::memory_order_relaxed);
+}
+
+size_t getReductionParallelThreshold() {
+    return parallelThreshold.load(std::memory_order_relaxed);
+}
+
+} // namespace kernels
@@ -0,0 +1,47 @@
+#include "../../include/matrix/Simd.h"
+#include <atomic>
+
+namespace simd {
+
+namespace {
+
+Level probeLevel() {
+#ifdef NN_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return Level::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return Level::AVX2;
+    }
+    return Level::SSE2;
+#else
+    return Level::Scalar;
+#endif
+}
+
+std::atomic<Level>& activeLevelStorage() {
+    static std::atomic<Level> level(detectedLevel());
+    return level;
+}
+
+} // namespace
+
+Level detectedLevel() {
+    static const Level level = probeLevel();
+    return level;
+}
+
+Level activeLevel() {
+    return activeLevelStorage().load(std::memory_order_relaxed);
+}
+
+Level setActiveLevel(Level level) {
+    if (level > detectedLevel()) {
+        level = detectedLevel();
+    }
+    activeLevelStorage().store(level, std::memory_order_relaxed);
+    return level;
+}
+
+} // namespace simd
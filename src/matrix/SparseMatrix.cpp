@@ -0,0 +1,229 @@
+#include "../../include/matrix/SparseMatrix.h"
+#include "../../include/matrix/ElementWise.h"
+#include "../../include/matrix/Gemm.h"
+#include "../../include/parallel/ThreadPool.h"
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+
+namespace {
+
+// Runs body(rowBegin, rowEnd) over [0, rows), in parallel when the product is as large as a parallel GEMM
+void forEachRowBand(size_t rows, size_t work, const std::function<void(size_t, size_t)>& body) {
+    ThreadPool& pool = ThreadPool::global();
+    if (work < kernels::getGemmParallelThreshold() || pool.getThreadCount() == 1 || rows < 2) {
+        body(0, rows);
+        return;
+    }
+    pool.parallelFor(0, rows, body);
+}
+
+} // namespace
+
+// Constructors
+template <typename T>
+BasicSparseMatrix<T>::BasicSparseMatrix(size_t rows, size_t cols)
+    : rows(rows), cols(cols), rowOffsets(rows + 1, 0) {}
+
+template <typename T>
+BasicSparseMatrix<T>::BasicSparseMatrix(size_t rows, size_t cols, std::vector<size_t> rowOffsets,
+                                        std::vector<size_t> colIndices, std::vector<T> values)
+    : rows(rows), cols(cols), rowOffsets(std::move(rowOffsets)), colIndices(std::move(colIndices)),
+      values(std::move(values)) {
+    if (this->rowOffsets.size() != rows + 1 || this->rowOffsets.front() != 0 ||
+        this->rowOffsets.back() != this->values.size() || this->colIndices.size() != this->values.size()) {
+        throw std::invalid_argument("Sparse matrix arrays have inconsistent sizes.");
+    }
+    for (size_t i = 0; i < rows; ++i) {
+        const size_t begin = this->rowOffsets[i];
+        const size_t end = this->rowOffsets[i + 1];
+        if (begin > end) {
+            throw std::invalid_argument("Sparse matrix row offsets must be non-decreasing.");
+        }
+        for (size_t p = begin; p < end; ++p) {
+            if (this->colIndices[p] >= cols || (p > begin && this->colIndices[p] <= this->colIndices[p - 1])) {
+                throw std::invalid_argument("Sparse matrix column indices must be in range and increasing.");
+            }
+        }
+        if (end > begin) {
+            activeRows.push_back(i);
+        }
+    }
+}
+
+template <typename T>
+BasicSparseMatrix<T> BasicSparseMatrix<T>::fromDense(ConstView dense) {
+    BasicSparseMatrix result(0, dense.getCols());
+    std::vector<size_t> indices;
+    std::vector<T> rowValues;
+    for (size_t i = 0; i < dense.getRows(); ++i) {
+        indices.clear();
+        rowValues.clear();
+        for (size_t j = 0; j < dense.getCols(); ++j) {
+            const T value = dense[i, j];
+            if (value != T(0)) {
+                indices.push_back(j);
+                rowValues.push_back(value);
+            }
+        }
+        result.appendRow(indices, rowValues);
+    }
+    return result;
+}
+
+// Building
+template <typename T>
+BasicSparseMatrix<T>& BasicSparseMatrix<T>::appendRow(std::span<const size_t> indices, std::span<const T> rowValues) {
+    if (indices.size() != rowValues.size()) {
+        throw std::invalid_argument("Sparse row needs one value per index.");
+    }
+    for (size_t p = 0; p < indices.size(); ++p) {
+        if (indices[p] >= cols || (p > 0 && indices[p] <= indices[p - 1])) {
+            throw std::invalid_argument("Sparse matrix column indices must be in range and increasing.");
+        }
+    }
+    colIndices.insert(colIndices.end(), indices.begin(), indices.end());
+    values.insert(values.end(), rowValues.begin(), rowValues.end());
+    rowOffsets.push_back(values.size());
+    if (!indices.empty()) {
+        activeRows.push_back(rows);
+    }
+    ++rows;
+    return *this;
+}
+
+// Getters
+template <typename T>
+double BasicSparseMatrix<T>::density() const {
+    if (rows == 0 || cols == 0) {
+        return 0.0;
+    }
+    return static_cast<double>(values.size()) / (static_cast<double>(rows) * static_cast<double>(cols));
+}
+
+template <typename T>
+T BasicSparseMatrix<T>::operator()(size_t row, size_t col) const {
+    if (row >= rows || col >= cols) {
+        throw std::out_of_range("Sparse matrix indices out of range.");
+    }
+    const auto begin = colIndices.begin() + rowOffsets[row];
+    const auto end = colIndices.begin() + rowOffsets[row + 1];
+    const auto it = std::lower_bound(begin, end, col);
+    return (it != end && *it == col) ? values[it - colIndices.begin()] : T(0);
+}
+
+// Conversion
+template <typename T>
+BasicMatrix<T> BasicSparseMatrix<T>::toDense() const {
+    BasicMatrix<T> result(rows, cols, "Dense");
+    for (size_t i : activeRows) {
+        for (size_t p = rowOffsets[i]; p < rowOffsets[i + 1]; ++p) {
+            result(i, colIndices[p]) = values[p];
+        }
+    }
+    return result;
+}
+
+template <typename T>
+BasicSparseMatrix<T> BasicSparseMatrix<T>::transpose() const {
+    // Counting sort by column: count entries per column, prefix-sum into offsets, then scatter row by row
+    // (visiting rows in order keeps the new column indices sorted)
+    std::vector<size_t> offsets(cols + 1, 0);
+    for (size_t j : colIndices) {
+        ++offsets[j + 1];
+    }
+    for (size_t j = 0; j < cols; ++j) {
+        offsets[j + 1] += offsets[j];
+    }
+    std::vector<size_t> indices(values.size());
+    std::vector<T> transposedValues(values.size());
+    std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+    for (size_t i : activeRows) {
+        for (size_t p = rowOffsets[i]; p < rowOffsets[i + 1]; ++p) {
+            const size_t q = next[colIndices[p]]++;
+            indices[q] = i;
+            transposedValues[q] = values[p];
+        }
+    }
+    return BasicSparseMatrix(cols, rows, std::move(offsets), std::move(indices), std::move(transposedValues));
+}
+
+// Products
+template <typename T>
+BasicMatrix<T> BasicSparseMatrix<T>::multiply(ConstView dense) const {
+    if (dense.getRows() != cols) {
+        throw std::invalid_argument("Matrices have incompatible sizes for multiplication.");
+    }
+    const size_t n = dense.getCols();
+    BasicMatrix<T> result(rows, n, "Result");
+    typename BasicMatrix<T>::View out = result.view();
+    forEachRowBand(activeRows.size(), values.size() * n, [&](size_t a0, size_t a1) {
+        for (size_t a = a0; a < a1; ++a) {
+            const size_t i = activeRows[a];
+            T* row = out.getPointer() + i * out.getRowStride();
+            for (size_t p = rowOffsets[i]; p < rowOffsets[i + 1]; ++p) {
+                const ConstView source = dense.row(colIndices[p]);
+                if (source.hasContiguousRows()) {
+                    kernels::axpy(n, values[p], source.getPointer(), row);
+                } else {
+                    for (size_t j = 0; j < n; ++j) {
+                        row[j] += values[p] * source.getPointer()[j * source.getColStride()];
+                    }
+                }
+            }
+        }
+    });
+    return result;
+}
+
+template <typename T>
+BasicMatrix<T> BasicSparseMatrix<T>::leftMultiply(ConstView dense) const {
+    if (dense.getCols() != rows) {
+        throw std::invalid_argument("Matrices have incompatible sizes for multiplication.");
+    }
+    const size_t m = dense.getRows();
+    BasicMatrix<T> result(m, cols, "Result");
+    typename BasicMatrix<T>::View out = result.view();
+    // result(r, :) = sum over active rows k of dense(r, k) * this(k, :)
+    forEachRowBand(m, values.size() * m, [&](size_t r0, size_t r1) {
+        for (size_t r = r0; r < r1; ++r) {
+            const T* in = dense.getPointer() + r * dense.getRowStride();
+            T* row = out.getPointer() + r * out.getRowStride();
+            for (size_t k : activeRows) {
+                const T scale = in[k * dense.getColStride()];
+                if (scale == T(0)) {
+                    continue;
+                }
+                for (size_t p = rowOffsets[k]; p < rowOffsets[k + 1]; ++p) {
+                    row[colIndices[p]] += scale * values[p];
+                }
+            }
+        }
+    });
+    return result;
+}
+
+template <typename T>
+void BasicSparseMatrix<T>::accumulateProductTransposed(T alpha, ConstView dense, View target) const {
+    if (dense.getCols() != cols || target.getRows() != dense.getRows() || target.getCols() != rows) {
+        throw std::invalid_argument("Matrix dimensions do not match for multiplication.");
+    }
+    const size_t m = dense.getRows();
+    // target(r, k) += alpha * dot(dense(r, :), this(k, :)) for active rows k only
+    forEachRowBand(m, values.size() * m, [&](size_t r0, size_t r1) {
+        for (size_t r = r0; r < r1; ++r) {
+            const T* in = dense.getPointer() + r * dense.getRowStride();
+            T* out = target.getPointer() + r * target.getRowStride();
+            for (size_t k : activeRows) {
+                T sum = T(0);
+                for (size_t p = rowOffsets[k]; p < rowOffsets[k + 1]; ++p) {
+                    sum += in[colIndices[p] * dense.getColStride()] * values[p];
+                }
+                out[k * target.getColStride()] += alpha * sum;
+            }
+        }
+    });
+}
+
+template class BasicSparseMatrix<double>;
+template class BasicSparseMatrix<float>;
@@ -0,0 +1,175 @@
+#include "../../include/matrix/Gemm.h"
+#include "../../include/matrix/ElementWise.h"
+#include "../../include/matrix/Workspace.h"
+#include <algorithm>
+#include <atomic>
+#include <memory_resource>
+#include <stdexcept>
+#include <vector>
+
+namespace kernels {
+
+namespace {
+
+std::atomic<size_t> strassenCutoff{512};
+
+// out = x + y, or x - y. The output always has unit column stride; it may be one of the operands.
+template <typename T>
+void combine(BasicMatrixView<const T> x, BasicMatrixView<const T> y, bool difference, BasicMatrixView<T> out) {
+    const size_t cols = out.getCols();
+    const bool contiguous = x.hasContiguousRows() && y.hasContiguousRows();
+    for (size_t i = 0; i < out.getRows(); ++i) {
+        T* o = out.getPointer() + i * out.getRowStride();
+        if (contiguous) {
+            const T* a = x.getPointer() + i * x.getRowStride();
+            const T* b = y.getPointer() + i * y.getRowStride();
+            difference ? subtract(cols, a, b, o) : add(cols, a, b, o);
+            continue;
+        }
+        for (size_t j = 0; j < cols; ++j) {
+            o[j] = difference ? x[i, j] - y[i, j] : x[i, j] + y[i, j];
+        }
+    }
+}
+
+// Elements of scratch the recursion below needs for an M x K by K x N product. Every level multiplies halves, so
+// each level has a single slice that its seven sub-products reuse one after the other.
+size_t strassenScratch(size_t M, size_t N, size_t K, size_t cutoff) {
+    if (std::min({M, N, K}) <= cutoff) {
+        return 0;
+    }
+    const size_t m = M / 2;
+    const size_t n = N / 2;
+    const size_t k = K / 2;
+    return m * std::max(k, n) + k * n + strassenScratch(m, n, k, cutoff);
+}
+
+// C = alpha * A * B, overwriting C (which has unit column stride). The even-sized part is computed with the
+// Strassen-Winograd recursion; an odd last row, column or inner index is peeled off and finished with thin
+// blocked products. scratch holds strassenScratch(M, N, K, cutoff) elements.
+template <typename T>
+void strassen(T alpha, BasicMatrixView<const T> A, BasicMatrixView<const T> B, BasicMatrixView<T> C, size_t cutoff,
+              T* scratch) {
+    const size_t M = C.getRows();
+    const size_t N = C.getCols();
+    const size_t K = A.getCols();
+    if (std::min({M, N, K}) <= cutoff) {
+        gemm(alpha, A, B, T(0), C);
+        return;
+    }
+
+    const size_t m = M / 2;
+    const size_t n = N / 2;
+    const size_t k = K / 2;
+    const BasicMatrixView<const T> A11 = A.block(0, 0, m, k), A12 = A.block(0, k, m, k);
+    const BasicMatrixView<const T> A21 = A.block(m, 0, m, k), A22 = A.block(m, k, m, k);
+    const BasicMatrixView<const T> B11 = B.block(0, 0, k, n), B12 = B.block(0, n, k, n);
+    const BasicMatrixView<const T> B21 = B.block(k, 0, k, n), B22 = B.block(k, n, k, n);
+    const BasicMatrixView<T> C11 = C.block(0, 0, m, n), C12 = C.block(0, n, m, n);
+    const BasicMatrixView<T> C21 = C.block(m, 0, m, n), C22 = C.block(m, n, m, n);
+
+    // Two scratch blocks suffice when the quadrants of C hold the other intermediate products
+    // (Boyer, Dumas, Pernet and Zhou, "Memory efficient scheduling of Strassen-Winograd's matrix multiplication
+    // algorithm", 2009). X holds the sums of A blocks and then P1, Y the sums of B blocks.
+    T* xBuffer = scratch;
+    T* yBuffer = xBuffer + m * std::max(k, n);
+    T* next = yBuffer + k * n;
+    const BasicMatrixView<T> X(xBuffer, m, k, k);
+    const BasicMatrixView<T> P1(xBuffer, m, n, n);
+    const BasicMatrixView<T> Y(yBuffer, k, n, n);
+
+    combine<T>(A11, A21, true, X);                   // S3 = A11 - A21
+    combine<T>(B22, B12, true, Y);                   // T3 = B22 - B12
+    strassen<T>(alpha, X, Y, C21, cutoff, next);     // P7 = S3 T3
+    combine<T>(A21, A22, false, X);                  // S1 = A21 + A22
+    combine<T>(B12, B11, true, Y);                   // T1 = B12 - B11
+    strassen<T>(alpha, X, Y, C22, cutoff, next);     // P5 = S1 T1
+    combine<T>(X, A11, true, X);                     // S2 = S1 - A11
+    combine<T>(B22, Y, true, Y);                     // T2 = B22 - T1
+    strassen<T>(alpha, X, Y, C12, cutoff, next);     // P6 = S2 T2
+    combine<T>(A12, X, true, X);                     // S4 = A12 - S2
+    strassen<T>(alpha, X, B22, C11, cutoff, next);   // P3 = S4 B22
+    strassen<T>(alpha, A11, B11, P1, cutoff, next);
+    combine<T>(P1, C12, false, C12);                 // U2 = P1 + P6
+    combine<T>(C12, C21, false, C21);                // U3 = U2 + P7
+    combine<T>(C12, C22, false, C12);                // U4 = U2 + P5
+    combine<T>(C21, C22, false, C22);                // C22 = U3 + P5
+    combine<T>(C12, C11, false, C12);                // C12 = U4 + P3
+    combine<T>(Y, B21, true, Y);                     // T4 = T2 - B21
+    strassen<T>(alpha, A22, Y, C11, cutoff, next);   // P4 = A22 T4
+    combine<T>(C21, C11, true, C21);                 // C21 = U3 - P4
+    strassen<T>(alpha, A12, B21, C11, cutoff, next); // P2
+    combine<T>(P1, C11, false, C11);                 // C11 = P1 + P2
+
+    if (K % 2 != 0) {
+        gemm(alpha, A.block(0, K - 1, 2 * m, 1), B.block(K - 1, 0, 1, 2 * n), T(1), C.block(0, 0, 2 * m, 2 * n));
+    }
+    if (N % 2 != 0) {
+        gemm(alpha, A, B.block(0, N - 1, K, 1), T(0), C.block(0, N - 1, M, 1));
+    }
+    if (M % 2 != 0) {
+        gemm(alpha, A.block(M - 1, 0, 1, K), B.block(0, 0, K, 2 * n), T(0), C.block(M - 1, 0, 1, 2 * n));
+    }
+}
+
+template <typename T>
+void gemmAlgorithm(GemmAlgorithm algorithm, T alpha, BasicMatrixView<const T> A, BasicMatrixView<const T> B,
+                   T beta, BasicMatrixView<T> C) {
+    if (A.getCols() != B.getRows() || C.getRows() != A.getRows() || C.getCols() != B.getCols()) {
+        throw std::invalid_argument("Matrix dimensions do not match for multiplication.");
+    }
+    const size_t M = C.getRows();
+    const size_t N = C.getCols();
+    const size_t K = A.getCols();
+    const size_t cutoff = getStrassenCutoff();
+    const bool useStrassen = algorithm == GemmAlgorithm::Strassen ||
+                             (algorithm == GemmAlgorithm::Auto && strassenPays(M, N, K));
+    if (!useStrassen || std::min({M, N, K}) <= cutoff) {
+        gemm(alpha, A, B, beta, C);
+        return;
+    }
+
+    // All scratch comes from one allocation, taken from the active workspace if there is one
+    const bool direct = beta == T(0) && C.hasContiguousRows();
+    const size_t productSize = direct ? 0 : M * N;
+    std::pmr::vector<T> scratch(productSize + strassenScratch(M, N, K, cutoff), Workspace::current());
+    if (direct) {
+        strassen<T>(alpha, A, B, C, cutoff, scratch.data());
+        return;
+    }
+
+    // The recursion overwrites its destination, so the product goes through a scratch block and is then added
+    const T* product = scratch.data();
+    strassen<T>(alpha, A, B, BasicMatrixView<T>(scratch.data(), M, N, N), cutoff, scratch.data() + productSize);
+    for (size_t i = 0; i < M; ++i) {
+        for (size_t j = 0; j < N; ++j) {
+            C[i, j] = (beta == T(0)) ? product[i * N + j] : product[i * N + j] + beta * C[i, j];
+        }
+    }
+}
+
+} // namespace
+
+bool strassenPays(size_t M, size_t N, size_t K) {
+    const size_t smallest = std::min({M, N, K});
+    const size_t largest = std::max({M, N, K});
+    return smallest >= 2 * getStrassenCutoff() && largest <= 4 * smallest;
+}
+
+void setStrassenCutoff(size_t size) {
+    strassenCutoff.store(std::max<size_t>(size, 16), std::memory_order_relaxed);
+}
+
+size_t getStrassenCutoff() {
+    return strassenCutoff.load(std::memory_order_relaxed);
+}
+
+void gemm(GemmAlgorithm algorithm, double alpha, ConstMatrixView A, ConstMatrixView B, double beta, MatrixView C) {
+    gemmAlgorithm(algorithm, alpha, A, B, beta, C);
+}
+
+void gemm(GemmAlgorithm algorithm, float alpha, ConstMatrixViewF A, ConstMatrixViewF B, float beta, MatrixViewF C) {
+    gemmAlgorithm(algorithm, alpha, A, B, beta, C);
+}
+
+} // namespace kernels
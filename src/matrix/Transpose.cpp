@@ -0,0 +1,139 @@
+#include "../../include/matrix/Transpose.h"
+#include "../../include/parallel/ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <utility>
+
+namespace kernels {
+
+namespace {
+
+// Tile edge (in elements): a source and a destination tile of doubles take 2 x 8 KB, well inside L1
+constexpr size_t TILE = 32;
+
+// Matrices with fewer elements than this stay on the calling thread
+std::atomic<size_t> parallelThreshold{512 * 512};
+
+// Transposes one tile of at most TILE x TILE elements
+template <typename T>
+void transposeTile(size_t rows, size_t cols, const T* in, size_t ldi, T* out, size_t ldo) {
+    for (size_t i = 0; i < rows; ++i) {
+        const T* src = in + i * ldi;
+        for (size_t j = 0; j < cols; ++j) {
+            out[j * ldo + i] = src[j];
+        }
+    }
+}
+
+// Tile rows [blockBegin, blockEnd) of the source (each TILE rows high)
+template <typename T>
+void transposeBlockRows(size_t blockBegin, size_t blockEnd, size_t rows, size_t cols,
+                        const T* in, size_t ldi, T* out, size_t ldo) {
+    for (size_t bi = blockBegin; bi < blockEnd; ++bi) {
+        const size_t i0 = bi * TILE;
+        const size_t m = std::min(TILE, rows - i0);
+        for (size_t j0 = 0; j0 < cols; j0 += TILE) {
+            const size_t n = std::min(TILE, cols - j0);
+            transposeTile(m, n, in + i0 * ldi + j0, ldi, out + j0 * ldo + i0, ldo);
+        }
+    }
+}
+
+template <typename T>
+void transposeImpl(size_t rows, size_t cols, const T* in, size_t ldi, T* out, size_t ldo) {
+    if (rows == 0 || cols == 0) {
+        return;
+    }
+    const size_t blocks = (rows + TILE - 1) / TILE;
+    ThreadPool& pool = ThreadPool::global();
+    if (rows * cols < getTransposeParallelThreshold() || pool.getThreadCount() == 1 || blocks == 1) {
+        transposeBlockRows(0, blocks, rows, cols, in, ldi, out, ldo);
+        return;
+    }
+    // Each chunk reads a band of source rows and writes the matching band of destination columns
+    pool.parallelFor(0, blocks, [&](size_t b0, size_t b1) {
+        transposeBlockRows(b0, b1, rows, cols, in, ldi, out, ldo);
+    });
+}
+
+// Swaps the tile at (i0, j0) with the transpose of the tile at (j0, i0); on the diagonal, transposes it in place
+template <typename T>
+void swapTiles(size_t n, T* a, size_t lda, size_t i0, size_t j0) {
+    const size_t m = std::min(TILE, n - i0);
+    const size_t k = std::min(TILE, n - j0);
+    if (i0 == j0) {
+        for (size_t i = 0; i < m; ++i) {
+            for (size_t j = i + 1; j < m; ++j) {
+                std::swap(a[(i0 + i) * lda + j0 + j], a[(j0 + j) * lda + i0 + i]);
+            }
+        }
+        return;
+    }
+    for (size_t i = 0; i < m; ++i) {
+        for (size_t j = 0; j < k; ++j) {
+            std::swap(a[(i0 + i) * lda + j0 + j], a[(j0 + j) * lda + i0 + i]);
+        }
+    }
+}
+
+// Tile rows [blockBegin, blockEnd) of the upper triangle, each swapped with the matching lower tiles
+template <typename T>
+void transposeInPlaceBlockRows(size_t blockBegin, size_t blockEnd, size_t n, T* a, size_t lda) {
+    for (size_t bi = blockBegin; bi < blockEnd; ++bi) {
+        for (size_t j0 = bi * TILE; j0 < n; j0 += TILE) {
+            swapTiles(n, a, lda, bi * TILE, j0);
+        }
+    }
+}
+
+template <typename T>
+void transposeInPlaceImpl(size_t n, T* a, size_t lda) {
+    if (n < 2) {
+        return;
+    }
+    const size_t blocks = (n + TILE - 1) / TILE;
+    ThreadPool& pool = ThreadPool::global();
+    if (n * n < getTransposeParallelThreshold() || pool.getThreadCount() == 1 || blocks == 1) {
+        transposeInPlaceBlockRows(0, blocks, n, a, lda);
+        return;
+    }
+    // Every tile pair belongs to exactly one block row of the upper triangle, so chunks never touch the same
+    // element. Block rows shrink towards the bottom, so row k is paired with row blocks - 1 - k to give every
+    // index the same amount of work.
+    pool.parallelFor(0, (blocks + 1) / 2, [&](size_t k0, size_t k1) {
+        for (size_t k = k0; k < k1; ++k) {
+            transposeInPlaceBlockRows(k, k + 1, n, a, lda);
+            if (blocks - 1 - k != k) {
+                transposeInPlaceBlockRows(blocks - 1 - k, blocks - k, n, a, lda);
+            }
+        }
+    });
+}
+
+} // namespace
+
+void transpose(size_t rows, size_t cols, const double* in, size_t ldi, double* out, size_t ldo) {
+    transposeImpl(rows, cols, in, ldi, out, ldo);
+}
+
+void transpose(size_t rows, size_t cols, const float* in, size_t ldi, float* out, size_t ldo) {
+    transposeImpl(rows, cols, in, ldi, out, ldo);
+}
+
+void transposeInPlace(size_t n, double* a, size_t lda) {
+    transposeInPlaceImpl(n, a, lda);
+}
+
+void transposeInPlace(size_t n, float* a, size_t lda) {
+    transposeInPlaceImpl(n, a, lda);
+}
+
+void setTransposeParallelThreshold(size_t elements) {
+    parallelThreshold.store(elements, std::memory_order_relaxed);
+}
+
+size_t getTransposeParallelThreshold() {
+    return parallelThreshold.load(std::memory_order_relaxed);
+}
+
+} // namespace kernels
@@ -0,0 +1,94 @@
+#include "../../include/matrix/Workspace.h"
+#include <algorithm>
+#include <cstdint>
+
+namespace {
+
+// Workspace that matrices constructed on this thread allocate from, or nullptr for the heap
+thread_local Workspace* activeWorkspace = nullptr;
+
+// Smallest block requested from the heap, so that tiny first allocations do not cause a chain of small blocks
+constexpr size_t MIN_BLOCK_SIZE = 64 * 1024;
+
+} // namespace
+
+// Constructor
+Workspace::Workspace(size_t initialCapacity) {
+    if (initialCapacity > 0) {
+        blocks.push_back({std::make_unique_for_overwrite<std::byte[]>(initialCapacity), initialCapacity});
+    }
+}
+
+// Allocation
+void* Workspace::do_allocate(size_t bytes, size_t alignment) {
+    while (true) {
+        if (currentBlock < blocks.size()) {
+            Block& block = blocks[currentBlock];
+            const auto base = reinterpret_cast<std::uintptr_t>(block.memory.get());
+            const std::uintptr_t aligned = (base + offset + alignment - 1) & ~(std::uintptr_t(alignment) - 1);
+            const size_t end = (aligned - base) + bytes;
+            if (end <= block.size) {
+                used += end - offset;
+                offset = end;
+                highWaterMark = std::max(highWaterMark, used);
+                return reinterpret_cast<void*>(aligned);
+            }
+            // The rest of this block is too small; move on to the next one
+            ++currentBlock;
+            offset = 0;
+            continue;
+        }
+        const size_t previous = blocks.empty() ? 0 : blocks.back().size;
+        const size_t size = std::max({bytes + alignment, 2 * previous, MIN_BLOCK_SIZE});
+        blocks.push_back({std::make_unique_for_overwrite<std::byte[]>(size), size});
+    }
+}
+
+void Workspace::do_deallocate(void*, size_t, size_t) {
+    // Memory is reclaimed all at once by reset()
+}
+
+bool Workspace::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+// State Management
+Workspace& Workspace::reset() {
+    if (currentBlock > 0) {
+        // The last step spilled into extra blocks: merge them so the next one fits in a single block
+        const size_t total = getCapacity();
+        blocks.clear();
+        blocks.push_back({std::make_unique_for_overwrite<std::byte[]>(total), total});
+    }
+    currentBlock = 0;
+    offset = 0;
+    used = 0;
+    return *this;
+}
+
+// Getters
+size_t Workspace::getCapacity() const {
+    size_t total = 0;
+    for (const Block& block : blocks) {
+        total += block.size;
+    }
+    return total;
+}
+
+std::pmr::memory_resource* Workspace::current() {
+    return activeWorkspace ? activeWorkspace : std::pmr::new_delete_resource();
+}
+
+// Scope
+WorkspaceScope::WorkspaceScope(Workspace& workspace)
+    : workspace(workspace), previous(activeWorkspace) {
+    ++workspace.depth;
+    activeWorkspace = &workspace;
+}
+
+WorkspaceScope::~WorkspaceScope() {
+    activeWorkspace = previous;
+    if (--workspace.depth == 0) {
+        workspace.reset();
+    }
+}
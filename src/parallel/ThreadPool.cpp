@@ -0,0 +1,157 @@
+#include "../../include/parallel/ThreadPool.h"
+#include <algorithm>
+
+namespace {
+
+// Set while a thread is executing a chunk, so nested parallel loops run inline instead of deadlocking
+thread_local bool insideParallelLoop = false;
+
+struct ParallelLoopGuard {
+    bool previous;
+    ParallelLoopGuard() : previous(insideParallelLoop) { insideParallelLoop = true; }
+    ~ParallelLoopGuard() { insideParallelLoop = previous; }
+};
+
+} // namespace
+
+// Constructor and Destructor
+ThreadPool::ThreadPool(size_t threadCount) {
+    startWorkers(std::max<size_t>(threadCount, 1) - 1);
+}
+
+ThreadPool::~ThreadPool() {
+    stopWorkers();
+}
+
+// Setters
+ThreadPool& ThreadPool::setThreadCount(size_t threadCount) {
+    std::lock_guard<std::mutex> dispatchLock(dispatchMutex);
+    stopWorkers();
+    startWorkers(std::max<size_t>(threadCount, 1) - 1);
+    return *this;
+}
+
+// Worker Management
+void ThreadPool::startWorkers(size_t count) {
+    size_t startGeneration;
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        stopping = false;
+        startGeneration = generation;
+    }
+    workers.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        workers.emplace_back(&ThreadPool::workerLoop, this, i, startGeneration);
+    }
+    threadCount.store(count + 1, std::memory_order_relaxed);
+}
+
+void ThreadPool::stopWorkers() {
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        stopping = true;
+    }
+    workAvailable.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    workers.clear();
+    threadCount.store(1, std::memory_order_relaxed);
+}
+
+void ThreadPool::workerLoop(size_t index, size_t startGeneration) {
+    insideParallelLoop = true;
+    size_t seenGeneration = startGeneration;
+    // The caller processes chunk 0, worker i processes chunk i + 1
+    const size_t chunk = index + 1;
+
+    std::unique_lock<std::mutex> lock(stateMutex);
+    while (true) {
+        workAvailable.wait(lock, [&] { return stopping || generation != seenGeneration; });
+        if (stopping) {
+            return;
+        }
+        seenGeneration = generation;
+        if (chunk >= taskChunks) {
+            continue;
+        }
+
+        lock.unlock();
+        runChunk(chunk);
+        lock.lock();
+
+        if (--pending == 0) {
+            workDone.notify_one();
+        }
+    }
+}
+
+void ThreadPool::runChunk(size_t chunk) {
+    const size_t length = taskEnd - taskBegin;
+    const size_t chunkBegin = taskBegin + length * chunk / taskChunks;
+    const size_t chunkEnd = taskBegin + length * (chunk + 1) / taskChunks;
+    try {
+        (*task)(chunkBegin, chunkEnd);
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        if (!firstError) {
+            firstError = std::current_exception();
+        }
+    }
+}
+
+// Parallel Execution
+void ThreadPool::parallelFor(size_t begin, size_t end, const std::function<void(size_t, size_t)>& body, size_t minChunk) {
+    if (begin >= end) {
+        return;
+    }
+    // Run inline when nested, when another thread owns the workers, or when there is nothing to split
+    std::unique_lock<std::mutex> dispatchLock(dispatchMutex, std::defer_lock);
+    const bool ownsWorkers = !insideParallelLoop && dispatchLock.try_lock();
+    const size_t length = end - begin;
+    minChunk = std::max<size_t>(minChunk, 1);
+    const size_t chunks = ownsWorkers ? std::min(workers.size() + 1, (length + minChunk - 1) / minChunk) : 1;
+    if (chunks <= 1) {
+        ParallelLoopGuard guard;
+        body(begin, end);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        task = &body;
+        taskBegin = begin;
+        taskEnd = end;
+        taskChunks = chunks;
+        pending = chunks - 1;
+        firstError = nullptr;
+        ++generation;
+    }
+    workAvailable.notify_all();
+
+    {
+        ParallelLoopGuard guard;
+        runChunk(0);
+    }
+
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(stateMutex);
+        workDone.wait(lock, [&] { return pending == 0; });
+        task = nullptr;
+        error = firstError;
+        firstError = nullptr;
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+ThreadPool& ThreadPool::global() {
+    static ThreadPool pool;
+    return pool;
+}
+
+size_t ThreadPool::defaultThreadCount() {
+    return std::max<unsigned>(std::thread::hardware_concurrency(), 1);
+}
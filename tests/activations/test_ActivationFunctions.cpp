@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 #include "../../include/activations/ActivationFunctions.h"
+#include <memory>
+#include <vector>
 
 // Test Sigmoid Activation Function
 TEST(ActivationFunctionTest, SigmoidFunction) {
@@ -9,10 +11,10 @@ TEST(ActivationFunctionTest, SigmoidFunction) {
 
     Matrix output = sigmoid.apply(input);
 
-    EXPECT_NEAR(output.getData()[0][0], 0.5, 1e-5);
-    EXPECT_NEAR(output.getData()[0][1], 0.731058, 1e-5);
-    EXPECT_NEAR(output.getData()[1][0], 0.268941, 1e-5);
-    EXPECT_NEAR(output.getData()[1][1], 0.880797, 1e-5);
+    EXPECT_NEAR(output(0, 0), 0.5, 1e-5);
+    EXPECT_NEAR(output(0, 1), 0.731058, 1e-5);
+    EXPECT_NEAR(output(1, 0), 0.268941, 1e-5);
+    EXPECT_NEAR(output(1, 1), 0.880797, 1e-5);
 }
 
 // Test Sigmoid Derivative
@@ -23,10 +25,10 @@ TEST(ActivationFunctionTest, SigmoidDerivative) {
 
     Matrix output = sigmoid.applyDerivative(input);
 
-    EXPECT_NEAR(output.getData()[0][0], 0.25, 1e-5);
-    EXPECT_NEAR(output.getData()[0][1], 0.196612, 1e-5);
-    EXPECT_NEAR(output.getData()[1][0], 0.196612, 1e-5);
-    EXPECT_NEAR(output.getData()[1][1], 0.104994, 1e-5);
+    EXPECT_NEAR(output(0, 0), 0.25, 1e-5);
+    EXPECT_NEAR(output(0, 1), 0.196612, 1e-5);
+    EXPECT_NEAR(output(1, 0), 0.196612, 1e-5);
+    EXPECT_NEAR(output(1, 1), 0.104994, 1e-5);
 }
 
 // Test Swish Activation Function
@@ -37,10 +39,10 @@ TEST(ActivationFunctionTest, SwishFunction) {
 
     Matrix output = swish.apply(input);
 
-    EXPECT_NEAR(output.getData()[0][0], 0.0, 1e-5);
-    EXPECT_NEAR(output.getData()[0][1], 0.731058, 1e-5);
-    EXPECT_NEAR(output.getData()[1][0], -0.268941, 1e-5);
-    EXPECT_NEAR(output.getData()[1][1], 1.761594, 1e-5);
+    EXPECT_NEAR(output(0, 0), 0.0, 1e-5);
+    EXPECT_NEAR(output(0, 1), 0.731058, 1e-5);
+    EXPECT_NEAR(output(1, 0), -0.268941, 1e-5);
+    EXPECT_NEAR(output(1, 1), 1.761594, 1e-5);
 }
 
 // Test Swish Derivative
@@ -51,10 +53,10 @@ TEST(ActivationFunctionTest, SwishDerivative) {
 
     Matrix output = swish.applyDerivative(input);
 
-    EXPECT_NEAR(output.getData()[0][0], 0.5, 1e-5);
-    EXPECT_NEAR(output.getData()[0][1], 0.927671, 1e-5);
-    EXPECT_NEAR(output.getData()[1][0], 0.072329, 1e-5);
-    EXPECT_NEAR(output.getData()[1][1], 1.090784, 1e-5);
+    EXPECT_NEAR(output(0, 0), 0.5, 1e-5);
+    EXPECT_NEAR(output(0, 1), 0.927671, 1e-5);
+    EXPECT_NEAR(output(1, 0), 0.072329, 1e-5);
+    EXPECT_NEAR(output(1, 1), 1.090784, 1e-5);
 }
 
 // Test ReLU Activation Function
@@ -65,10 +67,10 @@ TEST(ActivationFunctionTest, ReLUFunction) {
 
     Matrix output = relu.apply(input);
 
-    EXPECT_NEAR(output.getData()[0][0], 0.0, 1e-5);
-    EXPECT_NEAR(output.getData()[0][1], 0.0, 1e-5);
-    EXPECT_NEAR(output.getData()[1][0], 2.0, 1e-5);
-    EXPECT_NEAR(output.getData()[1][1], 0.0, 1e-5);
+    EXPECT_NEAR(output(0, 0), 0.0, 1e-5);
+    EXPECT_NEAR(output(0, 1), 0.0, 1e-5);
+    EXPECT_NEAR(output(1, 0), 2.0, 1e-5);
+    EXPECT_NEAR(output(1, 1), 0.0, 1e-5);
 }
 
 // Test ReLU Derivative
@@ -79,10 +81,10 @@ TEST(ActivationFunctionTest, ReLUDerivative) {
 
     Matrix output = relu.applyDerivative(input);
 
-    EXPECT_NEAR(output.getData()[0][0], 0.0, 1e-5);
-    EXPECT_NEAR(output.getData()[0][1], 0.0, 1e-5);
-    EXPECT_NEAR(output.getData()[1][0], 1.0, 1e-5);
-    EXPECT_NEAR(output.getData()[1][1], 0.0, 1e-5);
+    EXPECT_NEAR(output(0, 0), 0.0, 1e-5);
+    EXPECT_NEAR(output(0, 1), 0.0, 1e-5);
+    EXPECT_NEAR(output(1, 0), 1.0, 1e-5);
+    EXPECT_NEAR(output(1, 1), 0.0, 1e-5);
 }
 
 // Test Leaky ReLU Activation Function
@@ -93,10 +95,10 @@ TEST(ActivationFunctionTest, LeakyReLUFunction) {
 
     Matrix output = leakyReLU.apply(input);
 
-    EXPECT_NEAR(output.getData()[0][0], 0.0, 1e-5);
-    EXPECT_NEAR(output.getData()[0][1], -0.01, 1e-5);
-    EXPECT_NEAR(output.getData()[1][0], 2.0, 1e-5);
-    EXPECT_NEAR(output.getData()[1][1], -0.03, 1e-5);
+    EXPECT_NEAR(output(0, 0), 0.0, 1e-5);
+    EXPECT_NEAR(output(0, 1), -0.01, 1e-5);
+    EXPECT_NEAR(output(1, 0), 2.0, 1e-5);
+    EXPECT_NEAR(output(1, 1), -0.03, 1e-5);
 }
 
 // Test Leaky ReLU Derivative
@@ -107,10 +109,10 @@ TEST(ActivationFunctionTest, LeakyReLUDerivative) {
 
     Matrix output = leakyReLU.applyDerivative(input);
 
-    EXPECT_NEAR(output.getData()[0][0], 1.0, 1e-5);
-    EXPECT_NEAR(output.getData()[0][1], 0.01, 1e-5);
-    EXPECT_NEAR(output.getData()[1][0], 1.0, 1e-5);
-    EXPECT_NEAR(output.getData()[1][1], 0.01, 1e-5);
+    EXPECT_NEAR(output(0, 0), 1.0, 1e-5);
+    EXPECT_NEAR(output(0, 1), 0.01, 1e-5);
+    EXPECT_NEAR(output(1, 0), 1.0, 1e-5);
+    EXPECT_NEAR(output(1, 1), 0.01, 1e-5);
 }
 
 // Test Tanh Activation Function
@@ -121,10 +123,10 @@ TEST(ActivationFunctionTest, TanhFunction) {
 
     Matrix output = tanhAct.apply(input);
 
-    EXPECT_NEAR(output.getData()[0][0], 0.0, 1e-5);
-    EXPECT_NEAR(output.getData()[0][1], 0.761594, 1e-5);
-    EXPECT_NEAR(output.getData()[1][0], -0.761594, 1e-5);
-    EXPECT_NEAR(output.getData()[1][1], 0.964027, 1e-5);
+    EXPECT_NEAR(output(0, 0), 0.0, 1e-5);
+    EXPECT_NEAR(output(0, 1), 0.761594, 1e-5);
+    EXPECT_NEAR(output(1, 0), -0.761594, 1e-5);
+    EXPECT_NEAR(output(1, 1), 0.964027, 1e-5);
 }
 
 // Test Tanh Derivative
@@ -135,10 +137,10 @@ TEST(ActivationFunctionTest, TanhDerivative) {
 
     Matrix output = tanhAct.applyDerivative(input);
 
-    EXPECT_NEAR(output.getData()[0][0], 1.0, 1e-5);
-    EXPECT_NEAR(output.getData()[0][1], 0.419974, 1e-5);
-    EXPECT_NEAR(output.getData()[1][0], 0.419974, 1e-5);
-    EXPECT_NEAR(output.getData()[1][1], 0.0706508, 1e-5);
+    EXPECT_NEAR(output(0, 0), 1.0, 1e-5);
+    EXPECT_NEAR(output(0, 1), 0.419974, 1e-5);
+    EXPECT_NEAR(output(1, 0), 0.419974, 1e-5);
+    EXPECT_NEAR(output(1, 1), 0.0706508, 1e-5);
 }
 
 // Test Hard Tanh Activation Function
@@ -149,10 +151,10 @@ TEST(ActivationFunctionTest, HardTanhFunction) {
 
     Matrix output = hardTanh.apply(input);
 
-    EXPECT_NEAR(output.getData()[0][0], -1.0, 1e-5);
-    EXPECT_NEAR(output.getData()[0][1], 0.5, 1e-5);
-    EXPECT_NEAR(output.getData()[1][0], 1.0, 1e-5);
-    EXPECT_NEAR(output.getData()[1][1], -0.8, 1e-5);
+    EXPECT_NEAR(output(0, 0), -1.0, 1e-5);
+    EXPECT_NEAR(output(0, 1), 0.5, 1e-5);
+    EXPECT_NEAR(output(1, 0), 1.0, 1e-5);
+    EXPECT_NEAR(output(1, 1), -0.8, 1e-5);
 }
 
 // Test Hard Tanh Derivative
@@ -163,8 +165,26 @@ TEST(ActivationFunctionTest, HardTanhDerivative) {
 
     Matrix output = hardTanh.applyDerivative(input);
 
-    EXPECT_NEAR(output.getData()[0][0], 0.0, 1e-5);
-    EXPECT_NEAR(output.getData()[0][1], 1.0, 1e-5);
-    EXPECT_NEAR(output.getData()[1][0], 0.0, 1e-5);
-    EXPECT_NEAR(output.getData()[1][1], 1.0, 1e-5);
+    EXPECT_NEAR(output(0, 0), 0.0, 1e-5);
+    EXPECT_NEAR(output(0, 1), 1.0, 1e-5);
+    EXPECT_NEAR(output(1, 0), 0.0, 1e-5);
+    EXPECT_NEAR(output(1, 1), 1.0, 1e-5);
+}
+
+TEST(ActivationFunctionTest, ApplyInPlaceMatchesApply) {
+    Matrix input(3, 4);
+    input.randomize(-2.0, 2.0);
+    const std::vector<std::shared_ptr<ActivationFunction>> activations = {
+        std::make_shared<SigmoidActivation>(), std::make_shared<SwishActivation>(),
+        std::make_shared<ReLUActivation>(), std::make_shared<LeakyReLUActivation>(),
+        std::make_shared<TanhActivation>(), std::make_shared<HardTanhActivation>()};
+
+    for (const auto& activation : activations) {
+        const Matrix expected = activation->apply(input);
+
+        // Transform through a transposed (strided) view
+        Matrix values = input;
+        activation->applyInPlace(values.view().transpose());
+        EXPECT_TRUE(values.isEqual(expected, 1e-12));
+    }
 }
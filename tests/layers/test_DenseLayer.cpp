@@ -56,5 +56,99 @@ TEST(DenseLayerTest, ForwardPropagationReLU) {
 
     EXPECT_EQ(output.getRows(), 2);
     EXPECT_EQ(output.getCols(), 1);
-    EXPECT_GE(output.getData()[0][0], 0.0);  // Ensure ReLU does not produce negative values
+    EXPECT_GE(output(0, 0), 0.0);  // Ensure ReLU does not produce negative values
+}
+
+// Test Sparse Input Matches Dense Input
+TEST(DenseLayerTest, SparseInputMatchesDense) {
+    auto tanh = std::make_shared<TanhActivation>();
+    DenseLayer sparseLayer(50, 4, tanh);
+    DenseLayer denseLayer = sparseLayer;
+
+    // One-hot style input: 2 of 50 features active
+    Matrix dense(50, 1);
+    dense(3, 0) = 1.0;
+    dense(41, 0) = 0.5;
+    const SparseMatrix sparse = SparseMatrix::fromDense(dense);
+
+    EXPECT_TRUE(sparseLayer.forward(sparse).isEqual(denseLayer.forward(dense), 1e-12));
+
+    Matrix gradient(4, 1);
+    gradient.setData({{0.1}, {-0.2}, {0.3}, {0.05}});
+    sparseLayer.backward(gradient, sparse);
+    denseLayer.backward(gradient);
+
+    // After identical updates both layers produce the same output
+    Matrix probe(50, 1);
+    probe.randomize(-1.0, 1.0);
+    EXPECT_TRUE(sparseLayer.forward(probe).isEqual(denseLayer.forward(probe), 1e-12));
+}
+
+TEST(DenseLayerTest, SeededConstructionIsReproducible) {
+    auto activation = std::make_shared<SigmoidActivation>();
+    Philox first(2024);
+    Philox second(2024);
+    DenseLayer a(5, 4, activation, first);
+    DenseLayer b(5, 4, activation, second);
+    Matrix input(5, 2, "Input");
+    input.setData(0.5);
+    EXPECT_TRUE(a.forward(input) == b.forward(input));
+
+    // The generator advances, so the next layer gets different weights
+    DenseLayer c(5, 4, activation, first);
+    EXPECT_FALSE(a.forward(input) == c.forward(input));
+}
+
+TEST(DenseLayerTest, QuantizedForwardApproximatesFloat) {
+    Philox rng(7);
+    DenseLayer layer(100, 8, std::make_shared<TanhActivation>(), rng);
+    Matrix input(100, 3);
+    input.randomize(rng, -1.0, 1.0);
+    const Matrix expected = layer.forward(input);
+
+    layer.enableQuantization();
+    EXPECT_TRUE(layer.isQuantized());
+    const Matrix quantized = layer.forward(input);
+    EXPECT_TRUE(quantized.isEqual(expected, 0.05));
+    EXPECT_FALSE(quantized == expected);
+    EXPECT_THROW(layer.backward(expected), std::runtime_error);
+
+    layer.disableQuantization();
+    EXPECT_TRUE(layer.forward(input) == expected);
+}
+
+TEST(DenseLayerTest, HalfPrecisionForwardApproximatesFloat) {
+    Philox rng(9);
+    DenseLayer layer(100, 8, std::make_shared<TanhActivation>(), rng);
+    Matrix input(100, 3);
+    input.randomize(rng, -1.0, 1.0);
+    const Matrix expected = layer.forward(input);
+
+    layer.enableHalfPrecision(HalfFormat::Float16);
+    EXPECT_TRUE(layer.isHalfPrecision());
+    EXPECT_THROW(layer.enableQuantization(), std::runtime_error);
+    EXPECT_TRUE(layer.forward(input).isEqual(expected, 0.01));
+    EXPECT_THROW(layer.backward(expected), std::runtime_error);
+
+    // bfloat16 keeps fewer significant bits
+    layer.disableHalfPrecision();
+    EXPECT_TRUE(layer.forward(input).isEqual(expected, 0.01));
+    layer.enableHalfPrecision();
+    EXPECT_TRUE(layer.forward(input).isEqual(expected, 0.05));
+}
+
+TEST(DenseLayerTest, ForwardIntoKeepsOutputBuffer) {
+    Philox rng(10);
+    DenseLayer layer(6, 4, std::make_shared<ReLUActivation>(), rng);
+    Matrix input(6, 2);
+    input.randomize(rng, -1.0, 1.0);
+
+    Matrix output(4, 2);
+    const double* buffer = output.getData().data();
+    for (int step = 0; step < 2; ++step) {
+        layer.forwardInto(input, output);
+        EXPECT_EQ(output, layer.forward(input));
+    }
+    EXPECT_EQ(output.getData().data(), buffer);
+    EXPECT_THROW(layer.forwardInto(input, Matrix(2, 4)), std::invalid_argument);
 }
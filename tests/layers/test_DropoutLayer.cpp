@@ -43,7 +43,8 @@ TEST(DropoutLayerTest, FullDropout) {
 // Test Dropout Effect (Ensure some elements are zero)
 TEST(DropoutLayerTest, SomeNeuronsAreDropped) {
     auto activation = std::make_shared<SigmoidActivation>();
-    DropoutLayer layer(5, 5, activation, 0.5); // 50% dropout probability
+    Philox rng(2); // Seeded: with five neurons, all of them survive one draw in 32
+    DropoutLayer layer(5, 5, activation, 0.5, rng); // 50% dropout probability
     Matrix input(5, 1);
     input.setData({{1.0}, {1.0}, {1.0}, {1.0}, {1.0}});
 
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include "../../include/layers/FixedGRULayer.h"
+#include "../../include/layers/GRULayer.h"
+
+// **1. Test Forward Pass Through the Layer Interface**
+TEST(FixedGRULayerTest, ForwardPass) {
+    FixedGRULayer<3, 2> gru;
+    Matrix input(1, 3);
+    input.setData({{1.0, 0.5, -0.5}});
+
+    Matrix output = gru.forward(input);
+
+    EXPECT_EQ(output.getRows(), 1);
+    EXPECT_EQ(output.getCols(), 2);
+    EXPECT_EQ(output, gru.getHiddenState().toMatrix());
+    EXPECT_THROW(gru.forward(Matrix(1, 4)), std::invalid_argument);
+}
+
+// **2. Test Fixed-size Step and Backward Pass**
+TEST(FixedGRULayerTest, StepAndBackward) {
+    FixedGRULayerF<4, 32> gru;
+    FixedGRULayerF<4, 32>::Input input;
+    input.setData(0.5f);
+
+    EXPECT_THROW(gru.stepBackward(FixedMatrixF<1, 32>::filled(0.1f)), std::runtime_error);
+
+    const auto& hidden = gru.step(input);
+    for (size_t j = 0; j < 32; ++j) {
+        EXPECT_GT(hidden(0, j), -1.0f);
+        EXPECT_LT(hidden(0, j), 1.0f);
+    }
+
+    const FixedMatrixF<1, 4> gradInput = gru.stepBackward(FixedMatrixF<1, 32>::filled(0.1f));
+    EXPECT_TRUE(std::isfinite(gradInput(0, 0)));
+}
+
+// **3. Test Reset State**
+TEST(FixedGRULayerTest, ResetState) {
+    FixedGRULayer<3, 8> gru;
+    gru.step(FixedMatrix<1, 3>::filled(1.0));
+    EXPECT_NE(gru.getHiddenState(), (FixedMatrix<1, 8>{}));
+
+    gru.resetStates();
+    EXPECT_EQ(gru.getHiddenState(), (FixedMatrix<1, 8>{}));
+}
+
+// **4. Test Equivalence with GRULayer**
+TEST(FixedGRULayerTest, MatchesGRULayer) {
+    Philox rng(21);
+    GRULayer gru(3, 4, rng);
+    FixedGRULayer<3, 4> fixed;
+    auto source = gru.getParameters();
+    auto target = fixed.getParameters();
+    for (size_t p = 0; p < source.size(); ++p) {
+        for (size_t i = 0; i < source[p].getRows(); ++i) {
+            for (size_t j = 0; j < source[p].getCols(); ++j) {
+                target[p](i, j) = source[p](i, j);
+            }
+        }
+    }
+
+    Matrix input(1, 3);
+    Matrix gradOutput(1, 4);
+    gradOutput.setData(0.1);
+    for (int step = 0; step < 4; ++step) {
+        input.randomize(rng, -1.0, 1.0);
+        const Matrix hidden = gru.forward(input);
+        EXPECT_TRUE(fixed.step(FixedMatrix<1, 3>(input)).toMatrix().isEqual(hidden, 1e-12)) << "step " << step;
+
+        const Matrix gradInput = gru.backward(gradOutput);
+        const FixedMatrix<1, 3> fixedGradInput = fixed.stepBackward(FixedMatrix<1, 4>(gradOutput));
+        EXPECT_TRUE(fixedGradInput.toMatrix().isEqual(gradInput, 1e-12)) << "step " << step;
+        for (size_t p = 0; p < source.size(); ++p) {
+            EXPECT_TRUE(Matrix(target[p]).isEqual(Matrix(source[p]), 1e-12)) << "step " << step << ", parameter " << p;
+        }
+    }
+}
+
+// **5. Test Seeded Construction**
+TEST(FixedGRULayerTest, SeededConstructionIsReproducible) {
+    Philox first(5), second(5), other(6);
+    FixedGRULayer<3, 8> a(first), b(second), c(other);
+    const auto parametersA = a.getParameters();
+    const auto parametersB = b.getParameters();
+    for (size_t p = 0; p < parametersA.size(); ++p) {
+        EXPECT_TRUE(Matrix(parametersA[p]) == Matrix(parametersB[p])) << "parameter " << p;
+    }
+    EXPECT_FALSE(Matrix(parametersA[0]) == Matrix(c.getParameters()[0]));
+}
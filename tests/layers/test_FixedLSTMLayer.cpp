@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+#include "../../include/layers/FixedLSTMLayer.h"
+#include "../../include/layers/LSTMLayer.h"
+
+// **1. Test Forward and Backward Through the Layer Interface**
+TEST(FixedLSTMLayerTest, ForwardAndBackward) {
+    FixedLSTMLayer<3, 16> lstm;
+    Matrix input(1, 3);
+    input.setData({{1.0, 0.5, -0.5}});
+
+    Matrix output = lstm.forward(input);
+    Matrix gradInput = lstm.backward(Matrix(1, 16));
+
+    EXPECT_EQ(output.getCols(), 16);
+    EXPECT_EQ(gradInput.getCols(), 3);
+    for (size_t j = 0; j < 16; ++j) {
+        EXPECT_GT(output(0, j), -1.0);
+        EXPECT_LT(output(0, j), 1.0);
+    }
+
+    lstm.resetStates();
+    EXPECT_EQ(lstm.getCellState(), (FixedMatrix<1, 16>{}));
+}
+
+// **2. Test Backward Before Step**
+TEST(FixedLSTMLayerTest, BackwardBeforeStep) {
+    FixedLSTMLayer<3, 4> lstm;
+    EXPECT_THROW(lstm.stepBackward(FixedMatrix<1, 4>::filled(0.1)), std::runtime_error);
+}
+
+// **3. Test Repeated Steps**
+TEST(FixedLSTMLayerTest, RepeatedSteps) {
+    FixedLSTMLayerF<4, 8> lstm;
+    const FixedMatrixF<1, 4> inputs[] = {FixedMatrixF<1, 4>::filled(0.5f), FixedMatrixF<1, 4>::filled(-0.25f),
+                                         FixedMatrixF<1, 4>::filled(1.0f)};
+    FixedMatrixF<1, 8> states[3];
+    for (size_t t = 0; t < 3; ++t) {
+        states[t] = lstm.step(inputs[t]);
+        for (size_t j = 0; j < 8; ++j) {
+            EXPECT_GT(states[t](0, j), -1.0f);
+            EXPECT_LT(states[t](0, j), 1.0f);
+        }
+    }
+    EXPECT_NE(states[1], states[2]);
+
+    // The state carries over between steps, so replaying the sequence after a reset reproduces it
+    lstm.resetStates();
+    for (size_t t = 0; t < 3; ++t) {
+        EXPECT_EQ(lstm.step(inputs[t]), states[t]) << "step " << t;
+    }
+}
+
+// **4. Test Equivalence with LSTMLayer**
+TEST(FixedLSTMLayerTest, MatchesLSTMLayer) {
+    Philox rng(22);
+    LSTMLayer lstm(3, 4, rng);
+    FixedLSTMLayer<3, 4> fixed;
+    auto source = lstm.getParameters();
+    auto target = fixed.getParameters();
+    for (size_t p = 0; p < source.size(); ++p) {
+        for (size_t i = 0; i < source[p].getRows(); ++i) {
+            for (size_t j = 0; j < source[p].getCols(); ++j) {
+                target[p](i, j) = source[p](i, j);
+            }
+        }
+    }
+
+    Matrix input(1, 3);
+    Matrix gradOutput(1, 4);
+    gradOutput.setData(0.1);
+    for (int step = 0; step < 4; ++step) {
+        input.randomize(rng, -1.0, 1.0);
+        const Matrix hidden = lstm.forward(input);
+        EXPECT_TRUE(fixed.step(FixedMatrix<1, 3>(input)).toMatrix().isEqual(hidden, 1e-12)) << "step " << step;
+        EXPECT_TRUE(fixed.getCellState().toMatrix().isEqual(lstm.getCellState(), 1e-12)) << "step " << step;
+
+        const Matrix gradInput = lstm.backward(gradOutput);
+        const FixedMatrix<1, 3> fixedGradInput = fixed.stepBackward(FixedMatrix<1, 4>(gradOutput));
+        EXPECT_TRUE(fixedGradInput.toMatrix().isEqual(gradInput, 1e-12)) << "step " << step;
+        for (size_t p = 0; p < source.size(); ++p) {
+            EXPECT_TRUE(Matrix(target[p]).isEqual(Matrix(source[p]), 1e-12)) << "step " << step << ", parameter " << p;
+        }
+    }
+}
+
+// **5. Test Seeded Construction**
+TEST(FixedLSTMLayerTest, SeededConstructionIsReproducible) {
+    Philox first(5), second(5), other(6);
+    FixedLSTMLayer<3, 8> a(first), b(second), c(other);
+    const auto parametersA = a.getParameters();
+    const auto parametersB = b.getParameters();
+    for (size_t p = 0; p < parametersA.size(); ++p) {
+        EXPECT_TRUE(Matrix(parametersA[p]) == Matrix(parametersB[p])) << "parameter " << p;
+    }
+    EXPECT_FALSE(Matrix(parametersA[0]) == Matrix(c.getParameters()[0]));
+}
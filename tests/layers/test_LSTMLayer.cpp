@@ -113,3 +113,22 @@ TEST(LSTMLayerTest, GetHiddenAndCellState) {
     EXPECT_EQ(cell.getCols(), 2);
     EXPECT_FALSE(cell.isEmpty());
 }
+
+// Test Single-Precision Layer
+TEST(LSTMLayerTest, FloatForwardAndBackward) {
+    LSTMLayerF lstm(3, 2);
+    MatrixF input(1, 3);
+    input.setData({{1.0f, 0.5f, -0.5f}});
+    MatrixF gradOutput(1, 2);
+    gradOutput.setData({{0.1f, -0.2f}});
+
+    MatrixF output = lstm.forward(input);
+    MatrixF gradInput = lstm.backward(gradOutput);
+
+    EXPECT_EQ(output.getCols(), 2);
+    EXPECT_EQ(gradInput.getCols(), 3);
+    for (size_t j = 0; j < output.getCols(); ++j) {
+        EXPECT_GT(output(0, j), -1.0f);
+        EXPECT_LT(output(0, j), 1.0f);
+    }
+}
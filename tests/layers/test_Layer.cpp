@@ -25,7 +25,7 @@ TEST(LayerTest, SetGetWeights) {
     Matrix weights(1, 1);
     weights.setData({{0.8}});
     layer.setWeights(weights);
-    EXPECT_EQ(layer.getWeights().getData()[0][0], 0.8);
+    EXPECT_EQ(layer.getWeights()(0, 0), 0.8);
 }
 
 // Test for setting and getting biases
@@ -34,5 +34,5 @@ TEST(LayerTest, SetGetBiases) {
     Matrix biases(1, 1);
     biases.setData({{0.5}});
     layer.setBiases(biases);
-    EXPECT_EQ(layer.getBiases().getData()[0][0], 0.5);
+    EXPECT_EQ(layer.getBiases()(0, 0), 0.5);
 }
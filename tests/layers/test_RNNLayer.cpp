@@ -44,9 +44,9 @@ TEST(RNNLayerTest, InputCacheUpdatedInForward) {
 
     EXPECT_EQ(cachedInput.getRows(), 1);
     EXPECT_EQ(cachedInput.getCols(), 3);
-    EXPECT_EQ(cachedInput.getData()[0][0], 1.0);
-    EXPECT_EQ(cachedInput.getData()[0][1], 0.5);
-    EXPECT_EQ(cachedInput.getData()[0][2], -0.5);
+    EXPECT_EQ(cachedInput(0, 0), 1.0);
+    EXPECT_EQ(cachedInput(0, 1), 0.5);
+    EXPECT_EQ(cachedInput(0, 2), -0.5);
 }
 
 // Test Hidden State Reset
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include "../../include/layers/GRULayer.h"
+#include "../../include/layers/LSTMLayer.h"
+#include <ostream>
+#include <string>
+#include <tuple>
+
+namespace {
+
+enum class Recurrent { LSTM, GRU };
+
+// A compressed weight storage mode and how far its outputs may drift from full precision over a few steps
+struct StorageMode {
+    std::string name;
+    bool quantized;
+    QuantizationGranularity granularity;
+    HalfFormat format;
+    double tolerance;
+};
+
+const StorageMode STORAGE_MODES[] = {
+    {"Int8PerRow", true, QuantizationGranularity::PerRow, HalfFormat::BFloat16, 0.1},
+    {"Int8PerTensor", true, QuantizationGranularity::PerTensor, HalfFormat::BFloat16, 0.1},
+    {"BFloat16", false, QuantizationGranularity::PerRow, HalfFormat::BFloat16, 0.03},
+    {"Float16", false, QuantizationGranularity::PerRow, HalfFormat::Float16, 0.01},
+};
+
+// Two identically seeded layers, one of them in the storage mode, must agree step by step within the tolerance
+template <typename Layer>
+void expectModeApproximatesFullPrecision(const StorageMode& mode) {
+    Philox first(11);
+    Philox second(11);
+    Layer reference(20, 6, first);
+    Layer layer(20, 6, second);
+    if (mode.quantized) {
+        layer.enableQuantization(mode.granularity);
+        EXPECT_THROW(layer.enableHalfPrecision(), std::runtime_error);
+    } else {
+        layer.enableHalfPrecision(mode.format);
+        EXPECT_THROW(layer.enableQuantization(), std::runtime_error);
+    }
+    EXPECT_EQ(layer.isQuantized(), mode.quantized);
+    EXPECT_EQ(layer.isHalfPrecision(), !mode.quantized);
+
+    Matrix input(1, 20);
+    input.randomize(first, -1.0, 1.0);
+    for (int step = 0; step < 3; ++step) {
+        EXPECT_TRUE(layer.forward(input).isEqual(reference.forward(input), mode.tolerance)) << "step " << step;
+    }
+    EXPECT_THROW(layer.backward(Matrix(1, 6)), std::runtime_error);
+
+    layer.disableQuantization();
+    layer.disableHalfPrecision();
+    EXPECT_FALSE(layer.isQuantized());
+    EXPECT_FALSE(layer.isHalfPrecision());
+}
+
+// Readable test parameters in gtest output
+void PrintTo(Recurrent recurrent, std::ostream* os) {
+    *os << (recurrent == Recurrent::LSTM ? "LSTM" : "GRU");
+}
+
+void PrintTo(const StorageMode& mode, std::ostream* os) {
+    *os << mode.name << " (tolerance " << mode.tolerance << ")";
+}
+
+class RecurrentInferenceModeTest : public ::testing::TestWithParam<std::tuple<Recurrent, StorageMode>> {};
+
+} // namespace
+
+TEST_P(RecurrentInferenceModeTest, ApproximatesFullPrecision) {
+    const auto& [recurrent, mode] = GetParam();
+    if (recurrent == Recurrent::LSTM) {
+        expectModeApproximatesFullPrecision<LSTMLayer>(mode);
+    } else {
+        expectModeApproximatesFullPrecision<GRULayer>(mode);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(LayersAndModes, RecurrentInferenceModeTest,
+                         ::testing::Combine(::testing::Values(Recurrent::LSTM, Recurrent::GRU),
+                                            ::testing::ValuesIn(STORAGE_MODES)),
+                         [](const ::testing::TestParamInfo<RecurrentInferenceModeTest::ParamType>& info) {
+                             const bool lstm = std::get<0>(info.param) == Recurrent::LSTM;
+                             return std::string(lstm ? "LSTM" : "GRU") + "_" + std::get<1>(info.param).name;
+                         });
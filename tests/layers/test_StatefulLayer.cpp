@@ -40,5 +40,5 @@ TEST(StatefulLayerTest, GetInputCache) {
     Matrix input(1, 1);
     input.setData({{1.0}});
     layer.forward(input);
-    EXPECT_EQ(layer.getInputCache().getData()[0][0], 1.0);
+    EXPECT_EQ(layer.getInputCache()(0, 0), 1.0);
 }
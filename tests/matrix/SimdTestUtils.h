@@ -0,0 +1,24 @@
+#ifndef SIMD_TEST_UTILS_H
+#define SIMD_TEST_UTILS_H
+
+#include <gtest/gtest.h>
+#include "../../include/matrix/Simd.h"
+#include <string>
+
+/**
+ * @brief Run a test body once for every instruction set the CPU supports, restoring the active level afterwards.
+ *
+ * Failures are reported with the level they occurred at.
+ */
+template <typename Body>
+void forEachSimdLevel(Body body) {
+    const simd::Level original = simd::activeLevel();
+    for (int level = 0; level <= static_cast<int>(simd::detectedLevel()); ++level) {
+        simd::setActiveLevel(static_cast<simd::Level>(level));
+        SCOPED_TRACE("SIMD level " + std::to_string(level));
+        body();
+    }
+    simd::setActiveLevel(original);
+}
+
+#endif // SIMD_TEST_UTILS_H
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include "SimdTestUtils.h"
+#include "../../include/matrix/ElementWise.h"
+#include "../../include/matrix/Matrix.h"
+#include <vector>
+
+namespace {
+
+std::vector<double> sequence(size_t n, double start, double step) {
+    std::vector<double> values(n);
+    for (size_t i = 0; i < n; ++i) {
+        values[i] = start + step * static_cast<double>(i);
+    }
+    return values;
+}
+
+} // namespace
+
+TEST(ElementWiseTest, BinaryKernelsHandleAllLengths) {
+    forEachSimdLevel([] {
+        // Lengths cover empty input, partial vectors and several full vectors plus a tail
+        for (size_t n : {0, 1, 3, 7, 8, 13, 33}) {
+            std::vector<double> a = sequence(n, 1.0, 0.5);
+            std::vector<double> b = sequence(n, -2.0, 0.25);
+            std::vector<double> sum(n), diff(n), prod(n), scaled(n);
+
+            kernels::add(n, a.data(), b.data(), sum.data());
+            kernels::subtract(n, a.data(), b.data(), diff.data());
+            kernels::multiply(n, a.data(), b.data(), prod.data());
+            kernels::scale(n, a.data(), -3.0, scaled.data());
+
+            for (size_t i = 0; i < n; ++i) {
+                EXPECT_DOUBLE_EQ(sum[i], a[i] + b[i]);
+                EXPECT_DOUBLE_EQ(diff[i], a[i] - b[i]);
+                EXPECT_DOUBLE_EQ(prod[i], a[i] * b[i]);
+                EXPECT_DOUBLE_EQ(scaled[i], a[i] * -3.0);
+            }
+        }
+    });
+}
+
+TEST(ElementWiseTest, OutputMayAliasInput) {
+    std::vector<double> a = sequence(11, 1.0, 1.0);
+    std::vector<double> b = sequence(11, 2.0, 0.0);
+    kernels::multiply(a.size(), a.data(), b.data(), a.data());
+    for (size_t i = 0; i < a.size(); ++i) {
+        EXPECT_DOUBLE_EQ(a[i], 2.0 * static_cast<double>(i + 1));
+    }
+}
+
+TEST(ElementWiseTest, GateMathThroughMatrixOperators) {
+    Matrix f(1, 5), c(1, 5), i(1, 5), candidate(1, 5);
+    f.setData({{0.1, 0.2, 0.3, 0.4, 0.5}});
+    c.setData({{1.0, 2.0, 3.0, 4.0, 5.0}});
+    i.setData({{0.5, 0.5, 0.5, 0.5, 0.5}});
+    candidate.setData({{-1.0, 0.0, 1.0, 2.0, 3.0}});
+
+    Matrix cell = (f * c) + (i * candidate);
+
+    for (size_t j = 0; j < 5; ++j) {
+        EXPECT_DOUBLE_EQ(cell(0, j), f(0, j) * c(0, j) + i(0, j) * candidate(0, j));
+    }
+}
+
+TEST(ElementWiseTest, FloatKernelsHandleAllLengths) {
+    forEachSimdLevel([] {
+        // Float registers hold twice as many lanes, so the tails fall at different lengths
+        for (size_t n : {0, 1, 5, 15, 16, 17, 35}) {
+            std::vector<float> a(n), b(n);
+            for (size_t i = 0; i < n; ++i) {
+                a[i] = 1.0f + 0.5f * static_cast<float>(i);
+                b[i] = -2.0f + 0.25f * static_cast<float>(i);
+            }
+            std::vector<float> sum(n), prod(n), y = b;
+
+            kernels::add(n, a.data(), b.data(), sum.data());
+            kernels::multiply(n, a.data(), b.data(), prod.data());
+            kernels::axpy(n, 2.0f, a.data(), y.data());
+
+            for (size_t i = 0; i < n; ++i) {
+                EXPECT_FLOAT_EQ(sum[i], a[i] + b[i]);
+                EXPECT_FLOAT_EQ(prod[i], a[i] * b[i]);
+                EXPECT_FLOAT_EQ(y[i], b[i] + 2.0f * a[i]);
+            }
+        }
+    });
+}
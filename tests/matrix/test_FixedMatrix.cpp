@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+#include "../../include/matrix/FixedMatrix.h"
+
+TEST(FixedMatrixTest, DimensionsAreCompileTime) {
+    static_assert(FixedMatrix<3, 4>::getRows() == 3);
+    static_assert(FixedMatrix<3, 4>::getCols() == 4);
+    static_assert(FixedMatrix<3, 4>::size() == 12);
+
+    constexpr FixedMatrix<2, 2> filled = FixedMatrix<2, 2>::filled(1.5);
+    static_assert(filled(1, 1) == 1.5);
+
+    FixedMatrix<2, 3> zeros;
+    for (size_t i = 0; i < 2; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            EXPECT_EQ(zeros(i, j), 0.0);
+        }
+    }
+}
+
+TEST(FixedMatrixTest, MatchesDynamicMatrix) {
+    Matrix a(3, 5), b(5, 4), c(3, 5);
+    a.randomize(-1.0, 1.0);
+    b.randomize(-1.0, 1.0);
+    c.randomize(-1.0, 1.0);
+
+    const FixedMatrix<3, 5> fa(a), fc(c);
+    const FixedMatrix<5, 4> fb(b);
+
+    EXPECT_TRUE(fa.multiply(fb).toMatrix().isEqual(a.multiply(b, false), 1e-12));
+    EXPECT_TRUE((fa + fc).toMatrix().isEqual(a + c, 1e-12));
+    EXPECT_TRUE((fa * fc).toMatrix().isEqual(a * c, 1e-12));
+    EXPECT_TRUE((1.0 - fa).toMatrix().isEqual(1.0 - a, 1e-12));
+    EXPECT_TRUE(fa.transpose().toMatrix().isEqual(a.transpose(), 0.0));
+
+    // A FixedMatrix is usable wherever a Matrix view is accepted
+    EXPECT_TRUE(a.add(fc).isEqual(a + c, 1e-12));
+}
+
+TEST(FixedMatrixTest, LargeShapesUseLoops) {
+    // 16 x 16 exceeds the full-unroll limit; results must be the same
+    FixedMatrix<16, 16> a;
+    for (size_t i = 0; i < 16; ++i) {
+        a(i, i) = 2.0;
+    }
+    FixedMatrix<16, 16> b;
+    b.randomize();
+
+    EXPECT_EQ(a.multiply(b), b * 2.0);
+    EXPECT_EQ((b + b), 2.0 * b);
+}
+
+TEST(FixedMatrixTest, ShapeMismatchThrows) {
+    Matrix wrong(2, 3);
+    EXPECT_THROW((FixedMatrix<3, 2>(wrong)), std::invalid_argument);
+    EXPECT_NO_THROW((FixedMatrix<2, 3>(wrong)));
+}
+
+TEST(FixedMatrixTest, ElementAccessIsCheckedLikeMatrix) {
+    FixedMatrix<2, 3> m;
+    m[1, 2] = 4.0;
+    EXPECT_EQ(m(1, 2), 4.0);
+
+    // Only checked builds verify the indices of operator[]; operator() always does
+    EXPECT_THROW(m(2, 0), std::out_of_range);
+    EXPECT_THROW(m(0, 3), std::out_of_range);
+#ifdef MATRIX_CHECKED
+    EXPECT_THROW((m[2, 0]), std::out_of_range);
+#endif
+}
@@ -0,0 +1,246 @@
+#include <gtest/gtest.h>
+#include "SimdTestUtils.h"
+#include "../../include/matrix/Gemm.h"
+#include "../../include/matrix/Matrix.h"
+#include "../../include/matrix/Workspace.h"
+#include "../../include/activations/ActivationFunctions.h"
+#include <array>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+
+std::vector<double> randomBuffer(size_t size, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> dis(-1.0, 1.0);
+    std::vector<double> buffer(size);
+    for (double& value : buffer) {
+        value = dis(gen);
+    }
+    return buffer;
+}
+
+// Straightforward reference: C = alpha * A * B + beta * C
+void referenceGemm(size_t M, size_t N, size_t K, double alpha, const std::vector<double>& A, size_t lda,
+                   const std::vector<double>& B, size_t ldb, double beta, std::vector<double>& C, size_t ldc) {
+    for (size_t i = 0; i < M; ++i) {
+        for (size_t j = 0; j < N; ++j) {
+            double sum = 0.0;
+            for (size_t k = 0; k < K; ++k) {
+                sum += A[i * lda + k] * B[k * ldb + j];
+            }
+            C[i * ldc + j] = alpha * sum + beta * C[i * ldc + j];
+        }
+    }
+}
+
+void expectGemmMatchesReference(size_t M, size_t N, size_t K, double alpha, double beta) {
+    // Leading dimensions larger than the logical width exercise the strided paths
+    const size_t lda = K + 3, ldb = N + 1, ldc = N + 2;
+    std::vector<double> A = randomBuffer(M * lda, 1);
+    std::vector<double> B = randomBuffer(K * ldb, 2);
+    std::vector<double> C = randomBuffer(M * ldc, 3);
+    std::vector<double> expected = C;
+
+    kernels::gemm(M, N, K, alpha, A.data(), lda, B.data(), ldb, beta, C.data(), ldc);
+    referenceGemm(M, N, K, alpha, A, lda, B, ldb, beta, expected, ldc);
+
+    for (size_t i = 0; i < M; ++i) {
+        for (size_t j = 0; j < N; ++j) {
+            ASSERT_NEAR(C[i * ldc + j], expected[i * ldc + j], 1e-9) << "at (" << i << ", " << j << ")";
+        }
+    }
+}
+
+} // namespace
+
+TEST(GemmTest, SmallProductMatchesReference) {
+    expectGemmMatchesReference(3, 5, 7, 1.0, 0.0);
+}
+
+TEST(GemmTest, BlockedProductMatchesReference) {
+    forEachSimdLevel([] {
+        // Sizes straddle the register tile and the KC/MC blocking boundaries
+        expectGemmMatchesReference(131, 77, 300, 1.0, 0.0);
+        expectGemmMatchesReference(64, 64, 64, 1.0, 0.0);
+    });
+}
+
+TEST(GemmTest, AlphaAndBetaAreApplied) {
+    forEachSimdLevel([] {
+        expectGemmMatchesReference(45, 39, 270, 0.5, -2.0);
+    });
+}
+
+TEST(GemmTest, ZeroInnerDimensionScalesC) {
+    std::vector<double> C = {1.0, 2.0, 3.0, 4.0};
+    kernels::gemm(2, 2, 0, 1.0, nullptr, 0, nullptr, 2, 0.5, C.data(), 2);
+    EXPECT_DOUBLE_EQ(C[0], 0.5);
+    EXPECT_DOUBLE_EQ(C[3], 2.0);
+}
+
+TEST(GemmTest, MatrixMultiplyUsesBlockedKernel) {
+    Matrix a(70, 90), b(90, 50);
+    a.randomize(-1.0, 1.0);
+    b.randomize(-1.0, 1.0);
+
+    Matrix result = a.multiply(b, false);
+
+    ASSERT_EQ(result.getRows(), 70);
+    ASSERT_EQ(result.getCols(), 50);
+    for (size_t i = 0; i < 70; i += 7) {
+        for (size_t j = 0; j < 50; j += 3) {
+            double expected = 0.0;
+            for (size_t k = 0; k < 90; ++k) {
+                expected += a(i, k) * b(k, j);
+            }
+            EXPECT_NEAR(result(i, j), expected, 1e-9);
+        }
+    }
+}
+
+TEST(GemmTest, TransposedViewsNeedNoCopy) {
+    forEachSimdLevel([] {
+        // Stored as A^T (K x M) and B^T (N x K); multiplied through transposed views
+        const size_t M = 37, N = 45, K = 60;
+        Matrix at(K, M), bt(N, K);
+        at.randomize(-1.0, 1.0);
+        bt.randomize(-1.0, 1.0);
+        Matrix c(M, N);
+
+        kernels::gemm(1.0, at.view().transpose(), bt.view().transpose(), 0.0, c.view());
+
+        const Matrix expected = at.transpose().multiply(bt.transpose(), false);
+        EXPECT_TRUE(c.isEqual(expected, 1e-9));
+    });
+}
+
+TEST(GemmTest, StridedDestinationView) {
+    Matrix a(3, 4), b(4, 5), ct(5, 3);
+    a.randomize(-1.0, 1.0);
+    b.randomize(-1.0, 1.0);
+
+    // Writing through a transposed view of C^T stores the product transposed
+    kernels::gemm(1.0, a, b, 0.0, ct.view().transpose());
+
+    EXPECT_TRUE(ct.isEqual(a.multiply(b, false).transpose(), 1e-12));
+    EXPECT_THROW(kernels::gemm(1.0, a, a, 0.0, ct.view()), std::invalid_argument);
+}
+
+TEST(GemmTest, FloatProductMatchesDouble) {
+    forEachSimdLevel([] {
+        // Large enough for the packed path; sizes straddle the float register tiles
+        const size_t M = 67, N = 83, K = 129;
+        Matrix a(M, K), b(K, N);
+        a.randomize(-1.0, 1.0);
+        b.randomize(-1.0, 1.0);
+
+        const Matrix expected = a.multiply(b, false);
+        const MatrixF result = a.cast<float>().multiply(b.cast<float>(), false);
+
+        ASSERT_EQ(result.getRows(), M);
+        ASSERT_EQ(result.getCols(), N);
+        EXPECT_TRUE(result.cast<double>().isEqual(expected, 1e-4));
+    });
+}
+
+TEST(GemmTest, EpilogueFusesBiasAndActivation) {
+    const size_t previous = kernels::getGemmParallelThreshold();
+    TanhActivation tanh;
+    // Small (unpacked), packed and threaded paths all have to run the epilogue exactly once per element
+    for (size_t threshold : {previous, size_t(1)}) {
+        kernels::setGemmParallelThreshold(threshold);
+        forEachSimdLevel([&] {
+            for (auto [M, N, K] : {std::array<size_t, 3>{3, 5, 7}, std::array<size_t, 3>{131, 77, 300}}) {
+                Matrix a(M, K), b(K, N), rowBias(M, 1), colBias(1, N);
+                a.randomize(-0.1, 0.1);
+                b.randomize(-0.1, 0.1);
+                rowBias.randomize(-1.0, 1.0);
+                colBias.randomize(-1.0, 1.0);
+
+                Matrix expected = a.multiply(b, false);
+                for (size_t i = 0; i < M; ++i) {
+                    for (size_t j = 0; j < N; ++j) {
+                        expected(i, j) = std::tanh(expected(i, j) + rowBias(i, 0) + colBias(0, j));
+                    }
+                }
+
+                Matrix c(M, N);
+                kernels::gemm(1.0, a, b, 0.0, c.view(),
+                              tanh.epilogue(rowBias.view().getPointer(), colBias.view().getPointer()));
+                EXPECT_TRUE(c.isEqual(expected, 1e-9));
+            }
+        });
+    }
+    kernels::setGemmParallelThreshold(previous);
+}
+
+TEST(GemmTest, TransposeFlagsReadStoredLayout) {
+    using kernels::Transpose;
+    forEachSimdLevel([] {
+        const size_t M = 45, N = 38, K = 70;
+        for (Transpose ta : {Transpose::No, Transpose::Yes}) {
+            for (Transpose tb : {Transpose::No, Transpose::Yes}) {
+                // Operands are stored in the layout the flags describe
+                Matrix a = (ta == Transpose::Yes) ? Matrix(K, M) : Matrix(M, K);
+                Matrix b = (tb == Transpose::Yes) ? Matrix(N, K) : Matrix(K, N);
+                a.randomize(-1.0, 1.0);
+                b.randomize(-1.0, 1.0);
+                const Matrix opA = (ta == Transpose::Yes) ? a.transpose() : a;
+                const Matrix opB = (tb == Transpose::Yes) ? b.transpose() : b;
+                const Matrix expected = opA.multiply(opB, false);
+
+                Matrix viaPointers(M, N);
+                kernels::gemm(ta, tb, M, N, K, 1.0, a.view().getPointer(), a.getCols(),
+                              b.view().getPointer(), b.getCols(), 0.0, viaPointers.view().getPointer(), N);
+                EXPECT_TRUE(viaPointers.isEqual(expected, 1e-9));
+
+                Matrix viaViews(M, N);
+                kernels::gemm(ta, tb, 1.0, a, b, 0.0, viaViews.view());
+                EXPECT_TRUE(viaViews.isEqual(expected, 1e-9));
+
+                EXPECT_TRUE(a.multiply(b, ta, tb).isEqual(expected, 1e-9));
+            }
+        }
+    });
+    EXPECT_THROW(Matrix(3, 4).multiply(Matrix(3, 4), kernels::Transpose::No, kernels::Transpose::No),
+                 std::invalid_argument);
+}
+
+TEST(GemmTest, StrassenMatchesBlockedProduct) {
+    const size_t cutoff = kernels::getStrassenCutoff();
+    kernels::setStrassenCutoff(16);
+    EXPECT_FALSE(kernels::strassenPays(31, 64, 64));
+    EXPECT_FALSE(kernels::strassenPays(40, 200, 40));
+    EXPECT_TRUE(kernels::strassenPays(67, 71, 53));
+
+    // Odd sizes at every level exercise the peeling; two levels of recursion down to the cutoff
+    Matrix a(67, 53), b(53, 71);
+    a.randomize(-1.0, 1.0);
+    b.randomize(-1.0, 1.0);
+    const Matrix expected = a.multiply(b, false);
+    EXPECT_TRUE(a.multiply(b, false, kernels::GemmAlgorithm::Strassen).isEqual(expected, 1e-12));
+    EXPECT_TRUE(a.multiply(b, false, kernels::GemmAlgorithm::Auto).isEqual(expected, 1e-12));
+
+    // Inside a scope the scratch of the whole recursion comes from the workspace, next to the result
+    {
+        Workspace workspace;
+        WorkspaceScope scope(workspace);
+        const Matrix product = a.multiply(b, false, kernels::GemmAlgorithm::Strassen);
+        EXPECT_GT(workspace.getBytesUsed(), product.getData().size() * sizeof(double));
+        EXPECT_TRUE(product.isEqual(expected, 1e-12));
+    }
+
+    // Strided operands, and a strided destination that is accumulated into
+    Matrix ct(71, 67);
+    ct.setData(1.0);
+    kernels::gemm(kernels::GemmAlgorithm::Strassen, 2.0, a.transpose().view().transpose(), b, 0.5,
+                  ct.view().transpose());
+    EXPECT_TRUE(ct.transpose().isEqual(expected * 2.0 + 0.5, 1e-12));
+
+    MatrixF af = a.cast<float>(), bf = b.cast<float>();
+    EXPECT_TRUE(af.multiply(bf, false, kernels::GemmAlgorithm::Strassen).cast<double>().isEqual(expected, 1e-4));
+    EXPECT_THROW(kernels::gemm(kernels::GemmAlgorithm::Strassen, 1.0, a, a, 0.0, ct.view()), std::invalid_argument);
+    kernels::setStrassenCutoff(cutoff);
+}
@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+#include "SimdTestUtils.h"
+#include "../../include/matrix/HalfMatrix.h"
+#include "../../include/matrix/Random.h"
+#include "../../include/activations/ActivationFunctions.h"
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace {
+
+std::vector<float> roundTrip(const std::vector<float>& values, HalfFormat format) {
+    std::vector<uint16_t> halves(values.size());
+    std::vector<float> widened(values.size());
+    kernels::narrow(values.size(), values.data(), halves.data(), format);
+    kernels::widen(halves.size(), halves.data(), widened.data(), format);
+    return widened;
+}
+
+} // namespace
+
+TEST(HalfMatrixTest, ConversionsRoundToNearestEven) {
+    const float inf = std::numeric_limits<float>::infinity();
+    forEachSimdLevel([&] {
+        // Eleven values so that both the vector loop and the scalar tail run
+        const std::vector<float> values = {1.0f, -2.5f, 0.0f, 1.0f + 0x1p-9f, 1.0f + 0x1p-8f + 0x1p-9f, 3.0e38f,
+                                           inf, 65504.0f, 65520.0f, 0x1p-24f, 0x1p-25f};
+        const std::vector<float> bf16 = roundTrip(values, HalfFormat::BFloat16);
+        EXPECT_EQ(bf16[0], 1.0f);
+        EXPECT_EQ(bf16[1], -2.5f);
+        EXPECT_EQ(bf16[3], 1.0f);                // Halfway, ties to the even neighbour
+        EXPECT_EQ(bf16[4], 1.0f + 0x1p-7f);      // Halfway, ties up to even
+        EXPECT_NEAR(bf16[5], 3.0e38f, 3.0e38f * 0x1p-8f);
+        EXPECT_EQ(bf16[6], inf);
+
+        const std::vector<float> fp16 = roundTrip(values, HalfFormat::Float16);
+        EXPECT_EQ(fp16[3], 1.0f + 0x1p-9f);      // Exactly representable with 11 bits
+        EXPECT_EQ(fp16[5], inf);                 // Out of range
+        EXPECT_EQ(fp16[7], 65504.0f);
+        EXPECT_EQ(fp16[8], inf);
+        EXPECT_EQ(fp16[9], 0x1p-24f);            // Smallest subnormal
+        EXPECT_EQ(fp16[10], 0.0f);
+
+        const std::vector<float> nan = roundTrip(std::vector<float>(9, std::nanf("")), HalfFormat::BFloat16);
+        EXPECT_TRUE(std::isnan(nan[0]) && std::isnan(nan[8]));
+    });
+}
+
+TEST(HalfMatrixTest, StoresViewsAtHalfTheSize) {
+    Philox rng(3);
+    Matrix m(6, 5);
+    m.randomize(rng, -4.0, 4.0);
+    const HalfMatrix half(m.view().transpose(), HalfFormat::Float16);
+    EXPECT_EQ(half.getRows(), 5u);
+    EXPECT_EQ(half.getCols(), 6u);
+    EXPECT_EQ(half.getStorageBytes(), 60u);
+
+    const Matrix restored = half.toMatrix<double>("restored");
+    for (size_t i = 0; i < 6; ++i) {
+        for (size_t j = 0; j < 5; ++j) {
+            EXPECT_NEAR(restored(j, i), m(i, j), 4.0 * 0x1p-11);
+            EXPECT_EQ(half(j, i), static_cast<float>(restored(j, i)));
+        }
+    }
+    EXPECT_THROW(half(5, 0), std::out_of_range);
+}
+
+TEST(HalfMatrixTest, GemmWidensEitherOperand) {
+    Philox rng(4);
+    MatrixF a(70, 300);
+    MatrixF b(300, 9);
+    a.randomize(rng, -1.0, 1.0);
+    b.randomize(rng, -1.0, 1.0);
+    const HalfMatrix halfA(a.view());
+    const HalfMatrix halfB(b.view());
+    const MatrixF widenedA = halfA.toMatrix<float>();
+    const MatrixF widenedB = halfB.toMatrix<float>();
+
+    std::vector<float> bias(70, 0.25f);
+    TanhActivationF tanh;
+    MatrixF expected(70, 9);
+    kernels::gemm(1.0f, widenedA, b, 0.0f, expected.view(), tanh.epilogue(bias.data()));
+    MatrixF left(70, 9);
+    kernels::gemm(1.0f, halfA, b, 0.0f, left.view(), tanh.epilogue(bias.data()));
+    EXPECT_TRUE(left.isEqual(expected, 1e-5));
+
+    // The right operand is widened in slices of the shared dimension, which accumulate onto C
+    MatrixF right(70, 9);
+    right.setData(1.0f);
+    expected.setData(1.0f);
+    kernels::gemm(2.0f, a, widenedB, 1.0f, expected.view());
+    kernels::gemm(2.0f, a, halfB, 1.0f, right.view());
+    EXPECT_TRUE(right.isEqual(expected, 1e-4));
+
+    EXPECT_THROW(kernels::gemm(1.0f, halfA, a, 0.0f, left.view()), std::invalid_argument);
+}
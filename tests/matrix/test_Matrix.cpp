@@ -4,6 +4,7 @@
 #include <iostream>
 #include <fstream>
 #include <cmath>
+#include <type_traits>
 
 // Constructors and Destructor
 TEST(MatrixTest, CreateIdentityMatrix) {
@@ -71,6 +72,33 @@ TEST(MatrixTest, FillByHandWithOperator) {
     EXPECT_EQ(oss.str(), expected_output);
 }
 
+// Storage layout
+TEST(MatrixTest, ContiguousRowMajorStorage) {
+    Matrix mat(2, 3);
+    mat.setData({{1.0, 2.0, 3.0},
+                 {4.0, 5.0, 6.0}});
+
+    std::span<const double> data = mat.getData();
+    ASSERT_EQ(data.size(), 6);
+    EXPECT_EQ(mat.getStride(), 3);
+    for (size_t i = 0; i < data.size(); ++i) {
+        EXPECT_DOUBLE_EQ(data[i], static_cast<double>(i + 1));
+    }
+}
+
+TEST(MatrixTest, GetRowSpansBuffer) {
+    Matrix mat(2, 3);
+    mat.setData({{1.0, 2.0, 3.0},
+                 {4.0, 5.0, 6.0}});
+
+    std::span<const double> row = mat.getRow(1);
+    ASSERT_EQ(row.size(), 3);
+    EXPECT_EQ(row.data(), mat.getData().data() + mat.getStride());
+    EXPECT_DOUBLE_EQ(row[0], 4.0);
+    EXPECT_DOUBLE_EQ(row[2], 6.0);
+    EXPECT_THROW(mat.getRow(2), std::out_of_range);
+}
+
 // Test sumRows() on a non-empty matrix
 TEST(MatrixTest, SumRowsValid) {
     Matrix mat(3, 3);
@@ -82,9 +110,9 @@ TEST(MatrixTest, SumRowsValid) {
 
     EXPECT_EQ(result.getRows(), 3);
     EXPECT_EQ(result.getCols(), 1);
-    EXPECT_DOUBLE_EQ(result.getData()[0][0], 6.0);  // 1+2+3
-    EXPECT_DOUBLE_EQ(result.getData()[1][0], 15.0); // 4+5+6
-    EXPECT_DOUBLE_EQ(result.getData()[2][0], 24.0); // 7+8+9
+    EXPECT_DOUBLE_EQ(result(0, 0), 6.0);  // 1+2+3
+    EXPECT_DOUBLE_EQ(result(1, 0), 15.0); // 4+5+6
+    EXPECT_DOUBLE_EQ(result(2, 0), 24.0); // 7+8+9
 }
 
 // Test sumColumns() on a non-empty matrix
@@ -98,9 +126,9 @@ TEST(MatrixTest, SumColumnsValid) {
 
     EXPECT_EQ(result.getRows(), 1);
     EXPECT_EQ(result.getCols(), 3);
-    EXPECT_DOUBLE_EQ(result.getData()[0][0], 12.0); // 1+4+7
-    EXPECT_DOUBLE_EQ(result.getData()[0][1], 15.0); // 2+5+8
-    EXPECT_DOUBLE_EQ(result.getData()[0][2], 18.0); // 3+6+9
+    EXPECT_DOUBLE_EQ(result(0, 0), 12.0); // 1+4+7
+    EXPECT_DOUBLE_EQ(result(0, 1), 15.0); // 2+5+8
+    EXPECT_DOUBLE_EQ(result(0, 2), 18.0); // 3+6+9
 }
 
 // Test sumRows() on an empty matrix (should throw an exception)
@@ -327,12 +355,9 @@ TEST(MatrixTest, ApplyFunction) {
 TEST(MatrixTest, RandomizeMatrix) {
     Matrix m(2, 2, "RandomMatrix");
     m.randomize(0.0f, 1.0f);
-    const auto& data = m.getData();
-    for (const auto& row : data) {
-        for (const auto& value : row) {
-            EXPECT_GE(value, 0.0f);
-            EXPECT_LE(value, 1.0f);
-        }
+    for (double value : m.getData()) {
+        EXPECT_GE(value, 0.0f);
+        EXPECT_LE(value, 1.0f);
     }
 }
 
@@ -362,3 +387,167 @@ TEST(MatrixTest, ScalarDivision) {
     EXPECT_EQ(oss.str(), expected_output);
 }
 
+// Move Semantics and Compound Assignment
+TEST(MatrixTest, MoveConstructorTakesBuffer) {
+    Matrix source(2, 2, "Source");
+    source.setData({{1.0, 2.0}, {3.0, 4.0}});
+    const double* buffer = source.getData().data();
+
+    Matrix moved(std::move(source));
+
+    EXPECT_EQ(moved.getData().data(), buffer);  // No copy was made
+    EXPECT_EQ(moved.getName(), "Source");
+    EXPECT_DOUBLE_EQ(moved(1, 0), 3.0);
+    EXPECT_EQ(source.getRows(), 0);
+    EXPECT_TRUE(source.isEmpty());
+}
+
+TEST(MatrixTest, MoveAssignmentTakesBuffer) {
+    Matrix source(3, 1);
+    source.setData(7.0);
+    const double* buffer = source.getData().data();
+
+    Matrix target(1, 1, "Target");
+    target = std::move(source);
+
+    EXPECT_EQ(target.getData().data(), buffer);
+    EXPECT_EQ(target.getRows(), 3);
+    EXPECT_DOUBLE_EQ(target(2, 0), 7.0);
+}
+
+TEST(MatrixTest, MoveAssignmentMayCopyAcrossResources) {
+    // Only the move constructor is noexcept: a move assignment out of a workspace copies into the heap
+    EXPECT_TRUE(std::is_nothrow_move_constructible_v<Matrix>);
+    EXPECT_FALSE(std::is_nothrow_move_assignable_v<Matrix>);
+}
+
+TEST(MatrixTest, SelfMoveAssignmentKeepsElements) {
+    Matrix m(2, 3, "Self");
+    m.setData(4.0);
+    Matrix& alias = m;
+    m = std::move(alias);
+
+    EXPECT_EQ(m.getRows(), 2);
+    EXPECT_EQ(m.getCols(), 3);
+    EXPECT_EQ(m.getData().size(), 6u);
+    EXPECT_DOUBLE_EQ(m(1, 2), 4.0);
+}
+
+TEST(MatrixTest, CompoundAssignmentIsInPlace) {
+    Matrix m(2, 2, "Matrix");
+    m.setData({{1.0, 2.0}, {3.0, 4.0}});
+    Matrix other(2, 2);
+    other.setData({{1.0, 1.0}, {2.0, 2.0}});
+    const double* buffer = m.getData().data();
+
+    m += other;      // 2 3 / 5 6
+    m *= 2.0;        // 4 6 / 10 12
+    m -= other * 2.0; // 2 4 / 6 8
+    m *= other;      // 2 4 / 12 16
+    m /= 2.0;        // 1 2 / 6 8
+
+    Matrix expected(2, 2);
+    expected.setData({{1.0, 2.0}, {6.0, 8.0}});
+    EXPECT_EQ(m, expected);
+    EXPECT_EQ(m.getData().data(), buffer);
+    EXPECT_THROW(m += Matrix(3, 3), std::invalid_argument);
+}
+
+TEST(MatrixTest, AxpyUpdatesInPlace) {
+    Matrix weights(1, 11);
+    weights.setData(1.0);
+    Matrix gradient(1, 11);
+    for (size_t j = 0; j < 11; ++j) {
+        gradient(0, j) = static_cast<double>(j);
+    }
+
+    weights.axpy(-0.5, gradient);
+
+    for (size_t j = 0; j < 11; ++j) {
+        EXPECT_DOUBLE_EQ(weights(0, j), 1.0 - 0.5 * static_cast<double>(j));
+    }
+    EXPECT_THROW(weights.axpy(1.0, Matrix(11, 1)), std::invalid_argument);
+}
+
+TEST(MatrixTest, SinglePrecisionArithmeticAndCast) {
+    MatrixF a(2, 3);
+    a.setData({{1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}});
+    MatrixF b(2, 3);
+    b.setData(0.5f);
+
+    MatrixF c = (a + b) * 2.0;
+    EXPECT_FLOAT_EQ(c(0, 0), 3.0f);
+    EXPECT_FLOAT_EQ(c(1, 2), 13.0f);
+
+    Matrix widened = c.cast<double>();
+    EXPECT_EQ(widened.getRows(), 2);
+    EXPECT_DOUBLE_EQ(widened(1, 1), 11.0);
+    EXPECT_TRUE(widened.cast<float>().isEqual(c, 0.0));
+}
+
+TEST(MatrixTest, UncheckedAccessAndIterators) {
+    Matrix m(2, 3, "Raw");
+    double value = 0.0;
+    for (double& element : m) {
+        element = value++;
+    }
+    EXPECT_EQ(m.end() - m.begin(), 6);
+    EXPECT_EQ((m[1, 2]), 5.0);
+    EXPECT_EQ(m.rowData(1)[0], 3.0);
+    m[0, 1] = -1.0;
+    EXPECT_EQ(m(0, 1), -1.0);
+
+    const Matrix& constant = m;
+    EXPECT_EQ(*std::max_element(constant.begin(), constant.end()), 5.0);
+    EXPECT_EQ((m.view().transpose()[2, 1]), 5.0);
+
+    // Only checked builds verify the indices of operator[]; operator() always does
+    EXPECT_THROW(m(2, 0), std::out_of_range);
+#ifdef MATRIX_CHECKED
+    EXPECT_THROW((m[2, 0]), std::out_of_range);
+    EXPECT_THROW(m.rowData(2), std::out_of_range);
+    EXPECT_THROW((m.view()[0, 3]), std::out_of_range);
+#endif
+}
+
+TEST(MatrixTest, DestinationPassingReusesOutput) {
+    Matrix a(2, 3);
+    a.setData({{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}});
+    Matrix bias(1, 3);
+    bias.setData({{10.0, 20.0, 30.0}});
+
+    Matrix out(2, 3);
+    const double* buffer = out.getData().data();
+    a.addInto(bias, out);
+    EXPECT_EQ(out, a.add(bias));
+    a.multiplyInto(2.0, out);
+    EXPECT_EQ(out, a.multiply(2.0));
+    a.applyFunctionInto([](double x) { return -x; }, out);
+    EXPECT_EQ(out, a.multiply(-1.0));
+    EXPECT_EQ(out.getData().data(), buffer);
+
+    // Outputs can be blocks of a larger matrix, and element-wise operations can write over an operand
+    Matrix target(4, 4);
+    a.subtractInto(bias, target.block(1, 1, 2, 3));
+    EXPECT_EQ(target(2, 3), 6.0 - 30.0);
+    EXPECT_EQ(target(0, 0), 0.0);
+    a.multiplyInto(a, a);
+    EXPECT_EQ(a(1, 2), 36.0);
+
+    Matrix product(2, 2);
+    a.multiplyInto(a, kernels::Transpose::No, kernels::Transpose::Yes, product);
+    EXPECT_EQ(product, a.multiply(a, kernels::Transpose::No, kernels::Transpose::Yes));
+    Matrix transposed(3, 2);
+    a.transposeInto(transposed);
+    EXPECT_EQ(transposed, a.transpose());
+
+    a.sumRowsInto(target.block(0, 0, 2, 1));
+    EXPECT_EQ(target(1, 0), 16.0 + 25.0 + 36.0);
+    Matrix columnSums(1, 3);
+    a.sumColumnsInto(columnSums);
+    EXPECT_EQ(columnSums, a.sumColumns());
+
+    EXPECT_THROW(a.addInto(bias, product), std::invalid_argument);
+    EXPECT_THROW(a.multiplyInto(2.0, target.view().transpose().block(0, 0, 2, 3)), std::invalid_argument);
+    EXPECT_THROW(a.transposeInto(out), std::invalid_argument);
+}
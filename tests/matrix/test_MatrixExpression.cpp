@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+#include "../../include/matrix/Matrix.h"
+#include <type_traits>
+
+namespace {
+
+Matrix makeMatrix(std::initializer_list<std::initializer_list<double>> values, const std::string& name = "UNNAMED") {
+    std::vector<std::vector<double>> rows;
+    for (const auto& row : values) {
+        rows.emplace_back(row);
+    }
+    Matrix m(rows.size(), rows[0].size(), name);
+    m.setData(rows);
+    return m;
+}
+
+} // namespace
+
+TEST(MatrixExpressionTest, OperatorsAreLazy) {
+    Matrix a = makeMatrix({{1, 2}, {3, 4}});
+    Matrix b = makeMatrix({{5, 6}, {7, 8}});
+
+    // Building the expression does not produce a Matrix
+    EXPECT_FALSE((std::is_same_v<decltype(a + b), Matrix>));
+    EXPECT_TRUE(MatrixExpression<decltype((a + b) * a - 2.0 * b)>);
+}
+
+TEST(MatrixExpressionTest, ChainedExpressionEvaluatesCorrectly) {
+    Matrix f = makeMatrix({{0.5, 0.25}, {1.0, 0.0}});
+    Matrix c = makeMatrix({{2, 4}, {6, 8}});
+    Matrix i = makeMatrix({{1, 1}, {0, 2}});
+    Matrix g = makeMatrix({{3, -1}, {5, 7}});
+
+    Matrix result = (f * c) + (i * g) - c / 2.0 + 1.0;
+
+    EXPECT_EQ(result, makeMatrix({{4.0, -1.0}, {4.0, 11.0}}));
+    EXPECT_EQ(result.getName(), "Result");
+}
+
+TEST(MatrixExpressionTest, ScalarForms) {
+    Matrix a = makeMatrix({{1, 2}, {3, 4}});
+
+    EXPECT_EQ(Matrix(1.0 - a), makeMatrix({{0, -1}, {-2, -3}}));
+    EXPECT_EQ(Matrix(a - 1.0), makeMatrix({{0, 1}, {2, 3}}));
+    EXPECT_EQ(Matrix(2.0 * a), makeMatrix({{2, 4}, {6, 8}}));
+    EXPECT_EQ(Matrix(-a), makeMatrix({{-1, -2}, {-3, -4}}));
+}
+
+TEST(MatrixExpressionTest, AssignmentMayReadDestination) {
+    Matrix cell = makeMatrix({{1, 2, 3}}, "cellState");
+    Matrix f = makeMatrix({{0.5, 0.5, 0.5}});
+    Matrix input = makeMatrix({{1, 1, 1}});
+
+    cell = (f * cell) + input;
+
+    EXPECT_EQ(cell, makeMatrix({{1.5, 2.0, 2.5}}));
+    EXPECT_EQ(cell.getName(), "cellState");  // Assignment keeps the destination's name
+}
+
+TEST(MatrixExpressionTest, AssignmentResizesDestination) {
+    Matrix target(1, 1, "Target");
+    Matrix a = makeMatrix({{1, 2}, {3, 4}});
+
+    target = a * a;
+
+    EXPECT_EQ(target.getRows(), 2);
+    EXPECT_EQ(target.getCols(), 2);
+    EXPECT_EQ(target, makeMatrix({{1, 4}, {9, 16}}));
+}
+
+TEST(MatrixExpressionTest, MismatchedShapesThrow) {
+    Matrix a(2, 2), b(2, 3);
+    EXPECT_THROW(a + b, std::invalid_argument);
+    EXPECT_THROW(a - b, std::invalid_argument);
+    EXPECT_THROW(a * b, std::invalid_argument);
+
+    Matrix column(3, 1);
+    EXPECT_THROW(a + column, std::invalid_argument);
+}
+
+TEST(MatrixExpressionTest, VectorsBroadcastLikeAdd) {
+    Matrix a = makeMatrix({{1, 2, 3}, {4, 5, 6}});
+    Matrix row = makeMatrix({{10, 20, 30}});
+    Matrix column = makeMatrix({{1}, {2}});
+
+    Matrix sum = a + row;
+    EXPECT_TRUE(sum.isEqual(a.add(row)));
+    Matrix scaled = column * a - 1.0;
+    EXPECT_TRUE(scaled.isEqual(makeMatrix({{0, 1, 2}, {7, 9, 11}})));
+
+    // A row and a column combine into their outer sum
+    Matrix outer = column + row;
+    EXPECT_TRUE(outer.isEqual(makeMatrix({{11, 21, 31}, {12, 22, 32}})));
+
+    // Broadcasting through a nested expression
+    Matrix nested = (a - column) * row;
+    EXPECT_TRUE(nested.isEqual(makeMatrix({{0, 20, 60}, {20, 60, 120}})));
+}
+
+TEST(MatrixExpressionTest, BroadcastOfDestinationIsReadBeforeWrite) {
+    // Row 0 is broadcast to every row, including itself, so it must not be overwritten before the other rows
+    Matrix m = makeMatrix({{1, 2, 3}, {4, 6, 8}});
+    m = m - m.view().row(0);
+    EXPECT_TRUE(m.isEqual(makeMatrix({{0, 0, 0}, {3, 4, 5}})));
+
+    Matrix n = makeMatrix({{1, 2, 3}, {4, 6, 8}});
+    n -= n.view().col(0);
+    EXPECT_TRUE(n.isEqual(makeMatrix({{0, 1, 2}, {0, 2, 4}})));
+
+    Matrix column = makeMatrix({{1}, {2}, {3}});
+    column = column - column.view().row(0);
+    EXPECT_TRUE(column.isEqual(makeMatrix({{0}, {1}, {2}})));
+
+    Matrix v = makeMatrix({{1, 2, 3}});
+    v = v - v.view().col(0);
+    EXPECT_TRUE(v.isEqual(makeMatrix({{0, 1, 2}})));
+}
+
+TEST(MatrixExpressionTest, StridedViewOfDestinationIsReadBeforeWrite) {
+    // Row 1 reads s(0, 1) through the transpose after row 0 was written
+    Matrix s = makeMatrix({{1, 2}, {3, 4}});
+    s = s + s.view().transpose();
+    EXPECT_TRUE(s.isEqual(makeMatrix({{2, 5}, {5, 8}})));
+
+    Matrix t = makeMatrix({{1, 2}, {3, 4}});
+    t += t.view().transpose();
+    EXPECT_TRUE(t.isEqual(makeMatrix({{2, 5}, {5, 8}})));
+
+    // The destination's own view is read element for element and needs no scratch buffer
+    Matrix u = makeMatrix({{1, 2}, {3, 4}});
+    u = u * u.view();
+    EXPECT_TRUE(u.isEqual(makeMatrix({{1, 4}, {9, 16}})));
+}
+
+TEST(MatrixExpressionTest, CompoundAssignmentKeepsShape) {
+    Matrix a = makeMatrix({{1, 2, 3}, {4, 5, 6}});
+    Matrix column = makeMatrix({{1}, {2}});
+
+    a -= column;
+    EXPECT_TRUE(a.isEqual(makeMatrix({{0, 1, 2}, {2, 3, 4}})));
+    EXPECT_THROW(column += a, std::invalid_argument);
+    EXPECT_EQ(column.getCols(), 1u);
+}
+
+TEST(MatrixExpressionTest, EvalMaterializesForMatrixProduct) {
+    Matrix h = makeMatrix({{1, 2}});
+    Matrix r = makeMatrix({{2, 0.5}});
+    Matrix u = makeMatrix({{1, 0}, {0, 1}});
+
+    Matrix result = (h * r).eval().multiply(u, false);
+
+    EXPECT_EQ(result, makeMatrix({{2, 1}}));
+}
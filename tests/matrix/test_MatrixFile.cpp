@@ -0,0 +1,246 @@
+#include <gtest/gtest.h>
+#include "../../include/matrix/MatrixFile.h"
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+std::string tempPath(const std::string& name) {
+    return (std::filesystem::temp_directory_path() / ("matrix_file_test_" + name + ".bin")).string();
+}
+
+Matrix example() {
+    Matrix m(3, 5, "Example");
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 5; ++j) {
+            m(i, j) = static_cast<double>(i * 10 + j) - 7.25;
+        }
+    }
+    return m;
+}
+
+} // namespace
+
+TEST(MatrixFileTest, SaveAndLoadRoundTrip) {
+    const std::string path = tempPath("round_trip");
+    const Matrix m = example();
+    matrix_file::save(m, path);
+
+    // Header, padding to the aligned offset, then the raw elements
+    EXPECT_EQ(std::filesystem::file_size(path), matrix_file::DATA_ALIGNMENT + 15 * sizeof(double));
+
+    const Matrix loaded = matrix_file::load<double>(path);
+    EXPECT_TRUE(loaded == m);
+
+    // Strided views are written in row-major order; the other precision is converted on load
+    matrix_file::save(m.view().transpose(), path);
+    const MatrixF converted = matrix_file::load<float>(path);
+    ASSERT_EQ(converted.getRows(), 5);
+    ASSERT_EQ(converted.getCols(), 3);
+    EXPECT_FLOAT_EQ(converted(4, 2), static_cast<float>(m(2, 4)));
+    std::filesystem::remove(path);
+}
+
+TEST(MatrixFileTest, MappedMatrixUsesFileInPlace) {
+    const std::string path = tempPath("mapped");
+    const Matrix m = example();
+    matrix_file::save(m, path);
+
+    MappedMatrix mapped(path);
+    ASSERT_EQ(mapped.getRows(), 3);
+    ASSERT_EQ(mapped.getCols(), 5);
+    EXPECT_EQ(mapped(2, 3), m(2, 3));
+    EXPECT_THROW(mapped(3, 0), std::out_of_range);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(mapped.view().getPointer()) % matrix_file::DATA_ALIGNMENT, 0u);
+
+    // Usable anywhere a view is accepted
+    const Matrix product = m.multiply(mapped, kernels::Transpose::No, kernels::Transpose::Yes);
+    const Matrix expected = m.multiply(m, kernels::Transpose::No, kernels::Transpose::Yes);
+    EXPECT_TRUE(product == expected);
+    EXPECT_TRUE(mapped.toMatrix() == m);
+
+    MappedMatrix moved(std::move(mapped));
+    EXPECT_EQ(mapped.getRows(), 0);
+    EXPECT_EQ(moved(1, 4), m(1, 4));
+
+    // Mapping requires the exact element type
+    EXPECT_THROW(MappedMatrixF{path}, std::runtime_error);
+    std::filesystem::remove(path);
+}
+
+TEST(MatrixFileTest, ForeignByteOrderIsSwappedOnLoad) {
+    const std::string path = tempPath("swapped");
+    const Matrix m = example();
+    matrix_file::save(m, path);
+
+    // Rewrite the file as a machine of the other byte order would have produced it
+    std::vector<char> bytes(std::filesystem::file_size(path));
+    {
+        std::ifstream in(path, std::ios::binary);
+        in.read(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+    auto reverse = [&](size_t offset, size_t size) {
+        std::reverse(bytes.begin() + offset, bytes.begin() + offset + size);
+    };
+    for (size_t offset = 8; offset < 24; offset += 4) {
+        reverse(offset, 4);
+    }
+    for (size_t offset = 24; offset < 48; offset += 8) {
+        reverse(offset, 8);
+    }
+    for (size_t offset = matrix_file::DATA_ALIGNMENT; offset < bytes.size(); offset += sizeof(double)) {
+        reverse(offset, sizeof(double));
+    }
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    EXPECT_TRUE(matrix_file::load<double>(path) == m);
+    EXPECT_THROW(MappedMatrix{path}, std::runtime_error);
+    std::filesystem::remove(path);
+}
+
+TEST(MatrixFileTest, RejectsInvalidFiles) {
+    const std::string path = tempPath("invalid");
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out << "rows,cols\n1,2\n";
+    }
+    EXPECT_THROW(matrix_file::load<double>(path), std::runtime_error);
+    EXPECT_THROW(MappedMatrix{path}, std::runtime_error);
+
+    // Truncated data
+    matrix_file::save(example(), path);
+    std::filesystem::resize_file(path, matrix_file::DATA_ALIGNMENT + 8);
+    EXPECT_THROW(matrix_file::load<double>(path), std::runtime_error);
+    EXPECT_THROW(MappedMatrix{path}, std::runtime_error);
+    std::filesystem::remove(path);
+
+    EXPECT_THROW(matrix_file::load<double>(tempPath("missing")), std::runtime_error);
+}
+
+TEST(MatrixFileTest, TextRoundTripWithEachDelimiter) {
+    Matrix m = example();
+    m(0, 0) = 0.1;
+    m(2, 4) = -1.2345678901234567e-300;
+    for (matrix_file::Delimiter delimiter : {matrix_file::Delimiter::Whitespace, matrix_file::Delimiter::Comma,
+                                             matrix_file::Delimiter::Tab}) {
+        std::stringstream stream;
+        matrix_file::writeText(m, stream, delimiter);
+        EXPECT_TRUE(matrix_file::readText<double>(stream, delimiter) == m);
+    }
+
+    // Shortest round-trip form, one row per line
+    std::ostringstream csv;
+    matrix_file::writeText(m.view().block(0, 0, 2, 2), csv, matrix_file::Delimiter::Comma);
+    EXPECT_EQ(csv.str(), "0.1,-6.25\n2.75,3.75\n");
+
+    const std::string path = tempPath("text");
+    matrix_file::saveText(m, path, matrix_file::Delimiter::Tab);
+    EXPECT_TRUE(matrix_file::loadText<double>(path, matrix_file::Delimiter::Tab) == m);
+    std::filesystem::remove(path);
+}
+
+TEST(MatrixFileTest, TextParsingRules) {
+    std::istringstream padded(" 1 \t+2.5e1\r\n\n-3   4\n");
+    const Matrix m = matrix_file::readText<double>(padded);
+    ASSERT_EQ(m.getRows(), 2);
+    ASSERT_EQ(m.getCols(), 2);
+    EXPECT_EQ(m(0, 1), 25.0);
+    EXPECT_EQ(m(1, 0), -3.0);
+
+    std::istringstream csv("1, 2 ,3\r\n4,5,6");
+    const MatrixF f = matrix_file::readText<float>(csv, matrix_file::Delimiter::Comma);
+    EXPECT_EQ(f.getRows(), 2);
+    EXPECT_EQ(f(1, 2), 6.0f);
+
+    std::istringstream ragged("1 2\n3\n");
+    EXPECT_THROW(matrix_file::readText<double>(ragged), std::runtime_error);
+    std::istringstream garbage("1 x\n");
+    EXPECT_THROW(matrix_file::readText<double>(garbage), std::runtime_error);
+    std::istringstream emptyField("1,,2\n");
+    EXPECT_THROW(matrix_file::readText<double>(emptyField, matrix_file::Delimiter::Comma), std::runtime_error);
+    std::istringstream wrongDelimiter("1,2\n");
+    EXPECT_THROW(matrix_file::readText<double>(wrongDelimiter), std::runtime_error);
+}
+
+TEST(MatrixFileTest, TextLinesLongerThanTheReadBlock) {
+    // One row wider than the reader's block forces the buffer to grow
+    Matrix wide(2, 150000, "Wide");
+    for (size_t j = 0; j < wide.getCols(); ++j) {
+        wide(0, j) = static_cast<double>(j) * 0.125;
+        wide(1, j) = -static_cast<double>(j);
+    }
+    std::stringstream stream;
+    matrix_file::writeText(wide, stream, matrix_file::Delimiter::Comma);
+    EXPECT_GT(stream.str().size(), size_t(1) << 20);
+    EXPECT_TRUE(matrix_file::readText<double>(stream, matrix_file::Delimiter::Comma) == wide);
+}
+
+TEST(MatrixFileTest, BatchReaderStreamsBinaryAndTextFiles) {
+    Matrix data(10, 3, "Data");
+    for (size_t i = 0; i < 10; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            data(i, j) = static_cast<double>(i) + 0.5 * static_cast<double>(j);
+        }
+    }
+    const std::string binaryPath = tempPath("batches_bin");
+    const std::string textPath = tempPath("batches_txt");
+    matrix_file::save(data, binaryPath);
+    matrix_file::saveText(data, textPath, matrix_file::Delimiter::Comma);
+
+    auto expectBatches = [&](auto& reader) {
+        EXPECT_EQ(reader.getCols(), 3);
+        for (int epoch = 0; epoch < 2; ++epoch) {
+            size_t row = 0;
+            std::vector<size_t> sizes;
+            while (auto batch = reader.next()) {
+                sizes.push_back(batch->getRows());
+                EXPECT_TRUE(*batch == Matrix(data.view().rowRange(row, row + batch->getRows())));
+                row += batch->getRows();
+            }
+            EXPECT_EQ(sizes, (std::vector<size_t>{4, 4, 2}));
+            EXPECT_FALSE(reader.next().has_value());
+            reader.reset();
+        }
+    };
+    BatchReader binary(binaryPath, 4);
+    expectBatches(binary);
+    BatchReader text(textPath, 4, matrix_file::Delimiter::Comma);
+    expectBatches(text);
+
+    // Converting precision on the fly
+    BatchReaderF single(binaryPath, 16);
+    const auto all = single.next();
+    ASSERT_TRUE(all.has_value());
+    EXPECT_EQ(all->getRows(), 10);
+    EXPECT_FLOAT_EQ((*all)(9, 2), 10.0f);
+
+    std::filesystem::remove(binaryPath);
+    std::filesystem::remove(textPath);
+}
+
+TEST(MatrixFileTest, BatchReaderReportsErrors) {
+    EXPECT_THROW(BatchReader(tempPath("missing"), 4), std::runtime_error);
+
+    const std::string path = tempPath("batches_bad");
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out << "1 2\n3 4\n5 6\n7\n";
+    }
+    EXPECT_THROW(BatchReader(path, 0, matrix_file::Delimiter::Whitespace), std::invalid_argument);
+    BatchReader reader(path, 2, matrix_file::Delimiter::Whitespace);
+    EXPECT_TRUE(reader.next().has_value());
+    EXPECT_THROW(reader.next(), std::runtime_error);  // Ragged second batch
+    EXPECT_THROW(reader.next(), std::runtime_error);
+    reader.reset();
+    EXPECT_EQ(reader.next()->getRows(), 2);
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+#include "../../include/matrix/Matrix.h"
+#include "../../include/matrix/MatrixView.h"
+#include <type_traits>
+
+namespace {
+
+// 4 x 3 matrix whose element (i, j) is 10 * i + j
+Matrix makeIndexed() {
+    Matrix m(4, 3);
+    for (size_t i = 0; i < 4; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            m(i, j) = 10.0 * i + j;
+        }
+    }
+    return m;
+}
+
+} // namespace
+
+TEST(MatrixViewTest, ViewSharesMatrixStorage) {
+    Matrix m = makeIndexed();
+    MatrixView v = m.view();
+
+    EXPECT_EQ(v.getRows(), 4);
+    EXPECT_EQ(v.getCols(), 3);
+    EXPECT_TRUE(v.isContiguous());
+
+    v(1, 2) = -1.0;
+    EXPECT_DOUBLE_EQ(m(1, 2), -1.0);
+}
+
+TEST(MatrixViewTest, BlockAndRowRange) {
+    Matrix m = makeIndexed();
+
+    ConstMatrixView block = m.block(1, 1, 2, 2);
+    EXPECT_DOUBLE_EQ(block(0, 0), 11.0);
+    EXPECT_DOUBLE_EQ(block(1, 1), 22.0);
+    EXPECT_FALSE(block.isContiguous());
+    EXPECT_TRUE(block.hasContiguousRows());
+
+    ConstMatrixView batch = m.rowRange(2, 4);
+    EXPECT_EQ(batch.getRows(), 2);
+    EXPECT_DOUBLE_EQ(batch(0, 0), 20.0);
+    EXPECT_TRUE(batch.isContiguous());
+
+    EXPECT_THROW(m.block(3, 0, 2, 1), std::out_of_range);
+    EXPECT_THROW(batch(2, 0), std::out_of_range);
+}
+
+TEST(MatrixViewTest, TransposeSwapsStrides) {
+    Matrix m = makeIndexed();
+    ConstMatrixView t = m.view().transpose();
+
+    EXPECT_EQ(t.getRows(), 3);
+    EXPECT_EQ(t.getCols(), 4);
+    EXPECT_DOUBLE_EQ(t(2, 3), 32.0);
+    EXPECT_EQ(Matrix(t), m.transpose());
+}
+
+TEST(MatrixViewTest, GetColIsStridedView) {
+    Matrix m = makeIndexed();
+    ConstMatrixView col = m.getCol(1);
+
+    ASSERT_EQ(col.getRows(), 4);
+    ASSERT_EQ(col.getCols(), 1);
+    for (size_t i = 0; i < 4; ++i) {
+        EXPECT_DOUBLE_EQ(col(i, 0), 10.0 * i + 1);
+    }
+    // The view refers to the matrix rather than to a temporary copy
+    m(3, 1) = 7.0;
+    EXPECT_DOUBLE_EQ(col(3, 0), 7.0);
+    EXPECT_THROW(m.getCol(3), std::out_of_range);
+}
+
+TEST(MatrixViewTest, GateSplitWithColRange) {
+    // Stacked weights for two gates: columns [0, 2) and [2, 4)
+    Matrix weights(2, 4);
+    weights.setData({{1, 2, 3, 4}, {5, 6, 7, 8}});
+    Matrix input(1, 2);
+    input.setData({{1, 1}});
+
+    Matrix gate = input.multiply(weights.view().colRange(2, 4), false);
+
+    Matrix expected(1, 2);
+    expected.setData({{10, 12}});
+    EXPECT_EQ(gate, expected);
+}
+
+TEST(MatrixViewTest, OperationsAcceptViews) {
+    Matrix m = makeIndexed();
+    Matrix ones(3, 4);
+    ones.setData(1.0);
+
+    // Element-wise kernels with a transposed (strided) operand
+    Matrix sum = ones.add(m.view().transpose());
+    EXPECT_DOUBLE_EQ(sum(2, 3), 33.0);
+
+    Matrix scaled(3, 4);
+    scaled.axpy(2.0, m.view().transpose());
+    EXPECT_DOUBLE_EQ(scaled(1, 2), 42.0);
+
+    // Views are expression operands too
+    Matrix top = m.rowRange(0, 2) + 1.0;
+    EXPECT_DOUBLE_EQ(top(1, 2), 13.0);
+    Matrix diff = ones - m.view().transpose();
+    EXPECT_DOUBLE_EQ(diff(0, 1), -9.0);
+}
+
+TEST(MatrixViewTest, BroadcastRowAndColumnVectors) {
+    Matrix m = makeIndexed();
+    Matrix rowVector(1, 3);
+    rowVector(0, 0) = 1.0;
+    rowVector(0, 1) = 2.0;
+    rowVector(0, 2) = 3.0;
+    Matrix columnVector(4, 1);
+    for (size_t i = 0; i < 4; ++i) {
+        columnVector(i, 0) = i + 1.0;
+    }
+
+    // Broadcast views repeat their single row or column with a zero stride, and are read-only since several
+    // elements alias one
+    const auto stretched = rowVector.view().broadcast(4, 3);
+    EXPECT_TRUE((std::is_same_v<decltype(stretched), const ConstMatrixView>));
+    EXPECT_EQ(stretched.getRowStride(), 0u);
+    EXPECT_DOUBLE_EQ(stretched(3, 2), 3.0);
+
+    Matrix rowSum = m.add(rowVector);
+    EXPECT_DOUBLE_EQ(rowSum(2, 1), 23.0);
+    Matrix columnDiff = m.subtract(columnVector);
+    EXPECT_DOUBLE_EQ(columnDiff(3, 2), 28.0);
+    Matrix product = m.multiply(columnVector);
+    EXPECT_DOUBLE_EQ(product(2, 1), 63.0);
+
+    // Strided operands broadcast too: column 0 of the transpose is the first row of m
+    Matrix fromStrided = m.add(m.view().transpose().col(0).transpose());
+    EXPECT_DOUBLE_EQ(fromStrided(1, 2), 14.0);
+
+    // Expressions accept an explicit broadcast view as well as the vector itself
+    m += columnVector.view().broadcast(4, 3);
+    EXPECT_DOUBLE_EQ(m(3, 0), 34.0);
+
+    EXPECT_THROW(m.add(Matrix(2, 3)), std::invalid_argument);
+    EXPECT_THROW(rowVector.view().broadcast(4, 2), std::invalid_argument);
+}
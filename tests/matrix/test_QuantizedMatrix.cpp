@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include "SimdTestUtils.h"
+#include "../../include/matrix/QuantizedMatrix.h"
+#include "../../include/activations/ActivationFunctions.h"
+#include "../../include/matrix/Random.h"
+#include <cmath>
+
+namespace {
+
+Matrix randomMatrix(size_t rows, size_t cols, uint64_t seed, double min = -1.0, double max = 1.0) {
+    Philox rng(seed);
+    Matrix m(rows, cols);
+    m.randomize(rng, min, max);
+    return m;
+}
+
+} // namespace
+
+TEST(QuantizedMatrixTest, RoundTripWithinHalfAStep) {
+    const Matrix m = randomMatrix(5, 70, 1);
+    const QuantizedMatrix q(m.view());
+    EXPECT_EQ(q.getRows(), 5u);
+    EXPECT_EQ(q.getCols(), 70u);
+    EXPECT_EQ(q.getStride(), 128u);
+    EXPECT_LT(q.getStorageBytes(), m.getRows() * m.getCols() * sizeof(double) / 2);
+
+    const Matrix restored = q.dequantize<double>();
+    for (size_t i = 0; i < 5; ++i) {
+        EXPECT_EQ(q.getZeroPoints()[i], 0);
+        for (size_t j = 0; j < 70; ++j) {
+            EXPECT_NEAR(restored(i, j), m(i, j), q.getScales()[i] / 2 + 1e-7);
+            EXPECT_FLOAT_EQ(q(i, j), static_cast<float>(restored(i, j)));
+        }
+    }
+    EXPECT_THROW(q(5, 0), std::out_of_range);
+}
+
+TEST(QuantizedMatrixTest, AsymmetricPerTensorKeepsZeroExact) {
+    Matrix m = randomMatrix(3, 10, 2, 0.0, 4.0);
+    m(1, 4) = 0.0;
+    const QuantizedMatrix q(m.view(), QuantizationGranularity::PerTensor, QuantizationScheme::Asymmetric);
+    EXPECT_EQ(q.getScales()[0], q.getScales()[2]);
+    EXPECT_EQ(q.getZeroPoints()[0], -128);
+    EXPECT_EQ(q(1, 4), 0.0f);
+    EXPECT_NEAR(q(2, 7), m(2, 7), q.getScales()[0]);
+
+    // A transposed view quantizes column by column
+    const QuantizedMatrix t(m.view().transpose());
+    EXPECT_EQ(t.getRows(), 10u);
+    EXPECT_NEAR(t(7, 2), m(2, 7), t.getScales()[7]);
+}
+
+TEST(QuantizedMatrixTest, GemmMatchesDequantizedProduct) {
+    forEachSimdLevel([] {
+        for (size_t M : {size_t(1), size_t(7), size_t(37)}) {
+            const Matrix a = randomMatrix(M, 130, 3);
+            const Matrix b = randomMatrix(9, 130, 4, -0.5, 2.0);
+            const QuantizedMatrix qa(a.view());
+            const QuantizedMatrix qb(b.view(), QuantizationGranularity::PerRow, QuantizationScheme::Asymmetric);
+
+            // The integer product is exact, so only the floating-point rescaling differs from the reference
+            Matrix expected = qa.dequantize<double>().multiply(qb.dequantize<double>(), kernels::Transpose::No,
+                                                               kernels::Transpose::Yes);
+            Matrix c(M, 9);
+            kernels::quantizedGemm(qa, qb, 0.0, c.view());
+            EXPECT_TRUE(c.isEqual(expected, 1e-9)) << "M = " << M;
+
+            // And it approximates the unquantized product
+            const Matrix exact = a.multiply(b, kernels::Transpose::No, kernels::Transpose::Yes);
+            EXPECT_TRUE(c.isEqual(exact, 0.2)) << "M = " << M;
+        }
+    });
+}
+
+TEST(QuantizedMatrixTest, GemmAccumulatesAndRunsEpilogue) {
+    const Matrix a = randomMatrix(2, 20, 5);
+    const Matrix b = randomMatrix(6, 20, 6);
+    const QuantizedMatrix qa(a.view());
+    const QuantizedMatrix qb(b.view());
+    const Matrix product = qa.dequantize<double>().multiply(qb.dequantize<double>(), kernels::Transpose::No,
+                                                            kernels::Transpose::Yes);
+
+    Matrix c(2, 6);
+    c.setData(1.0);
+    std::vector<double> rowBias = {0.5, -0.5};
+    std::vector<double> colBias = {0, 1, 2, 3, 4, 5};
+    ReLUActivation relu;
+    kernels::Epilogue<double> epilogue = relu.epilogue(rowBias.data(), colBias.data());
+    kernels::quantizedGemm(qa, qb, 2.0, c.view(), epilogue);
+    for (size_t i = 0; i < 2; ++i) {
+        for (size_t j = 0; j < 6; ++j) {
+            EXPECT_NEAR(c(i, j), std::max(0.0, product(i, j) + 2.0 + rowBias[i] + colBias[j]), 1e-9);
+        }
+    }
+
+    EXPECT_THROW(kernels::quantizedGemm(qa, qa, 0.0, c.view()), std::invalid_argument);
+}
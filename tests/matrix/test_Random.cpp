@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include "../../include/matrix/Matrix.h"
+#include "../../include/matrix/Random.h"
+#include "../../include/parallel/ThreadPool.h"
+#include <vector>
+
+TEST(RandomTest, PhiloxKnownAnswers) {
+    // Reference vectors from the Random123 distribution (philox4x32, 10 rounds)
+    EXPECT_EQ(Philox::block({0, 0, 0, 0}, {0, 0}),
+              (Philox::Block{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+    EXPECT_EQ(Philox::block({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff}),
+              (Philox::Block{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+    EXPECT_EQ(Philox::block({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0}),
+              (Philox::Block{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+}
+
+TEST(RandomTest, FillIsDeterministicForAnyThreadCount) {
+    ThreadPool& pool = ThreadPool::global();
+    const size_t threads = pool.getThreadCount();
+    const size_t previous = Philox::getParallelThreshold();
+
+    std::vector<std::vector<double>> fills;
+    for (size_t count : {size_t(1), size_t(3), size_t(8)}) {
+        pool.setThreadCount(count);
+        Philox::setParallelThreshold(count == 1 ? 1 << 30 : 1);
+        Philox rng(42);
+        std::vector<double> values(10007);
+        rng.fillUniform(values.data(), values.size(), -2.0, 3.0);
+        EXPECT_EQ(rng.getPosition(), (values.size() + 1) / 2);
+        fills.push_back(values);
+    }
+    pool.setThreadCount(threads);
+    Philox::setParallelThreshold(previous);
+
+    EXPECT_EQ(fills[0], fills[1]);
+    EXPECT_EQ(fills[0], fills[2]);
+    double sum = 0.0;
+    for (double v : fills[0]) {
+        EXPECT_GE(v, -2.0);
+        EXPECT_LT(v, 3.0);
+        sum += v;
+    }
+    EXPECT_NEAR(sum / static_cast<double>(fills[0].size()), 0.5, 0.05);
+}
+
+TEST(RandomTest, SeedsStreamsAndPositions) {
+    Philox a(7);
+    Philox b(7);
+    std::vector<float> first(5), second(5);
+    a.fillUniform(first.data(), first.size());
+    b.fillUniform(second.data(), second.size());
+    EXPECT_EQ(first, second);
+
+    // Consecutive fills continue the sequence rather than repeating it
+    a.fillUniform(second.data(), second.size());
+    EXPECT_NE(first, second);
+
+    // Another stream of the same seed, or a split generator, gives different values
+    Philox other(7, 1);
+    other.fillUniform(second.data(), second.size());
+    EXPECT_NE(first, second);
+    Philox child = b.split();
+    EXPECT_NE(child.getSeed(), b.getSeed());
+
+    // Reseeding restarts the sequence
+    a.seed(7);
+    a.fillUniform(second.data(), second.size());
+    EXPECT_EQ(first, second);
+}
+
+TEST(RandomTest, MatrixRandomizeIsReproducible) {
+    Philox rng(123);
+    Matrix a(17, 9, "A");
+    a.randomize(rng, -1.0, 1.0);
+    rng.seed(123);
+    Matrix b(17, 9, "B");
+    b.randomize(rng, -1.0, 1.0);
+    EXPECT_TRUE(a == b);
+
+    Philox::global().seed(99);
+    MatrixF c(4, 4, "C");
+    c.randomize();
+    Philox::global().seed(99);
+    MatrixF d(4, 4, "D");
+    d.randomize();
+    EXPECT_TRUE(c == d);
+}
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include "../../include/matrix/Matrix.h"
+#include "../../include/matrix/Reduce.h"
+#include "../../include/parallel/ThreadPool.h"
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+using kernels::Summation;
+
+TEST(ReduceTest, SummationMethodsAgreeOnExactSums) {
+    for (size_t n : {size_t(0), size_t(1), size_t(7), size_t(8), size_t(129), size_t(1000)}) {
+        std::vector<double> x(n);
+        std::iota(x.begin(), x.end(), 1.0);
+        const double expected = static_cast<double>(n) * static_cast<double>(n + 1) / 2.0;
+        for (Summation method : {Summation::Naive, Summation::Pairwise, Summation::Kahan}) {
+            EXPECT_EQ(kernels::sum(n, x.data(), method), expected) << "n = " << n;
+        }
+    }
+}
+
+TEST(ReduceTest, CompensatedSumsKeepPrecision) {
+    // 1 followed by 100000 values too small to register against it one at a time
+    const size_t n = 100001;
+    std::vector<float> x(n, 1e-8f);
+    x[0] = 1.0f;
+    const float exact = 1.0f + 1e-3f;
+    EXPECT_NEAR(kernels::sum(n, x.data(), Summation::Kahan), exact, 1e-6f);
+    EXPECT_NEAR(kernels::sum(n, x.data(), Summation::Pairwise), exact, 1e-5f);
+    EXPECT_EQ(kernels::sum(n, x.data(), Summation::Naive), 1.0f);
+}
+
+TEST(ReduceTest, ResultsDoNotDependOnThreadCount) {
+    ThreadPool& pool = ThreadPool::global();
+    const size_t threads = pool.getThreadCount();
+    const size_t previous = kernels::getReductionParallelThreshold();
+    kernels::setReductionParallelThreshold(1000);
+
+    Philox rng(5);
+    Matrix m(300, 700, "M");
+    m.randomize(rng, -1.0, 1.0);
+    std::vector<double> x(100003);
+    rng.fillUniform(x.data(), x.size(), -1.0, 1.0);
+
+    std::vector<double> sums;
+    std::vector<Matrix> rowSums, columnSums;
+    for (size_t count : {size_t(1), size_t(4)}) {
+        pool.setThreadCount(count);
+        sums.push_back(kernels::sum(x.size(), x.data()));
+        rowSums.push_back(m.sumRows(Summation::Kahan));
+        columnSums.push_back(m.sumColumns());
+    }
+    pool.setThreadCount(threads);
+    kernels::setReductionParallelThreshold(previous);
+
+    EXPECT_EQ(sums[0], sums[1]);
+    EXPECT_TRUE(rowSums[0] == rowSums[1]);
+    EXPECT_TRUE(columnSums[0] == columnSums[1]);
+
+    double reference = 0.0;
+    for (size_t i = 0; i < m.getRows(); ++i) {
+        reference += m(i, 3);
+    }
+    EXPECT_NEAR(columnSums[0](0, 3), reference, 1e-12);
+}
+
+TEST(ReduceTest, PairwiseColumnSumsMatchNaive) {
+    // 1000 rows build a tree three levels deep above the leaf blocks
+    Philox rng(6);
+    Matrix m(1000, 37, "M");
+    m.randomize(rng, -1.0, 1.0);
+    const Matrix pairwise = m.sumColumns(Summation::Pairwise);
+    const Matrix naive = m.sumColumns(Summation::Naive);
+    EXPECT_TRUE(pairwise.isEqual(naive, 1e-10));
+}
+
+TEST(ReduceTest, MaxArgmaxAndNorm) {
+    std::vector<float> x(1000);
+    for (size_t i = 0; i < x.size(); ++i) {
+        x[i] = std::sin(static_cast<float>(i));
+    }
+    x[613] = 2.0f;
+    x[801] = 2.0f;
+    EXPECT_EQ(kernels::maxValue(x.size(), x.data()), 2.0f);
+    EXPECT_EQ(kernels::argmax(x.size(), x.data()), 613);
+
+    const double v[] = {3.0, -4.0};
+    EXPECT_DOUBLE_EQ(kernels::norm(2, v), 5.0);
+}
+
+TEST(ReduceTest, MatrixReductions) {
+    Matrix m(3, 4, "M");
+    m.setData({{1.0, -2.0, 3.0, 0.5}, {4.0, 9.0, -6.0, 1.5}, {0.0, 2.0, 8.0, -1.0}});
+    EXPECT_DOUBLE_EQ(m.sum(), 20.0);
+    EXPECT_DOUBLE_EQ(m.mean(), 20.0 / 12.0);
+    EXPECT_DOUBLE_EQ(m.max(), 9.0);
+    EXPECT_EQ(m.argmax(), (std::pair<size_t, size_t>{1, 1}));
+    EXPECT_DOUBLE_EQ(m.norm(), std::sqrt(218.5));
+    EXPECT_DOUBLE_EQ(m.sumRows(Summation::Naive)(1, 0), 8.5);
+    EXPECT_DOUBLE_EQ(m.sumColumns(Summation::Kahan)(0, 2), 5.0);
+
+    Matrix empty(0, 0, "Empty");
+    EXPECT_THROW(empty.max(), std::runtime_error);
+    EXPECT_THROW(empty.mean(), std::runtime_error);
+}
@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include "../../include/matrix/SparseMatrix.h"
+
+namespace {
+
+// 4 x 6 matrix with rows 1 and 3 empty
+SparseMatrix example() {
+    return SparseMatrix(4, 6, {0, 2, 2, 5, 5}, {1, 4, 0, 2, 5}, {1.0, -2.0, 3.0, 0.5, 4.0});
+}
+
+} // namespace
+
+TEST(SparseMatrixTest, ConstructionAndLookup) {
+    const SparseMatrix s = example();
+    EXPECT_EQ(s.getNonZeros(), 5);
+    EXPECT_DOUBLE_EQ(s.density(), 5.0 / 24.0);
+    EXPECT_EQ(s(0, 4), -2.0);
+    EXPECT_EQ(s(1, 1), 0.0);
+    EXPECT_EQ(s(2, 5), 4.0);
+    EXPECT_EQ(std::vector<size_t>(s.getActiveRows().begin(), s.getActiveRows().end()), (std::vector<size_t>{0, 2}));
+    EXPECT_THROW(s(4, 0), std::out_of_range);
+
+    EXPECT_THROW(SparseMatrix(2, 3, {0, 1}, {0}, {1.0}), std::invalid_argument);            // too few offsets
+    EXPECT_THROW(SparseMatrix(1, 3, {0, 2}, {2, 1}, {1.0, 1.0}), std::invalid_argument);    // unsorted
+    EXPECT_THROW(SparseMatrix(1, 3, {0, 1}, {3}, {1.0}), std::invalid_argument);            // out of range
+}
+
+TEST(SparseMatrixTest, DenseRoundTripAndTranspose) {
+    const SparseMatrix s = example();
+    const Matrix dense = s.toDense();
+    const SparseMatrix back = SparseMatrix::fromDense(dense);
+    EXPECT_EQ(back.getNonZeros(), s.getNonZeros());
+    EXPECT_EQ(back.toDense(), dense);
+    EXPECT_EQ(s.transpose().toDense(), dense.transpose());
+    EXPECT_EQ(s.transpose().transpose().toDense(), dense);
+}
+
+TEST(SparseMatrixTest, AppendRowBuildsSampleMajorBatch) {
+    SparseMatrix batch(0, 10);
+    const std::vector<size_t> first = {2, 7};
+    const std::vector<size_t> second = {0};
+    batch.appendRow(first, std::vector<double>{1.0, 1.0});
+    batch.appendRow(second, std::vector<double>{3.0});
+    EXPECT_EQ(batch.getRows(), 2);
+    EXPECT_EQ(batch(0, 7), 1.0);
+    EXPECT_EQ(batch(1, 0), 3.0);
+
+    const std::vector<size_t> unsorted = {5, 1};
+    EXPECT_THROW(batch.appendRow(unsorted, std::vector<double>{1.0, 1.0}), std::invalid_argument);
+}
+
+TEST(SparseMatrixTest, ProductsMatchDense) {
+    const SparseMatrix s = example();   // 4 x 6
+    const Matrix dense = s.toDense();
+
+    Matrix right(6, 3), left(5, 4), gradient(5, 6);
+    right.randomize(-1.0, 1.0);
+    left.randomize(-1.0, 1.0);
+    gradient.randomize(-1.0, 1.0);
+
+    EXPECT_TRUE(s.multiply(right).isEqual(dense.multiply(right, false), 1e-12));
+    EXPECT_TRUE(s.leftMultiply(left).isEqual(left.multiply(dense, false), 1e-12));
+
+    // target += alpha * gradient * sᵀ, leaving the columns of empty rows untouched
+    Matrix target(5, 4);
+    target.setData(1.0);
+    s.accumulateProductTransposed(-0.5, gradient, target.view());
+    const Matrix expected = Matrix(5, 4).setData(1.0) + gradient.multiply(dense.transpose(), false) * -0.5;
+    EXPECT_TRUE(target.isEqual(expected, 1e-12));
+    for (size_t r = 0; r < 5; ++r) {
+        EXPECT_EQ(target(r, 1), 1.0);
+        EXPECT_EQ(target(r, 3), 1.0);
+    }
+
+    EXPECT_THROW(s.multiply(Matrix(5, 3)), std::invalid_argument);
+    EXPECT_THROW(s.leftMultiply(Matrix(5, 5)), std::invalid_argument);
+}
@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include "../../include/matrix/Matrix.h"
+#include "../../include/matrix/Transpose.h"
+
+namespace {
+
+// Matrix whose element (i, j) encodes its position, so misplaced elements are easy to spot
+Matrix indexMatrix(size_t rows, size_t cols) {
+    Matrix m(rows, cols);
+    for (size_t i = 0; i < rows; ++i) {
+        for (size_t j = 0; j < cols; ++j) {
+            m(i, j) = static_cast<double>(i * 1000 + j);
+        }
+    }
+    return m;
+}
+
+void expectTransposed(const Matrix& original, const Matrix& transposed) {
+    ASSERT_EQ(transposed.getRows(), original.getCols());
+    ASSERT_EQ(transposed.getCols(), original.getRows());
+    for (size_t i = 0; i < original.getRows(); ++i) {
+        for (size_t j = 0; j < original.getCols(); ++j) {
+            ASSERT_EQ(transposed(j, i), original(i, j)) << "at (" << i << ", " << j << ")";
+        }
+    }
+}
+
+} // namespace
+
+TEST(TransposeTest, RectangularShapesAcrossTileEdges) {
+    for (auto [rows, cols] : {std::pair<size_t, size_t>{1, 1}, {1, 70}, {70, 1}, {31, 33}, {64, 100}, {129, 65}}) {
+        const Matrix m = indexMatrix(rows, cols);
+        expectTransposed(m, m.transpose());
+    }
+}
+
+TEST(TransposeTest, ParallelMatchesSerial) {
+    const size_t previous = kernels::getTransposeParallelThreshold();
+    kernels::setTransposeParallelThreshold(1);
+
+    const Matrix m = indexMatrix(300, 170);
+    expectTransposed(m, m.transpose());
+
+    Matrix square = indexMatrix(257, 257);
+    const Matrix original = square;
+    square.transposeInPlace();
+    expectTransposed(original, square);
+
+    kernels::setTransposeParallelThreshold(previous);
+}
+
+TEST(TransposeTest, InPlaceSquareAndRectangular) {
+    for (size_t n : {1, 2, 31, 32, 33, 100}) {
+        Matrix m = indexMatrix(n, n);
+        const Matrix original = m;
+        const double* buffer = m.getData().data();
+        m.transposeInPlace();
+        expectTransposed(original, m);
+        EXPECT_EQ(m.getData().data(), buffer);  // no reallocation for square matrices
+    }
+
+    Matrix wide = indexMatrix(3, 50);
+    const Matrix original = wide;
+    wide.transposeInPlace();
+    expectTransposed(original, wide);
+}
+
+TEST(TransposeTest, CopyFromTransposedView) {
+    const Matrix samples = indexMatrix(90, 40);  // sample-major: one row per sample
+    const Matrix features(samples.view().transpose());
+    expectTransposed(samples, features);
+
+    const MatrixF f(MatrixF(5, 7).view().transpose());
+    EXPECT_EQ(f.getRows(), 7);
+}
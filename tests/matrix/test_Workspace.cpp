@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+#include "../../include/matrix/Matrix.h"
+#include "../../include/matrix/Workspace.h"
+#include "../../include/layers/GRULayer.h"
+
+TEST(WorkspaceTest, ScopedMatricesAllocateFromWorkspace) {
+    Workspace workspace;
+    EXPECT_EQ(Workspace::current(), std::pmr::new_delete_resource());
+    {
+        WorkspaceScope scope(workspace);
+        EXPECT_EQ(Workspace::current(), &workspace);
+
+        Matrix a(10, 10);
+        Matrix b = a + a;
+        EXPECT_GE(workspace.getBytesUsed(), 2 * 100 * sizeof(double));
+        EXPECT_EQ(b.getRows(), 10);
+    }
+    EXPECT_EQ(Workspace::current(), std::pmr::new_delete_resource());
+    EXPECT_EQ(workspace.getBytesUsed(), 0);
+    EXPECT_GE(workspace.getHighWaterMark(), 2 * 100 * sizeof(double));
+}
+
+TEST(WorkspaceTest, NestedScopesResetOnlyAtOutermost) {
+    Workspace workspace;
+    WorkspaceScope outer(workspace);
+    Matrix kept(4, 4);
+    kept.setData(2.0);
+    {
+        WorkspaceScope inner(workspace);
+        Matrix temporary(4, 4);
+        temporary.setData(7.0);
+    }
+    EXPECT_GT(workspace.getBytesUsed(), 0);
+    EXPECT_EQ(kept(3, 3), 2.0);
+}
+
+TEST(WorkspaceTest, AssignmentCopiesOutOfWorkspace) {
+    Workspace workspace;
+    Matrix result(3, 3);
+    {
+        WorkspaceScope scope(workspace);
+        Matrix temporary(3, 3);
+        temporary.setData(1.5);
+        result = std::move(temporary);
+    }
+    {
+        // Reuse the workspace memory the temporary lived in
+        WorkspaceScope scope(workspace);
+        Matrix overwrite(3, 3);
+        overwrite.setData(-1.0);
+    }
+    EXPECT_EQ(result(0, 0), 1.5);
+    EXPECT_EQ(result(2, 2), 1.5);
+}
+
+TEST(WorkspaceTest, SteadyStateStopsGrowing) {
+    // 256 x 256 doubles overflow the first block, so the workspace has to spill and merge
+    Workspace workspace(1024);
+    Matrix input(256, 256);
+    input.randomize();
+
+    size_t capacity = 0;
+    for (int step = 0; step < 4; ++step) {
+        WorkspaceScope scope(workspace);
+        Matrix hidden = (input * 2.0) + input;
+        Matrix output = hidden.multiply(input, false);
+        EXPECT_EQ(output.getRows(), 256);
+        if (step == 1) {
+            capacity = workspace.getCapacity();
+        }
+    }
+    EXPECT_EQ(workspace.getBlockCount(), 1);
+    EXPECT_EQ(workspace.getCapacity(), capacity);
+}
+
+TEST(WorkspaceTest, LayerStateSurvivesScope) {
+    Workspace workspace;
+    GRULayer gru(3, 4);
+    Matrix input(1, 3);
+    input.setData({{1.0, 0.5, -0.5}});
+
+    Matrix expected(1, 4);
+    {
+        WorkspaceScope scope(workspace);
+        expected = gru.forward(input);
+    }
+    EXPECT_EQ(gru.getHiddenState(), expected);
+}
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include "../../include/parallel/ThreadPool.h"
+#include "../../include/matrix/Gemm.h"
+#include "../../include/matrix/Matrix.h"
+#include <atomic>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+TEST(ThreadPoolTest, ParallelForCoversRangeExactlyOnce) {
+    ThreadPool pool(4);
+    std::vector<std::atomic<int>> visits(1000);
+
+    pool.parallelFor(0, visits.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            visits[i]++;
+        }
+    });
+
+    for (const auto& count : visits) {
+        EXPECT_EQ(count.load(), 1);
+    }
+}
+
+TEST(ThreadPoolTest, WorkersArePersistent) {
+    ThreadPool pool(3);
+    std::mutex mutex;
+    std::set<std::thread::id> firstRun, secondRun;
+
+    auto record = [&](std::set<std::thread::id>& ids) {
+        return [&](size_t, size_t) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            std::lock_guard<std::mutex> lock(mutex);
+            ids.insert(std::this_thread::get_id());
+        };
+    };
+    pool.parallelFor(0, 3, record(firstRun));
+    pool.parallelFor(0, 3, record(secondRun));
+
+    EXPECT_EQ(firstRun.size(), 3);
+    EXPECT_EQ(firstRun, secondRun);  // The same threads are reused
+}
+
+TEST(ThreadPoolTest, SetThreadCountAtRuntime) {
+    ThreadPool pool(2);
+    EXPECT_EQ(pool.getThreadCount(), 2);
+    pool.setThreadCount(5);
+    EXPECT_EQ(pool.getThreadCount(), 5);
+    pool.setThreadCount(0);
+    EXPECT_EQ(pool.getThreadCount(), 1);
+
+    size_t calls = 0;
+    pool.parallelFor(0, 10, [&](size_t begin, size_t end) {
+        EXPECT_EQ(begin, 0);
+        EXPECT_EQ(end, 10);
+        ++calls;
+    });
+    EXPECT_EQ(calls, 1);
+}
+
+TEST(ThreadPoolTest, NestedLoopsRunInline) {
+    ThreadPool pool(4);
+    std::atomic<size_t> total{0};
+    pool.parallelFor(0, 4, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            pool.parallelFor(0, 10, [&](size_t b, size_t e) { total += e - b; });
+        }
+    });
+    EXPECT_EQ(total.load(), 40);
+}
+
+TEST(ThreadPoolTest, ExceptionsPropagateToCaller) {
+    ThreadPool pool(4);
+    EXPECT_THROW(pool.parallelFor(0, 8, [](size_t begin, size_t) {
+        if (begin >= 4) {
+            throw std::runtime_error("chunk failed");
+        }
+    }), std::runtime_error);
+
+    // The pool remains usable afterwards
+    std::atomic<size_t> total{0};
+    pool.parallelFor(0, 8, [&](size_t begin, size_t end) { total += end - begin; });
+    EXPECT_EQ(total.load(), 8);
+}
+
+TEST(ThreadPoolTest, ParallelGemmMatchesSerial) {
+    ThreadPool& pool = ThreadPool::global();
+    const size_t originalThreads = pool.getThreadCount();
+    const size_t originalThreshold = kernels::getGemmParallelThreshold();
+
+    Matrix a(150, 260), b(260, 90), tall(300, 40), wide(40, 3);
+    a.randomize(-1.0, 1.0);
+    b.randomize(-1.0, 1.0);
+    tall.randomize(-1.0, 1.0);
+    wide.randomize(-1.0, 1.0);
+
+    pool.setThreadCount(1);
+    Matrix serial = a.multiply(b, false);
+    Matrix serialThin = wide.transpose().multiply(tall.transpose(), false);
+
+    pool.setThreadCount(4);
+    kernels::setGemmParallelThreshold(0);
+    Matrix parallel = a.multiply(b, false);
+    Matrix parallelThin = wide.transpose().multiply(tall.transpose(), false);  // Few rows: split along N
+
+    kernels::setGemmParallelThreshold(originalThreshold);
+    pool.setThreadCount(originalThreads);
+
+    EXPECT_TRUE(parallel.isEqual(serial, 1e-12));
+    EXPECT_TRUE(parallelThin.isEqual(serialThin, 1e-12));
+}